@@ -0,0 +1,30 @@
+
+
+__kernel void d_mat_mul(
+          __global const unsigned int * sp_mat_row_indices,
+          __global const unsigned int * sp_mat_col_indices,
+          __global const float * sp_mat_elements,
+          __global const float * d_mat,
+          unsigned int d_mat_offset,
+          unsigned int d_mat_row_inc,
+          unsigned int d_mat_col_inc,
+          __global float * result,
+          unsigned int result_offset,
+          unsigned int result_row_inc,
+          unsigned int result_col_inc,
+          unsigned int result_row_size,
+          unsigned int result_col_size)
+{
+  for (unsigned int row = get_group_id(0); row < result_row_size; row += get_num_groups(0))
+  {
+    unsigned int row_start = sp_mat_row_indices[row];
+    unsigned int row_end   = sp_mat_row_indices[row+1];
+    for (unsigned int col = get_local_id(0); col < result_col_size; col += get_local_size(0))
+    {
+      float r = 0;
+      for (unsigned int k = row_start; k < row_end; ++k)
+        r += sp_mat_elements[k] * d_mat[d_mat_offset + sp_mat_col_indices[k] * d_mat_row_inc + col * d_mat_col_inc];
+      result[result_offset + row * result_row_inc + col * result_col_inc] = r;
+    }
+  }
+}
@@ -0,0 +1,74 @@
+
+// computes the partial inner products of x with the four vectors y0, y1, y2, y3 for each work group.
+// The partial result of y_j in group g is written to group_buffer[j * get_num_groups(0) + g].
+__kernel void inner_prod4(
+          __global const float * x,
+          unsigned int startx,
+          unsigned int incx,
+          unsigned int sizex,
+          __global const float * y0,
+          unsigned int start0,
+          unsigned int inc0,
+          __global const float * y1,
+          unsigned int start1,
+          unsigned int inc1,
+          __global const float * y2,
+          unsigned int start2,
+          unsigned int inc2,
+          __global const float * y3,
+          unsigned int start3,
+          unsigned int inc3,
+          __local float * tmp_buffer,
+          __global float * group_buffer)
+{
+  unsigned int entries_per_group = get_local_size(0) * (sizex-1) / get_global_size(0) + 1;
+  entries_per_group = (entries_per_group == 0) ? 1 : entries_per_group;
+  unsigned int group_start = get_group_id(0) * entries_per_group;
+
+  unsigned int group_size = entries_per_group;
+  if (group_start > sizex)
+    group_size = 0;
+  else if (group_start + entries_per_group > sizex)
+    group_size = sizex - group_start;
+
+  // compute partial results within group, reading x only once:
+  float tmp0 = 0;
+  float tmp1 = 0;
+  float tmp2 = 0;
+  float tmp3 = 0;
+  for (unsigned int i = group_start + get_local_id(0); i < group_start + group_size; i += get_local_size(0))
+  {
+    float val_x = x[i*incx + startx];
+    tmp0 += val_x * y0[i*inc0 + start0];
+    tmp1 += val_x * y1[i*inc1 + start1];
+    tmp2 += val_x * y2[i*inc2 + start2];
+    tmp3 += val_x * y3[i*inc3 + start3];
+  }
+  unsigned int lsize = get_local_size(0);
+  tmp_buffer[get_local_id(0)]           = tmp0;
+  tmp_buffer[get_local_id(0) +   lsize] = tmp1;
+  tmp_buffer[get_local_id(0) + 2*lsize] = tmp2;
+  tmp_buffer[get_local_id(0) + 3*lsize] = tmp3;
+
+  // now run reduction:
+  for (unsigned int stride = lsize/2; stride > 0; stride /= 2)
+  {
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (get_local_id(0) < stride)
+    {
+      tmp_buffer[get_local_id(0)]           += tmp_buffer[get_local_id(0) + stride];
+      tmp_buffer[get_local_id(0) +   lsize] += tmp_buffer[get_local_id(0) + stride +   lsize];
+      tmp_buffer[get_local_id(0) + 2*lsize] += tmp_buffer[get_local_id(0) + stride + 2*lsize];
+      tmp_buffer[get_local_id(0) + 3*lsize] += tmp_buffer[get_local_id(0) + stride + 3*lsize];
+    }
+  }
+
+  if (get_local_id(0) == 0)
+  {
+    group_buffer[get_group_id(0)]                       = tmp_buffer[0];
+    group_buffer[get_group_id(0) +   get_num_groups(0)] = tmp_buffer[lsize];
+    group_buffer[get_group_id(0) + 2*get_num_groups(0)] = tmp_buffer[2*lsize];
+    group_buffer[get_group_id(0) + 3*get_num_groups(0)] = tmp_buffer[3*lsize];
+  }
+}
+
@@ -0,0 +1,32 @@
+
+// sums the partial results computed by inner_prod4. Work group j sums the partial results of the j-th vector
+// and writes them to result[(offset + j) * inc_result + start_result] if j < num_results.
+__kernel void inner_prod4_sum(
+          __global const float * group_buffer,
+          unsigned int size_per_vector,
+          __local float * tmp_buffer,
+          __global float * result,
+          unsigned int start_result,
+          unsigned int inc_result,
+          unsigned int offset,
+          unsigned int num_results)
+{
+  unsigned int j = get_group_id(0);
+  __global const float * partial = group_buffer + j * size_per_vector;
+
+  float thread_sum = 0;
+  for (unsigned int i = get_local_id(0); i < size_per_vector; i += get_local_size(0))
+    thread_sum += partial[i];
+  tmp_buffer[get_local_id(0)] = thread_sum;
+
+  for (unsigned int stride = get_local_size(0)/2; stride > 0; stride /= 2)
+  {
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (get_local_id(0) < stride)
+      tmp_buffer[get_local_id(0)] += tmp_buffer[get_local_id(0) + stride];
+  }
+
+  if (get_local_id(0) == 0 && j < num_results)
+    result[(offset + j) * inc_result + start_result] = tmp_buffer[0];
+}
+
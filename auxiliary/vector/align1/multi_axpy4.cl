@@ -0,0 +1,37 @@
+
+// x += alpha * (c[0] * y0 + c[1] * y1 + c[2] * y2 + c[3] * y3), where c[j] = coeffs[(offset + j) * inc_coeffs + start_coeffs].
+// Only the first num_coeffs vectors are used, the remaining ones are ignored.
+__kernel void multi_axpy4(
+          __global float * x,
+          unsigned int startx,
+          unsigned int incx,
+          unsigned int sizex,
+          float alpha,
+          __global const float * coeffs,
+          unsigned int start_coeffs,
+          unsigned int inc_coeffs,
+          unsigned int offset,
+          unsigned int num_coeffs,
+          __global const float * y0,
+          unsigned int start0,
+          unsigned int inc0,
+          __global const float * y1,
+          unsigned int start1,
+          unsigned int inc1,
+          __global const float * y2,
+          unsigned int start2,
+          unsigned int inc2,
+          __global const float * y3,
+          unsigned int start3,
+          unsigned int inc3)
+{
+  float c0 =                    alpha * coeffs[ offset      * inc_coeffs + start_coeffs];
+  float c1 = (num_coeffs > 1) ? alpha * coeffs[(offset + 1) * inc_coeffs + start_coeffs] : 0;
+  float c2 = (num_coeffs > 2) ? alpha * coeffs[(offset + 2) * inc_coeffs + start_coeffs] : 0;
+  float c3 = (num_coeffs > 3) ? alpha * coeffs[(offset + 3) * inc_coeffs + start_coeffs] : 0;
+
+  for (unsigned int i = get_global_id(0); i < sizex; i += get_global_size(0))
+    x[i*incx + startx] += c0 * y0[i*inc0 + start0] + c1 * y1[i*inc1 + start1]
+                        + c2 * y2[i*inc2 + start2] + c3 * y3[i*inc3 + start3];
+}
+
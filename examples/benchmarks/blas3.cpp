@@ -182,8 +182,68 @@ int run_benchmark()
     std::cout << std::endl;
   }
 
-  
-  std::cout << " ------ Benchmark 4: LU factorization ------ " << std::endl;
+  std::cout << " ------ Benchmark 4: Matrix-Matrix product with transposed operands ------ " << std::endl;
+
+  for (std::size_t i=0; i<devices.size(); ++i)
+  {
+#ifdef VIENNACL_WITH_OPENCL
+    viennacl::ocl::current_context().switch_device(devices[i]);
+    std::cout << " - Device Name: " << viennacl::ocl::current_device().name() << std::endl;
+#endif
+
+    viennacl::fast_copy(&(stl_A[0]),
+                        &(stl_A[0]) + stl_A.size(),
+                        vcl_A);
+    viennacl::fast_copy(&(stl_B[0]),
+                        &(stl_B[0]) + stl_B.size(),
+                        vcl_B);
+    vcl_C = viennacl::linalg::prod(trans(vcl_A), vcl_B);
+    viennacl::backend::finish();
+    timer.start();
+    vcl_C = viennacl::linalg::prod(trans(vcl_A), vcl_B);
+    viennacl::backend::finish();
+    exec_time = timer.get();
+    std::cout << " - Execution time for C = A^T * B: " << exec_time << std::endl;
+    std::cout << " - GFLOPs (counting multiply&add as separate operations): " << 2.0 * (vcl_A.size1() / 1000.0) * (vcl_A.size2() / 1000.0) * (vcl_B.size2() / 1000.0) / exec_time << std::endl;
+
+    timer.start();
+    vcl_C = viennacl::linalg::prod(vcl_A, trans(vcl_B));
+    viennacl::backend::finish();
+    exec_time = timer.get();
+    std::cout << " - Execution time for C = A * B^T: " << exec_time << std::endl;
+    std::cout << " - GFLOPs (counting multiply&add as separate operations): " << 2.0 * (vcl_A.size1() / 1000.0) * (vcl_A.size2() / 1000.0) * (vcl_B.size2() / 1000.0) / exec_time << std::endl;
+    std::cout << std::endl;
+  }
+
+  std::cout << " ------ Benchmark 5: Matrix-Matrix product with mixed memory layouts ------ " << std::endl;
+
+  viennacl::matrix<ScalarType, viennacl::column_major> vcl_B_col(BLAS3_MATRIX_SIZE, BLAS3_MATRIX_SIZE);
+  viennacl::matrix<ScalarType, viennacl::column_major> vcl_C_col(BLAS3_MATRIX_SIZE, BLAS3_MATRIX_SIZE);
+  for (std::size_t i=0; i<devices.size(); ++i)
+  {
+#ifdef VIENNACL_WITH_OPENCL
+    viennacl::ocl::current_context().switch_device(devices[i]);
+    std::cout << " - Device Name: " << viennacl::ocl::current_device().name() << std::endl;
+#endif
+
+    viennacl::fast_copy(&(stl_A[0]),
+                        &(stl_A[0]) + stl_A.size(),
+                        vcl_A);
+    viennacl::fast_copy(&(stl_B[0]),
+                        &(stl_B[0]) + stl_B.size(),
+                        vcl_B_col);
+    vcl_C_col = viennacl::linalg::prod(vcl_A, vcl_B_col);
+    viennacl::backend::finish();
+    timer.start();
+    vcl_C_col = viennacl::linalg::prod(vcl_A, vcl_B_col);
+    viennacl::backend::finish();
+    exec_time = timer.get();
+    std::cout << " - Execution time on device (no setup time included): " << exec_time << std::endl;
+    std::cout << " - GFLOPs (counting multiply&add as separate operations): " << 2.0 * (vcl_A.size1() / 1000.0) * (vcl_A.size2() / 1000.0) * (vcl_B.size2() / 1000.0) / exec_time << std::endl;
+    std::cout << std::endl;
+  }
+
+  std::cout << " ------ Benchmark 6: LU factorization ------ " << std::endl;
 
   for (std::size_t i=0; i<devices.size(); ++i)
   {
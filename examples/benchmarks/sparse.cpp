@@ -47,6 +47,7 @@
 
 #include <iostream>
 #include <vector>
+#include <map>
 #include "benchmark-utils.hpp"
 #include "io.hpp"
 
@@ -285,6 +286,54 @@ int run_benchmark()
 }
 
 
+/** @brief Benchmarks compressed_matrix SpMV for a generated matrix with very irregular row lengths (most rows with 4 nonzeros, every 1000th row with 4000), for which a distribution of rows among threads is poorly balanced. */
+template<typename ScalarType>
+int run_irregular_benchmark()
+{
+  Timer timer;
+  double exec_time;
+
+  std::size_t size = 200000;
+  std::vector< std::map<unsigned int, ScalarType> > stl_matrix(size);
+  std::size_t nnz = 0;
+  unsigned int seed = 1;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    std::size_t row_nnz = (i % 1000 == 0) ? 4000 : 4;
+    stl_matrix[i][static_cast<unsigned int>(i)] = ScalarType(row_nnz);
+    while (stl_matrix[i].size() < row_nnz)
+    {
+      seed = seed * 1103515245u + 12345u;   // simple LCG for reproducible column indices
+      stl_matrix[i][static_cast<unsigned int>((seed >> 8) % size)] = ScalarType(-1);
+    }
+    nnz += stl_matrix[i].size();
+  }
+
+  viennacl::compressed_matrix<ScalarType> vcl_compressed_matrix(size, size);
+  viennacl::copy(stl_matrix, vcl_compressed_matrix);
+
+  viennacl::vector<ScalarType> vcl_vec1(size);
+  viennacl::vector<ScalarType> vcl_vec2 = viennacl::scalar_vector<ScalarType>(size, ScalarType(1));
+
+  std::cout << "------- Matrix-Vector product with compressed_matrix, irregular row lengths (" << size << " rows, " << nnz << " nonzeros) ----------" << std::endl;
+
+  vcl_vec1 = viennacl::linalg::prod(vcl_compressed_matrix, vcl_vec2); //startup calculation
+  viennacl::backend::finish();
+  timer.start();
+  for (int runs=0; runs<BENCHMARK_RUNS; ++runs)
+  {
+    vcl_vec1 = viennacl::linalg::prod(vcl_compressed_matrix, vcl_vec2);
+  }
+  viennacl::backend::finish();
+  exec_time = timer.get();
+  std::cout << "GPU time: " << exec_time << std::endl;
+  std::cout << "GPU "; printOps(2.0 * static_cast<double>(nnz), static_cast<double>(exec_time) / static_cast<double>(BENCHMARK_RUNS));
+  std::cout << vcl_vec1[0] << std::endl;
+
+  return EXIT_SUCCESS;
+}
+
+
 int main()
 {
   std::cout << std::endl;
@@ -304,6 +353,7 @@ int main()
   std::cout << "   -------------------------------" << std::endl;
   std::cout << "   # benchmarking single-precision" << std::endl;
   std::cout << "   -------------------------------" << std::endl;
+  run_irregular_benchmark<float>();
   run_benchmark<float>();
 #ifdef VIENNACL_WITH_OPENCL
   if( viennacl::ocl::current_device().double_support() )
@@ -313,6 +363,7 @@ int main()
     std::cout << "   -------------------------------" << std::endl;
     std::cout << "   # benchmarking double-precision" << std::endl;
     std::cout << "   -------------------------------" << std::endl;
+    run_irregular_benchmark<double>();
     run_benchmark<double>();
   }
   return 0;
@@ -34,6 +34,8 @@
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/compressed_matrix.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix.hpp"
 
 
 #include "viennacl/linalg/lanczos.hpp"
@@ -81,5 +83,21 @@ int main()
   
   std::cout << "Running Lanczos algorithm (this might take a while)..." << std::endl;
   std::vector<double> eigenvalues = initEig(ublas_A);
+
+  //
+  // The block Lanczos algorithm with thick restarts keeps the Krylov basis in a viennacl::matrix and applies the system matrix to several vectors at once.
+  // The eigenvectors are returned as the columns of a dense matrix:
+  //
+  viennacl::compressed_matrix<ScalarType> vcl_A(ublas_A.size1(), ublas_A.size2());
+  viennacl::copy(ublas_A, vcl_A);
+
+  std::cout << "Running block Lanczos algorithm with thick restarts..." << std::endl;
+  viennacl::linalg::block_lanczos_tag btag(10, 4, 100, 1e-8);
+  viennacl::matrix<ScalarType> eigenvectors;
+  std::vector<double> block_eigenvalues = viennacl::linalg::eig(vcl_A, eigenvectors, btag);
+  for(std::size_t i = 0; i< block_eigenvalues.size(); i++){
+          std::cout << "Eigenvalue " << i+1 << ": " << std::setprecision(10) << block_eigenvalues[i] << std::endl; 
+  }
+  std::cout << "Restarts: " << btag.iters() << ", relative residual: " << btag.error() << std::endl;
 }
 
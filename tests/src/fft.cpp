@@ -164,6 +164,68 @@ ScalarType opencl_fft(std::vector<ScalarType>& in,
     return diff_max(res, out);
 }
 
+ScalarType opencl_fft_plan(std::vector<ScalarType>& in,
+                           std::vector<ScalarType>& out,
+                           unsigned int /*row*/, unsigned int /*col*/, unsigned int batch_size)
+{
+    viennacl::vector<ScalarType> input(in.size());
+    viennacl::vector<ScalarType> output(in.size());
+
+    std::vector<ScalarType> res(in.size());
+
+    viennacl::fast_copy(in, input);
+
+    viennacl::fft_plan<ScalarType> plan((input.size() >> 1) / batch_size, batch_size);
+
+    // run the plan twice in order to exercise the reuse of cached tables and scratch buffers:
+    plan.execute(input, output);
+    plan.execute(input, output);
+
+    viennacl::backend::finish();
+    viennacl::fast_copy(output, res);
+
+    return diff_max(res, out);
+}
+
+ScalarType opencl_rfft(std::vector<ScalarType>& in,
+                       std::vector<ScalarType>& /*out*/,
+                       unsigned int /*row*/, unsigned int /*col*/, unsigned int /*batch_size*/)
+{
+    // use the real parts of the input data; the reference is the complex transform of the same data with zero imaginary parts
+    std::size_t size = in.size() / 2;
+    std::vector<ScalarType> real_in(size);
+    std::vector<ScalarType> complex_in(in.size());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      real_in[i] = in[2*i];
+      complex_in[2*i] = in[2*i];
+    }
+
+    viennacl::vector<ScalarType> input(size);
+    viennacl::vector<ScalarType> spectrum(2 * (size / 2 + 1));
+    viennacl::vector<ScalarType> output(size);
+    viennacl::vector<ScalarType> complex_input(in.size());
+    viennacl::vector<ScalarType> complex_output(in.size());
+
+    viennacl::fast_copy(real_in, input);
+    viennacl::fast_copy(complex_in, complex_input);
+
+    viennacl::rfft(input, spectrum);
+    viennacl::fft(complex_input, complex_output);
+    viennacl::irfft(spectrum, output);
+
+    viennacl::backend::finish();
+    std::vector<ScalarType> res(spectrum.size());
+    std::vector<ScalarType> ref(in.size());
+    std::vector<ScalarType> res_real(size);
+    viennacl::fast_copy(spectrum, res);
+    viennacl::fast_copy(complex_output, ref);
+    viennacl::fast_copy(output, res_real);
+    ref.resize(res.size());
+
+    return std::max(diff_max(res, ref), diff_max(res_real, real_in));
+}
+
 ScalarType opencl_2d_fft_1arg(std::vector<ScalarType>& in,
                               std::vector<ScalarType>& out,
                               unsigned int row, unsigned int col, unsigned int /*batch_size*/)
@@ -214,7 +276,7 @@ ScalarType opencl_direct(std::vector<ScalarType>& in,
 
     unsigned int size = (input.size() >> 1) / batch_num;
 
-    viennacl::detail::fft::direct<ScalarType>(input.handle().opencl_handle(), output.handle().opencl_handle(), size, size, batch_num);
+    viennacl::detail::fft::direct<ScalarType>(input.handle(), output.handle(), size, size, batch_num);
 
     viennacl::backend::finish();
     viennacl::fast_copy(output, res);
@@ -254,7 +316,7 @@ ScalarType opencl_radix2(std::vector<ScalarType>& in,
 
     unsigned int size = (input.size() >> 1) / batch_num;
 
-    viennacl::detail::fft::radix2<ScalarType>(input.handle().opencl_handle(), size, size, batch_num);
+    viennacl::detail::fft::radix2<ScalarType>(input.handle(), size, size, batch_num);
 
     viennacl::backend::finish();
     viennacl::fast_copy(input, res);
@@ -321,6 +383,183 @@ int test_correctness(const std::string& log_tag,
 
 
 
+template <typename VectorType>
+ScalarType real_transforms_on_subvectors(VectorType & x_sub, VectorType & y_sub, VectorType & spectrum_sub, VectorType & result_sub,
+                                         std::vector<ScalarType> & x, std::vector<ScalarType> & y,
+                                         std::vector<ScalarType> & spectrum_ref, std::vector<ScalarType> & convolution_ref)
+{
+    viennacl::vector<ScalarType> tmp(x.size());
+    viennacl::fast_copy(x, tmp);
+    x_sub = tmp;
+    viennacl::fast_copy(y, tmp);
+    y_sub = tmp;
+
+    viennacl::rfft(x_sub, spectrum_sub);
+    viennacl::irfft(spectrum_sub, result_sub);
+
+    std::vector<ScalarType> spectrum_result(spectrum_ref.size()), x_result(x.size()), convolution_result(x.size());
+    viennacl::vector<ScalarType> spectrum_tmp(spectrum_sub);
+    viennacl::fast_copy(spectrum_tmp, spectrum_result);
+    tmp = result_sub;
+    viennacl::fast_copy(tmp, x_result);
+
+    viennacl::linalg::real_convolve(x_sub, y_sub, result_sub);
+    tmp = result_sub;
+    viennacl::fast_copy(tmp, convolution_result);
+
+    ScalarType diff = std::max(std::max(diff_max(spectrum_result, spectrum_ref), diff_max(x_result, x)),
+                               diff_max(convolution_result, convolution_ref));
+
+    // helper operations: embed the first half of x into the complex vector spectrum_sub, extract it again, and reverse x_sub:
+    std::size_t complex_size = spectrum_ref.size() / 2;
+    viennacl::detail::fft::real_to_complex(x_sub, spectrum_sub, complex_size);
+    viennacl::detail::fft::complex_to_real(spectrum_sub, result_sub, complex_size);
+    viennacl::detail::fft::reverse(x_sub);
+
+    std::vector<ScalarType> complex_ref(spectrum_ref.size()), real_ref(x.size()), reversed_ref(x.size());
+    for (std::size_t i = 0; i < complex_size; ++i)
+    {
+      complex_ref[2*i] = x[i];
+      real_ref[i] = x[i];
+    }
+    for (std::size_t i = complex_size; i < x.size(); ++i)
+      real_ref[i] = convolution_ref[i];  // not touched by complex_to_real()
+    for (std::size_t i = 0; i < x.size(); ++i)
+      reversed_ref[i] = x[x.size() - 1 - i];
+
+    spectrum_tmp = spectrum_sub;
+    viennacl::fast_copy(spectrum_tmp, spectrum_result);
+    tmp = result_sub;
+    viennacl::fast_copy(tmp, x_result);
+    std::vector<ScalarType> reversed_result(x.size());
+    tmp = x_sub;
+    viennacl::fast_copy(tmp, reversed_result);
+
+    return std::max(diff, std::max(std::max(diff_max(spectrum_result, complex_ref), diff_max(x_result, real_ref)),
+                                   diff_max(reversed_result, reversed_ref)));
+}
+
+int test_range_and_slice()
+{
+    std::cout << "*****************fft::rfft::range_slice***************************\n";
+
+    std::size_t size = 30;
+    std::size_t spectrum_size = 2 * (size / 2 + 1);
+    std::vector<ScalarType> x(size), y(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      x[i] = ScalarType(std::sin(0.3 * i)) + ScalarType(i % 7 + 1) / ScalarType(7);
+      y[i] = ScalarType(std::cos(0.1 * i * i));
+    }
+
+    // reference results from contiguous vectors:
+    viennacl::vector<ScalarType> x_ref(size), y_ref(size);
+    viennacl::vector<ScalarType> spectrum(spectrum_size);
+    viennacl::vector<ScalarType> convolution(size);
+    viennacl::fast_copy(x, x_ref);
+    viennacl::fast_copy(y, y_ref);
+    viennacl::rfft(x_ref, spectrum);
+    viennacl::linalg::real_convolve(x_ref, y_ref, convolution);
+
+    std::vector<ScalarType> spectrum_ref(spectrum_size), convolution_ref(size);
+    viennacl::fast_copy(spectrum, spectrum_ref);
+    viennacl::fast_copy(convolution, convolution_ref);
+
+    // subvectors start at offset 3 of larger vectors filled with a marker value, which must not be overwritten:
+    ScalarType marker = 42;
+    for (std::size_t stride = 1; stride <= 2; ++stride)
+    {
+      viennacl::vector<ScalarType> x_big = viennacl::scalar_vector<ScalarType>(3 + stride * size + 5, marker);
+      viennacl::vector<ScalarType> y_big = viennacl::scalar_vector<ScalarType>(3 + stride * size + 5, marker);
+      viennacl::vector<ScalarType> spectrum_big = viennacl::scalar_vector<ScalarType>(3 + stride * spectrum_size + 5, marker);
+      viennacl::vector<ScalarType> result_big = viennacl::scalar_vector<ScalarType>(3 + stride * size + 5, marker);
+
+      ScalarType diff = 0;
+      if (stride == 1)
+      {
+        viennacl::range r(3, 3 + size);
+        viennacl::vector_range<viennacl::vector<ScalarType> > x_sub(x_big, r), y_sub(y_big, r), result_sub(result_big, r);
+        viennacl::vector_range<viennacl::vector<ScalarType> > spectrum_sub(spectrum_big, viennacl::range(3, 3 + spectrum_size));
+        diff = real_transforms_on_subvectors(x_sub, y_sub, spectrum_sub, result_sub, x, y, spectrum_ref, convolution_ref);
+      }
+      else
+      {
+        viennacl::slice s(3, stride, size);
+        viennacl::vector_slice<viennacl::vector<ScalarType> > x_sub(x_big, s), y_sub(y_big, s), result_sub(result_big, s);
+        viennacl::vector_slice<viennacl::vector<ScalarType> > spectrum_sub(spectrum_big, viennacl::slice(3, stride, spectrum_size));
+        diff = real_transforms_on_subvectors(x_sub, y_sub, spectrum_sub, result_sub, x, y, spectrum_ref, convolution_ref);
+      }
+
+      std::vector<ScalarType> result_all(result_big.size()), spectrum_all(spectrum_big.size());
+      viennacl::fast_copy(result_big, result_all);
+      viennacl::fast_copy(spectrum_big, spectrum_all);
+      for (std::size_t i = 0; i < result_all.size(); ++i)
+        if ((i < 3 || (i - 3) % stride != 0 || (i - 3) / stride >= size) && result_all[i] != marker)
+          diff = 1;
+      for (std::size_t i = 0; i < spectrum_all.size(); ++i)
+        if ((i < 3 || (i - 3) % stride != 0 || (i - 3) / stride >= spectrum_size) && spectrum_all[i] != marker)
+          diff = 1;
+
+      if (diff > EPS)
+      {
+        std::cout << "   [Fail] " << (stride == 1 ? "range" : "slice") << ": " << diff << std::endl;
+        return EXIT_FAILURE;
+      }
+      std::cout << "   [Ok] " << (stride == 1 ? "range" : "slice") << ": " << diff << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+
+int test_plan_cache()
+{
+    namespace host_fft = viennacl::linalg::host_based::fft;
+
+    std::cout << "*****************fft::plan_cache***************************\n";
+
+    host_fft::trim_plan_cache();
+    if (host_fft::plan_cache_bytes() != 0)
+    {
+      std::cout << "[Fail] trim_plan_cache() did not release tables of destroyed plans" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::size_t bytes_in_use = 0;
+    {
+      host_fft::plan<ScalarType> plan1(1000, ScalarType(-1));
+      host_fft::real_plan<ScalarType> plan2(1000);
+      bytes_in_use = host_fft::plan_cache_bytes();
+
+      host_fft::plan<ScalarType> plan3(plan1);   //copies share the cached tables
+      host_fft::trim_plan_cache();               //tables in use are kept
+      if (bytes_in_use == 0 || host_fft::plan_cache_bytes() != bytes_in_use)
+      {
+        std::cout << "[Fail] Tables of plans in use are not cached" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    if (host_fft::plan_cache_bytes() != bytes_in_use)
+    {
+      std::cout << "[Fail] Tables of destroyed plans are not kept for reuse" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    host_fft::trim_plan_cache();
+    if (host_fft::plan_cache_bytes() != 0)
+    {
+      std::cout << "[Fail] trim_plan_cache() did not release unused tables" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << "   [Ok] " << bytes_in_use << " bytes cached" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+
+
 int main() 
 {
   std::cout << "*" << std::endl;
@@ -340,6 +579,14 @@ int main()
     return EXIT_FAILURE;
   if (test_correctness("fft::batch::fft", "../non-release/testdata/batch_radix.data", read_vectors_pair, &opencl_fft) == EXIT_FAILURE)
     return EXIT_FAILURE;
+  if (test_correctness("fft::plan", "../non-release/testdata/cufft.data", read_vectors_pair, &opencl_fft_plan) == EXIT_FAILURE)
+    return EXIT_FAILURE;
+  if (test_correctness("fft::batch::plan", "../non-release/testdata/batch_radix.data", read_vectors_pair, &opencl_fft_plan) == EXIT_FAILURE)
+    return EXIT_FAILURE;
+  if (test_correctness("fft::rfft::1", "../non-release/testdata/cufft.data", read_vectors_pair, &opencl_rfft) == EXIT_FAILURE)
+    return EXIT_FAILURE;
+  if (test_correctness("fft::rfft::2", "../non-release/testdata/radix2.data", read_vectors_pair, &opencl_rfft) == EXIT_FAILURE)
+    return EXIT_FAILURE;
   if (test_correctness("fft::convolve::1", "../non-release/testdata/cufft.data", read_vectors_pair, &opencl_convolve) == EXIT_FAILURE)
     return EXIT_FAILURE;
   if (test_correctness("fft::convolve::2", "../non-release/testdata/radix2.data", read_vectors_pair, &opencl_convolve) == EXIT_FAILURE)
@@ -370,6 +617,12 @@ int main()
                         "../non-release/testdata/fft2d_direct_big.data", read_matrices_pair, &opencl_2d_fft_2arg) == EXIT_FAILURE)
     return EXIT_FAILURE;
 
+  if (test_range_and_slice() == EXIT_FAILURE)
+    return EXIT_FAILURE;
+
+  if (test_plan_cache() == EXIT_FAILURE)
+    return EXIT_FAILURE;
+
   std::cout << std::endl;
   std::cout << "------- Test completed --------" << std::endl;
   std::cout << std::endl;
@@ -0,0 +1,376 @@
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+//
+// *** System
+//
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <algorithm>
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+//
+// *** ViennaCL
+//
+#include "viennacl/scalar.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/ilu.hpp"
+#include "viennacl/linalg/cg.hpp"
+#include "viennacl/linalg/bicgstab.hpp"
+#include "viennacl/linalg/gmres.hpp"
+#include "examples/tutorial/Random.hpp"
+
+//
+// -------------------------------------------------------------
+//
+
+/** @brief Sets up the 5-point finite difference Laplacian on an m x m grid (natural ordering) */
+template <typename NumericT>
+void fill_poisson_2d(std::vector< std::map<unsigned int, NumericT> > & cpu_matrix, unsigned int m)
+{
+  cpu_matrix.clear();
+  cpu_matrix.resize(m * m);
+  for (unsigned int i=0; i<m; ++i)
+  {
+    for (unsigned int j=0; j<m; ++j)
+    {
+      unsigned int row = i * m + j;
+      cpu_matrix[row][row] = 4;
+      if (i > 0)     cpu_matrix[row][row - m] = -1;
+      if (j > 0)     cpu_matrix[row][row - 1] = -1;
+      if (j < m - 1) cpu_matrix[row][row + 1] = -1;
+      if (i < m - 1) cpu_matrix[row][row + m] = -1;
+    }
+  }
+}
+
+template <typename NumericT>
+NumericT relative_diff(std::vector<NumericT> const & v1, std::vector<NumericT> const & v2)
+{
+  NumericT diff = 0;
+  NumericT norm = 0;
+  for (std::size_t i=0; i<v1.size(); ++i)
+  {
+    diff = std::max(diff, static_cast<NumericT>(std::fabs(v1[i] - v2[i])));
+    norm = std::max(norm, static_cast<NumericT>(std::fabs(v1[i])));
+  }
+  return (norm > 0) ? diff / norm : diff;
+}
+
+inline int get_max_threads()
+{
+#ifdef VIENNACL_WITH_OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+inline void set_num_threads(int num_threads)
+{
+#ifdef VIENNACL_WITH_OPENMP
+  omp_set_num_threads(num_threads);
+#else
+  (void)num_threads;
+#endif
+}
+
+/** @brief Applies the preconditioner to a copy of rhs and returns the result in host memory */
+template <typename PrecondType, typename NumericT>
+std::vector<NumericT> apply_precond(PrecondType const & precond, viennacl::vector<NumericT> const & rhs)
+{
+  viennacl::vector<NumericT> vec = rhs;
+  precond.apply(vec);
+
+  std::vector<NumericT> result(vec.size());
+  viennacl::copy(vec, result);
+  return result;
+}
+
+/** @brief Checks that the ILU preconditioners give the same result with and without level scheduling.
+*
+* The sequential substitution is used as a reference. With OpenMP, the level schedule is set up automatically for more than one thread,
+* which requires enough rows per level (host_level_scheduling_pays_off()). Hence the grid is chosen large enough for two threads.
+*/
+template <typename NumericT, typename Epsilon>
+int test_ilu_level_scheduling(Epsilon const & epsilon)
+{
+  int retval = EXIT_SUCCESS;
+  unsigned int m = 140;
+
+  std::vector< std::map<unsigned int, NumericT> > cpu_matrix;
+  fill_poisson_2d(cpu_matrix, m);
+  viennacl::compressed_matrix<NumericT> vcl_matrix(m * m, m * m);
+  viennacl::copy(cpu_matrix, vcl_matrix);
+
+  std::vector<NumericT> cpu_rhs(m * m);
+  for (std::size_t i=0; i<cpu_rhs.size(); ++i)
+    cpu_rhs[i] = random<NumericT>();
+  viennacl::vector<NumericT> vcl_rhs(m * m);
+  viennacl::copy(cpu_rhs, vcl_rhs);
+
+  //
+  // ILU0
+  //
+  {
+    viennacl::linalg::ilu0_tag sequential_tag;
+    viennacl::linalg::ilu0_tag level_scheduling_tag(true);
+
+    int max_threads = get_max_threads();
+    set_num_threads(1);
+    viennacl::linalg::ilu0_precond< viennacl::compressed_matrix<NumericT> > sequential_precond(vcl_matrix, sequential_tag);
+    viennacl::linalg::ilu0_precond< viennacl::compressed_matrix<NumericT> > level_scheduling_precond(vcl_matrix, level_scheduling_tag);
+    set_num_threads(2);
+    viennacl::linalg::ilu0_precond< viennacl::compressed_matrix<NumericT> > automatic_precond(vcl_matrix, sequential_tag);
+    set_num_threads(max_threads);
+
+    std::vector<NumericT> sequential_result       = apply_precond(sequential_precond, vcl_rhs);
+    std::vector<NumericT> level_scheduling_result = apply_precond(level_scheduling_precond, vcl_rhs);
+    std::vector<NumericT> automatic_result        = apply_precond(automatic_precond, vcl_rhs);
+
+    std::cout << "ILU0: levels (sequential, explicit, automatic): "
+              << sequential_precond.levels() << ", " << level_scheduling_precond.levels() << ", " << automatic_precond.levels() << std::endl;
+
+    if (sequential_precond.levels() != 0 || level_scheduling_precond.levels() == 0)
+    {
+      std::cout << "# Error at operation: ILU0 level schedule setup" << std::endl;
+      retval = EXIT_FAILURE;
+    }
+#ifdef VIENNACL_WITH_OPENMP
+    if (automatic_precond.levels() == 0)
+    {
+      std::cout << "# Error at operation: ILU0 automatic level scheduling not enabled" << std::endl;
+      retval = EXIT_FAILURE;
+    }
+#endif
+
+    if (relative_diff(sequential_result, level_scheduling_result) > epsilon || relative_diff(sequential_result, automatic_result) > epsilon)
+    {
+      std::cout << "# Error at operation: ILU0 with level scheduling" << std::endl;
+      std::cout << "  diff: " << relative_diff(sequential_result, level_scheduling_result) << ", " << relative_diff(sequential_result, automatic_result) << std::endl;
+      retval = EXIT_FAILURE;
+    }
+  }
+
+  //
+  // ILUT
+  //
+  {
+    viennacl::linalg::ilut_tag sequential_tag;
+    viennacl::linalg::ilut_tag level_scheduling_tag(20, 1e-4, true);
+
+    int max_threads = get_max_threads();
+    set_num_threads(1);
+    viennacl::linalg::ilut_precond< viennacl::compressed_matrix<NumericT> > sequential_precond(vcl_matrix, sequential_tag);
+    viennacl::linalg::ilut_precond< viennacl::compressed_matrix<NumericT> > level_scheduling_precond(vcl_matrix, level_scheduling_tag);
+    set_num_threads(2);
+    viennacl::linalg::ilut_precond< viennacl::compressed_matrix<NumericT> > automatic_precond(vcl_matrix, sequential_tag);
+    set_num_threads(max_threads);
+
+    std::vector<NumericT> sequential_result       = apply_precond(sequential_precond, vcl_rhs);
+    std::vector<NumericT> level_scheduling_result = apply_precond(level_scheduling_precond, vcl_rhs);
+    std::vector<NumericT> automatic_result        = apply_precond(automatic_precond, vcl_rhs);
+
+    // the fill-in of ILUT may produce too many levels for the automatic level scheduling, so its schedule may have been dropped:
+    std::cout << "ILUT: levels (sequential, explicit, automatic): "
+              << sequential_precond.levels() << ", " << level_scheduling_precond.levels() << ", " << automatic_precond.levels() << std::endl;
+
+    if (sequential_precond.levels() != 0 || level_scheduling_precond.levels() == 0)
+    {
+      std::cout << "# Error at operation: ILUT level schedule setup" << std::endl;
+      retval = EXIT_FAILURE;
+    }
+
+    if (relative_diff(sequential_result, level_scheduling_result) > epsilon || relative_diff(sequential_result, automatic_result) > epsilon)
+    {
+      std::cout << "# Error at operation: ILUT with level scheduling" << std::endl;
+      std::cout << "  diff: " << relative_diff(sequential_result, level_scheduling_result) << ", " << relative_diff(sequential_result, automatic_result) << std::endl;
+      retval = EXIT_FAILURE;
+    }
+  }
+
+  return retval;
+}
+
+/** @brief Returns the true relative residual ||b - A x|| / ||b||, computed independently of the solver */
+template <typename NumericT>
+NumericT relative_residual(viennacl::compressed_matrix<NumericT> const & A, viennacl::vector<NumericT> const & x, viennacl::vector<NumericT> const & b)
+{
+  viennacl::vector<NumericT> residual = viennacl::linalg::prod(A, x);
+  residual -= b;
+  return viennacl::linalg::norm_2(residual) / viennacl::linalg::norm_2(b);
+}
+
+/** @brief Solves a 2D Poisson problem with CG, BiCGStab and GMRES (which use the fused host kernels or batched inner products for compressed_matrix) and checks the true residual */
+template <typename NumericT>
+int test_solvers(double solver_tolerance)
+{
+  int retval = EXIT_SUCCESS;
+  unsigned int m = 40;
+
+  std::vector< std::map<unsigned int, NumericT> > cpu_matrix;
+  fill_poisson_2d(cpu_matrix, m);
+  viennacl::compressed_matrix<NumericT> vcl_matrix(m * m, m * m);
+  viennacl::copy(cpu_matrix, vcl_matrix);
+
+  std::vector<NumericT> cpu_rhs(m * m);
+  for (std::size_t i=0; i<cpu_rhs.size(); ++i)
+    cpu_rhs[i] = random<NumericT>();
+  viennacl::vector<NumericT> vcl_rhs(m * m);
+  viennacl::copy(cpu_rhs, vcl_rhs);
+
+  // the estimated residual may deviate from the true residual due to round-off (in single precision the true residual stagnates at about eps * cond(A) = 1e-4):
+  NumericT residual_tolerance = static_cast<NumericT>(10.0 * solver_tolerance);
+
+  viennacl::linalg::cg_tag cg_tag(solver_tolerance, 1000);
+  viennacl::vector<NumericT> cg_result = viennacl::linalg::solve(vcl_matrix, vcl_rhs, cg_tag);
+  NumericT cg_residual = relative_residual(vcl_matrix, cg_result, vcl_rhs);
+  std::cout << "CG: iterations: " << cg_tag.iters() << ", estimated residual: " << cg_tag.error() << ", true residual: " << cg_residual << std::endl;
+  if (cg_tag.iters() >= cg_tag.max_iterations() || cg_residual > residual_tolerance)
+  {
+    std::cout << "# Error at operation: CG solver" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
+  viennacl::linalg::bicgstab_tag bicgstab_tag(solver_tolerance, 1000);
+  viennacl::vector<NumericT> bicgstab_result = viennacl::linalg::solve(vcl_matrix, vcl_rhs, bicgstab_tag);
+  NumericT bicgstab_residual = relative_residual(vcl_matrix, bicgstab_result, vcl_rhs);
+  std::cout << "BiCGStab: iterations: " << bicgstab_tag.iters() << ", estimated residual: " << bicgstab_tag.error() << ", true residual: " << bicgstab_residual << std::endl;
+  if (bicgstab_tag.iters() >= bicgstab_tag.max_iterations() || bicgstab_residual > residual_tolerance)
+  {
+    std::cout << "# Error at operation: BiCGStab solver" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
+  // GMRES with Gram-Schmidt orthogonalization (default for viennacl::vector) vs. GMRES with Householder reflections:
+  viennacl::linalg::gmres_tag gmres_tag(solver_tolerance, 1000, 30);
+  viennacl::vector<NumericT> gmres_result = viennacl::linalg::solve(vcl_matrix, vcl_rhs, gmres_tag);
+  NumericT gmres_residual = relative_residual(vcl_matrix, gmres_result, vcl_rhs);
+  std::cout << "GMRES (Gram-Schmidt): iterations: " << gmres_tag.iters() << ", estimated residual: " << gmres_tag.error() << ", true residual: " << gmres_residual << std::endl;
+  if (gmres_tag.iters() >= gmres_tag.max_iterations() || gmres_residual > residual_tolerance)
+  {
+    std::cout << "# Error at operation: GMRES solver (Gram-Schmidt)" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
+  viennacl::linalg::gmres_tag householder_tag(solver_tolerance, 1000, 30);
+  viennacl::vector<NumericT> householder_result = viennacl::linalg::detail::solve_impl(vcl_matrix, vcl_rhs, householder_tag, viennacl::linalg::no_precond());
+  NumericT householder_residual = relative_residual(vcl_matrix, householder_result, vcl_rhs);
+  std::cout << "GMRES (Householder): iterations: " << householder_tag.iters() << ", estimated residual: " << householder_tag.error() << ", true residual: " << householder_residual << std::endl;
+  if (householder_tag.iters() >= householder_tag.max_iterations() || householder_residual > residual_tolerance)
+  {
+    std::cout << "# Error at operation: GMRES solver (Householder)" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
+  // both variants are mathematically equivalent, hence they need about the same number of iterations and yield about the same solution:
+  viennacl::vector<NumericT> gmres_difference = gmres_result - householder_result;
+  NumericT gmres_solution_difference = viennacl::linalg::norm_2(gmres_difference) / viennacl::linalg::norm_2(householder_result);
+  std::cout << "GMRES: relative difference of the solutions: " << gmres_solution_difference << std::endl;
+  if (gmres_tag.iters() > householder_tag.iters() + gmres_tag.krylov_dim() || gmres_solution_difference > 100 * residual_tolerance)
+  {
+    std::cout << "# Error at operation: GMRES solver (Gram-Schmidt vs. Householder)" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
+  return retval;
+}
+
+//
+// -------------------------------------------------------------
+//
+template< typename NumericT, typename Epsilon >
+int test(Epsilon const& epsilon)
+{
+  int retval = EXIT_SUCCESS;
+
+  std::cout << "Testing ILU preconditioners with level scheduling..." << std::endl;
+  if (test_ilu_level_scheduling<NumericT>(epsilon) == EXIT_FAILURE)
+    retval = EXIT_FAILURE;
+
+  std::cout << "Testing CG, BiCGStab and GMRES..." << std::endl;
+  if (test_solvers<NumericT>(sizeof(NumericT) == sizeof(float) ? 1e-4 : 1e-10) == EXIT_FAILURE)
+    retval = EXIT_FAILURE;
+
+  return retval;
+}
+
+//
+// -------------------------------------------------------------
+//
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Iterative Solvers and Preconditioners" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  int retval = EXIT_SUCCESS;
+
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+  {
+    typedef float NumericT;
+    NumericT epsilon = static_cast<NumericT>(1E-4);
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: float" << std::endl;
+    retval = test<NumericT>(epsilon);
+    if( retval == EXIT_SUCCESS )
+        std::cout << "# Test passed" << std::endl;
+    else
+        return retval;
+  }
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  {
+    typedef double NumericT;
+    NumericT epsilon = 1.0E-10;
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: double" << std::endl;
+    retval = test<NumericT>(epsilon);
+    if( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return retval;
+}
@@ -0,0 +1,236 @@
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+//
+// *** System
+//
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <algorithm>
+
+//
+// *** ViennaCL
+//
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/lanczos.hpp"
+
+
+/** @brief Checks the eigenvalues returned by both eig() overloads with block_lanczos_tag as well as the residuals ||A x - lambda x|| of the eigenvectors. */
+template <typename NumericT>
+int test_block_lanczos(std::string const & name,
+                       std::vector< std::map<unsigned int, NumericT> > const & cpu_A,
+                       std::vector<NumericT> const & exact_eigenvalues,  // descending
+                       viennacl::linalg::block_lanczos_tag const & tag,
+                       NumericT epsilon)
+{
+  std::cout << "Testing " << name << " (" << cpu_A.size() << "x" << cpu_A.size() << ", " << tag.num_eigenvalues() << " eigenvalues, block size " << tag.block_size() << ")" << std::endl;
+
+  std::size_t n = cpu_A.size();
+  std::size_t num_eig = tag.num_eigenvalues();
+
+  viennacl::compressed_matrix<NumericT> A(n, n);
+  viennacl::copy(cpu_A, A);
+
+  NumericT lambda_max = std::fabs(exact_eigenvalues[0]);
+
+  //
+  // eigenvalues only:
+  //
+  std::vector<NumericT> eigenvalues = viennacl::linalg::eig(A, tag);
+  if (eigenvalues.size() != num_eig)
+  {
+    std::cout << "# Error at operation: eig(A, tag), wrong number of eigenvalues: " << eigenvalues.size() << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (std::size_t i = 0; i < num_eig; ++i)
+  {
+    if (std::fabs(eigenvalues[i] - exact_eigenvalues[i]) > epsilon * lambda_max)
+    {
+      std::cout << "# Error at operation: eig(A, tag), eigenvalue " << i << ": " << eigenvalues[i] << " vs. " << exact_eigenvalues[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  //
+  // eigenvalues and eigenvectors:
+  //
+  viennacl::matrix<NumericT, viennacl::column_major> X;
+  std::vector<NumericT> eigenvalues_2 = viennacl::linalg::eig(A, X, tag);
+  if (eigenvalues_2.size() != num_eig || X.size1() != n || X.size2() != num_eig)
+  {
+    std::cout << "# Error at operation: eig(A, X, tag), wrong dimensions" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (std::size_t i = 0; i < num_eig; ++i)
+  {
+    if (std::fabs(eigenvalues_2[i] - exact_eigenvalues[i]) > epsilon * lambda_max)
+    {
+      std::cout << "# Error at operation: eig(A, X, tag), eigenvalue " << i << ": " << eigenvalues_2[i] << " vs. " << exact_eigenvalues[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // residuals of the eigenvectors:
+  viennacl::matrix<NumericT, viennacl::column_major> AX = viennacl::linalg::prod(A, X);
+
+  std::vector< std::vector<NumericT> > cpu_X(n, std::vector<NumericT>(num_eig));
+  std::vector< std::vector<NumericT> > cpu_AX(n, std::vector<NumericT>(num_eig));
+  viennacl::copy(X, cpu_X);
+  viennacl::copy(AX, cpu_AX);
+
+  NumericT max_residual = 0;
+  for (std::size_t j = 0; j < num_eig; ++j)
+  {
+    NumericT norm_x = 0;
+    NumericT norm_residual = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      NumericT r = cpu_AX[i][j] - eigenvalues_2[j] * cpu_X[i][j];
+      norm_x += cpu_X[i][j] * cpu_X[i][j];
+      norm_residual += r * r;
+    }
+    norm_x = std::sqrt(norm_x);
+    norm_residual = std::sqrt(norm_residual);
+
+    if (std::fabs(norm_x - NumericT(1)) > epsilon)
+    {
+      std::cout << "# Error at operation: eig(A, X, tag), eigenvector " << j << " is not normalized: " << norm_x << std::endl;
+      return EXIT_FAILURE;
+    }
+    max_residual = std::max(max_residual, norm_residual / lambda_max);
+  }
+
+  if (max_residual > epsilon)
+  {
+    std::cout << "# Error at operation: eig(A, X, tag), relative residual ||A X - X Lambda|| = " << max_residual << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "  relative residual: " << max_residual << ", restarts: " << tag.iters() << std::endl;
+  return EXIT_SUCCESS;
+}
+
+
+template <typename NumericT>
+int test(NumericT epsilon, double lanczos_tolerance)
+{
+  //
+  // diagonal matrix with entries 1, 2, ..., n:
+  //
+  {
+    std::size_t n = 400;
+    std::vector< std::map<unsigned int, NumericT> > cpu_A(n);
+    std::vector<NumericT> exact_eigenvalues(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      cpu_A[i][static_cast<unsigned int>(i)] = NumericT(i + 1);
+      exact_eigenvalues[n - i - 1] = NumericT(i + 1);
+    }
+
+    viennacl::linalg::block_lanczos_tag tag(6, 3, 60, lanczos_tolerance, 200);
+    if (test_block_lanczos("diagonal matrix", cpu_A, exact_eigenvalues, tag, epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  //
+  // tridiagonal matrix of the 1D Laplace operator, eigenvalues 2 - 2 cos(k pi / (n+1)), k = 1, ..., n:
+  //
+  {
+    std::size_t n = 100;
+    std::vector< std::map<unsigned int, NumericT> > cpu_A(n);
+    std::vector<NumericT> exact_eigenvalues(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      cpu_A[i][static_cast<unsigned int>(i)] = NumericT(2);
+      if (i > 0)
+        cpu_A[i][static_cast<unsigned int>(i - 1)] = NumericT(-1);
+      if (i + 1 < n)
+        cpu_A[i][static_cast<unsigned int>(i + 1)] = NumericT(-1);
+
+      exact_eigenvalues[i] = NumericT(2.0 - 2.0 * std::cos(double(n - i) * 3.14159265358979323846 / double(n + 1)));
+    }
+
+    viennacl::linalg::block_lanczos_tag tag(4, 2, 40, lanczos_tolerance, 200);
+    if (test_block_lanczos("1D Laplace matrix", cpu_A, exact_eigenvalues, tag, epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Block Lanczos Eigensolver" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  int retval = EXIT_SUCCESS;
+
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+  {
+    typedef float NumericT;
+    NumericT epsilon = static_cast<NumericT>(1E-3);
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: float" << std::endl;
+    retval = test<NumericT>(epsilon, 1e-4);
+    if( retval == EXIT_SUCCESS )
+        std::cout << "# Test passed" << std::endl;
+    else
+        return retval;
+  }
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+#ifdef VIENNACL_WITH_OPENCL
+  if( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    typedef double NumericT;
+    NumericT epsilon = 1.0E-8;
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: double" << std::endl;
+    retval = test<NumericT>(epsilon, 1e-10);
+    if( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return retval;
+}
@@ -20,6 +20,7 @@
 // *** System
 //
 #include <iostream>
+#include <limits>
 
 //
 // *** Boost
@@ -44,6 +45,9 @@
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/linalg/direct_solve.hpp"
 #include "viennacl/linalg/lu.hpp"
+#include "viennacl/linalg/cholesky.hpp"
+#include "viennacl/linalg/qr.hpp"
+#include "viennacl/batched_matrix.hpp"
 #include "examples/tutorial/Random.hpp"
 
 //
@@ -339,6 +343,97 @@ int test_solve(Epsilon const & epsilon,
 }
 
 
+//
+// -------------------------------------------------------------
+//
+template <typename NumericT, typename F, typename Epsilon>
+int test_batched(Epsilon const & epsilon, std::size_t n, std::size_t batch_size, std::size_t stride)
+{
+   int retval = EXIT_SUCCESS;
+   std::size_t num_rhs = 3;
+
+   // diagonally weak matrices with a zero (1,1)-entry, so that pivoting is required:
+   std::vector<NumericT> A_host(batch_size * stride);
+   std::vector<NumericT> B_host(batch_size * n * num_rhs);
+   for (std::size_t b=0; b<batch_size; ++b)
+   {
+     for (std::size_t i=0; i<n; ++i)
+       for (std::size_t j=0; j<n; ++j)
+         A_host[b * stride + F::mem_index(i, j, n, n)] = (i == 0 && j == 0) ? 0 : random<NumericT>() - static_cast<NumericT>(0.5);
+     for (std::size_t i=0; i<n * num_rhs; ++i)
+       B_host[b * n * num_rhs + i] = random<NumericT>();
+   }
+
+   viennacl::batched_matrix<NumericT, F> vcl_A(batch_size, n, n, stride);
+   viennacl::batched_matrix<NumericT, F> vcl_B(batch_size, n, num_rhs);
+   viennacl::fast_copy(&(A_host[0]), &(A_host[0]) + A_host.size(), vcl_A);
+   viennacl::fast_copy(&(B_host[0]), &(B_host[0]) + B_host.size(), vcl_B);
+
+   // products:
+   viennacl::batched_matrix<NumericT, F> vcl_AA;
+   viennacl::batched_matrix<NumericT, F> vcl_AB;
+   vcl_AA = viennacl::linalg::prod(vcl_A, vcl_A);
+   vcl_AB = viennacl::linalg::prod(vcl_A, vcl_B);
+
+   // LU factorization with pivoting and substitution:
+   viennacl::batched_matrix<NumericT, F> vcl_LU(vcl_A);
+   viennacl::batched_matrix<NumericT, F> vcl_X(vcl_B);
+   std::vector<std::size_t> permutations;
+   viennacl::linalg::lu_factorize(vcl_LU, permutations);
+   viennacl::linalg::lu_substitute(vcl_LU, permutations, vcl_X);
+
+   // inverse and triangular solves with the upper triangle of A:
+   viennacl::batched_matrix<NumericT, F> vcl_A_inv;
+   viennacl::linalg::inverse(vcl_A, vcl_A_inv);
+   viennacl::batched_matrix<NumericT, F> vcl_T(vcl_B);
+   viennacl::linalg::inplace_solve(vcl_A, vcl_T, viennacl::linalg::unit_upper_tag());
+
+   std::vector<NumericT> AA_host(vcl_AA.internal_size()), AB_host(vcl_AB.internal_size()), X_host(vcl_X.internal_size()),
+                         A_inv_host(vcl_A_inv.internal_size()), T_host(vcl_T.internal_size());
+   viennacl::fast_copy(vcl_AA, &(AA_host[0]));
+   viennacl::fast_copy(vcl_AB, &(AB_host[0]));
+   viennacl::fast_copy(vcl_X, &(X_host[0]));
+   viennacl::fast_copy(vcl_A_inv, &(A_inv_host[0]));
+   viennacl::fast_copy(vcl_T, &(T_host[0]));
+
+   NumericT prod_error = 0, solve_residual = 0, inverse_error = 0, triangular_residual = 0;
+   for (std::size_t b=0; b<batch_size; ++b)
+   {
+     ublas::matrix<NumericT> A(n, n), B(n, num_rhs), AA(n, n), AB(n, num_rhs), X(n, num_rhs), A_inv(n, n), T(n, num_rhs), U(n, n);
+     for (std::size_t i=0; i<n; ++i)
+     {
+       for (std::size_t j=0; j<n; ++j)
+       {
+         A(i,j)     = A_host[b * stride + F::mem_index(i, j, n, n)];
+         AA(i,j)    = AA_host[b * n * n + F::mem_index(i, j, n, n)];
+         A_inv(i,j) = A_inv_host[b * n * n + F::mem_index(i, j, n, n)];
+         U(i,j)     = (i == j) ? 1 : ((i < j) ? A(i,j) : 0);
+       }
+       for (std::size_t j=0; j<num_rhs; ++j)
+       {
+         B(i,j)  = B_host[b * n * num_rhs + F::mem_index(i, j, n, num_rhs)];
+         AB(i,j) = AB_host[b * n * num_rhs + F::mem_index(i, j, n, num_rhs)];
+         X(i,j)  = X_host[b * n * num_rhs + F::mem_index(i, j, n, num_rhs)];
+         T(i,j)  = T_host[b * n * num_rhs + F::mem_index(i, j, n, num_rhs)];
+       }
+     }
+
+     prod_error = std::max(prod_error, norm_inf(ublas::matrix<NumericT>(ublas::prod(A, A) - AA)) / (norm_inf(A) * norm_inf(A)));
+     prod_error = std::max(prod_error, norm_inf(ublas::matrix<NumericT>(ublas::prod(A, B) - AB)) / (norm_inf(A) * norm_inf(B)));
+     solve_residual = std::max(solve_residual, norm_inf(ublas::matrix<NumericT>(ublas::prod(A, X) - B)) / (norm_inf(A) * norm_inf(X)));
+     inverse_error = std::max(inverse_error, norm_inf(ublas::matrix<NumericT>(ublas::prod(A_inv, A) - ublas::identity_matrix<NumericT>(n))) / (norm_inf(A) * norm_inf(A_inv)));
+     triangular_residual = std::max(triangular_residual, norm_inf(ublas::matrix<NumericT>(ublas::prod(U, T) - B)) / (norm_inf(U) * norm_inf(T)));
+   }
+
+   if ( prod_error > epsilon || solve_residual > epsilon || inverse_error > epsilon || triangular_residual > epsilon )
+   {
+      std::cout << "# Error at operation: batched matrices of size " << n << std::endl;
+      std::cout << "  errors: " << prod_error << ", " << solve_residual << ", " << inverse_error << ", " << triangular_residual << std::endl;
+      retval = EXIT_FAILURE;
+   }
+
+   return retval;
+}
 //
 // -------------------------------------------------------------
 //
@@ -981,6 +1076,187 @@ int test(Epsilon const& epsilon)
       std::cout << "  diff: " << fabs(diff(lu_rhs, vcl_lu_rhs)) << std::endl;
       retval = EXIT_FAILURE;
    }
+
+   //full solver with partial pivoting (zero diagonal, several block columns):
+   std::cout << "Full solver with pivoting" << std::endl;
+   unsigned int piv_dim = 300;
+   ublas::matrix<NumericT> piv_matrix(piv_dim, piv_dim);
+   ublas::matrix<NumericT> piv_rhs(piv_dim, 3);
+   ublas::vector<NumericT> piv_vec_rhs(piv_dim);
+   viennacl::matrix<NumericT, F> vcl_piv_matrix(piv_dim, piv_dim);
+   viennacl::matrix<NumericT, F> vcl_piv_rhs(piv_dim, 3);
+   viennacl::vector<NumericT> vcl_piv_vec_rhs(piv_dim);
+
+   for (std::size_t i=0; i<piv_dim; ++i)
+   {
+     for (std::size_t j=0; j<piv_dim; ++j)
+       piv_matrix(i,j) = (i == j) ? 0 : random<NumericT>() - static_cast<NumericT>(0.5);
+     for (std::size_t j=0; j<piv_rhs.size2(); ++j)
+       piv_rhs(i,j) = random<NumericT>();
+     piv_vec_rhs(i) = random<NumericT>();
+   }
+
+   viennacl::copy(piv_matrix, vcl_piv_matrix);
+   viennacl::copy(piv_rhs, vcl_piv_rhs);
+   viennacl::copy(piv_vec_rhs, vcl_piv_vec_rhs);
+
+   std::vector<std::size_t> permutation;
+   viennacl::linalg::lu_factorize(vcl_piv_matrix, permutation);
+   viennacl::linalg::lu_substitute(vcl_piv_matrix, permutation, vcl_piv_rhs);
+   viennacl::linalg::lu_substitute(vcl_piv_matrix, permutation, vcl_piv_vec_rhs);
+
+   // check backward errors |A x - b| / (|A| |x|) with the original matrix:
+   ublas::matrix<NumericT> piv_result(piv_dim, 3);
+   ublas::vector<NumericT> piv_vec_result(piv_dim);
+   viennacl::copy(vcl_piv_rhs, piv_result);
+   viennacl::copy(vcl_piv_vec_rhs, piv_vec_result);
+
+   NumericT piv_residual     = norm_inf(ublas::matrix<NumericT>(ublas::prod(piv_matrix, piv_result) - piv_rhs)) / (norm_inf(piv_matrix) * norm_inf(piv_result));
+   NumericT piv_vec_residual = norm_inf(ublas::vector<NumericT>(ublas::prod(piv_matrix, piv_vec_result) - piv_vec_rhs)) / (norm_inf(piv_matrix) * norm_inf(piv_vec_result));
+   if ( piv_residual > epsilon || piv_vec_residual > epsilon )
+   {
+      std::cout << "# Error at operation: dense solver with pivoting" << std::endl;
+      std::cout << "  residuals: " << piv_residual << ", " << piv_vec_residual << std::endl;
+      retval = EXIT_FAILURE;
+   }
+
+   //Cholesky solver for a symmetric positive definite matrix (full matrix and range):
+   std::cout << "Cholesky solver" << std::endl;
+   unsigned int spd_dim = 300;
+   ublas::matrix<NumericT> spd_factor(spd_dim, spd_dim);
+   for (std::size_t i=0; i<spd_dim; ++i)
+     for (std::size_t j=0; j<spd_dim; ++j)
+       spd_factor(i,j) = random<NumericT>() - static_cast<NumericT>(0.5);
+   ublas::matrix<NumericT> spd_matrix = ublas::prod(spd_factor, ublas::trans(spd_factor));
+   for (std::size_t i=0; i<spd_dim; ++i)
+     spd_matrix(i,i) += static_cast<NumericT>(1.0);
+
+   viennacl::matrix<NumericT, F> vcl_spd_matrix(spd_dim, spd_dim);
+   viennacl::matrix<NumericT, F> vcl_spd_big(spd_dim + 10, spd_dim + 20);
+   viennacl::matrix_range<viennacl::matrix<NumericT, F> > vcl_spd_range(vcl_spd_big, viennacl::range(10, spd_dim + 10), viennacl::range(20, spd_dim + 20));
+   viennacl::matrix<NumericT, F> vcl_spd_rhs(spd_dim, 3);
+   viennacl::vector<NumericT> vcl_spd_vec_rhs(spd_dim);
+
+   viennacl::copy(spd_matrix, vcl_spd_matrix);
+   viennacl::copy(spd_matrix, vcl_spd_range);
+   viennacl::copy(piv_rhs, vcl_spd_rhs);
+   viennacl::copy(piv_vec_rhs, vcl_spd_vec_rhs);
+
+   viennacl::linalg::cholesky_factorize(vcl_spd_matrix);
+   viennacl::linalg::cholesky_substitute(vcl_spd_matrix, vcl_spd_rhs);
+   viennacl::linalg::cholesky_factorize(vcl_spd_range);
+   viennacl::linalg::cholesky_substitute(vcl_spd_range, vcl_spd_vec_rhs);
+
+   viennacl::copy(vcl_spd_rhs, piv_result);
+   viennacl::copy(vcl_spd_vec_rhs, piv_vec_result);
+
+   NumericT spd_residual     = norm_inf(ublas::matrix<NumericT>(ublas::prod(spd_matrix, piv_result) - piv_rhs)) / (norm_inf(spd_matrix) * norm_inf(piv_result));
+   NumericT spd_vec_residual = norm_inf(ublas::vector<NumericT>(ublas::prod(spd_matrix, piv_vec_result) - piv_vec_rhs)) / (norm_inf(spd_matrix) * norm_inf(piv_vec_result));
+   if ( spd_residual > epsilon || spd_vec_residual > epsilon )
+   {
+      std::cout << "# Error at operation: Cholesky solver" << std::endl;
+      std::cout << "  residuals: " << spd_residual << ", " << spd_vec_residual << std::endl;
+      retval = EXIT_FAILURE;
+   }
+
+   // right hand sides in a matrix_range:
+   viennacl::matrix<NumericT, F> vcl_spd_rhs_big(spd_dim + 7, 3 + 5);
+   viennacl::matrix_range<viennacl::matrix<NumericT, F> > vcl_spd_rhs_range(vcl_spd_rhs_big, viennacl::range(7, spd_dim + 7), viennacl::range(5, 3 + 5));
+   viennacl::copy(piv_rhs, vcl_spd_rhs_range);
+   viennacl::linalg::cholesky_substitute(vcl_spd_range, vcl_spd_rhs_range);
+   viennacl::copy(vcl_spd_rhs_range, piv_result);
+
+   NumericT spd_range_residual = norm_inf(ublas::matrix<NumericT>(ublas::prod(spd_matrix, piv_result) - piv_rhs)) / (norm_inf(spd_matrix) * norm_inf(piv_result));
+   if ( spd_range_residual > epsilon )
+   {
+      std::cout << "# Error at operation: Cholesky solver with matrix_range right hand sides" << std::endl;
+      std::cout << "  residual: " << spd_range_residual << std::endl;
+      retval = EXIT_FAILURE;
+   }
+
+   // matrices which are not positive definite (indefinite or containing NaN) must be rejected:
+   for (std::size_t k=0; k<2; ++k)
+   {
+     ublas::matrix<NumericT> non_spd_matrix(spd_matrix);
+     if (k == 0)
+       non_spd_matrix(spd_dim / 2, spd_dim / 2) = -non_spd_matrix(spd_dim / 2, spd_dim / 2);
+     else
+       non_spd_matrix(spd_dim / 2, spd_dim / 2) = std::numeric_limits<NumericT>::quiet_NaN();
+
+     viennacl::matrix<NumericT, F> vcl_non_spd_matrix(spd_dim, spd_dim);
+     viennacl::copy(non_spd_matrix, vcl_non_spd_matrix);
+
+     bool rejected = false;
+     try
+     {
+       viennacl::linalg::cholesky_factorize(vcl_non_spd_matrix);
+     }
+     catch (const char *)
+     {
+       rejected = true;
+     }
+     if (!rejected)
+     {
+       std::cout << "# Error at operation: Cholesky factorization of a matrix which is not positive definite" << std::endl;
+       retval = EXIT_FAILURE;
+     }
+   }
+
+   //least-squares solver based on the QR factorization: the residual A x - b must be orthogonal to the columns of A
+   std::cout << "Least-squares solver (QR)" << std::endl;
+   unsigned int ls_rows = 250;
+   unsigned int ls_cols = 170;
+   ublas::matrix<NumericT> ls_matrix(ls_rows, ls_cols);
+   ublas::vector<NumericT> ls_rhs(ls_rows);
+   for (std::size_t i=0; i<ls_rows; ++i)
+   {
+     for (std::size_t j=0; j<ls_cols; ++j)
+       ls_matrix(i,j) = random<NumericT>() - static_cast<NumericT>(0.5);
+     ls_rhs(i) = random<NumericT>();
+   }
+
+   viennacl::matrix<NumericT, F> vcl_ls_matrix(ls_rows, ls_cols);
+   viennacl::vector<NumericT> vcl_ls_rhs(ls_rows);
+   viennacl::copy(ls_matrix, vcl_ls_matrix);
+   viennacl::copy(ls_rhs, vcl_ls_rhs);
+
+   std::vector<NumericT> ls_betas = viennacl::linalg::inplace_qr(vcl_ls_matrix);
+   viennacl::linalg::inplace_qr_apply_trans_Q(vcl_ls_matrix, ls_betas, vcl_ls_rhs);
+
+   viennacl::matrix<NumericT, F> vcl_ls_Q(ls_rows, ls_rows);
+   viennacl::matrix<NumericT, F> vcl_ls_R(ls_rows, ls_cols);
+   viennacl::linalg::recoverQ(vcl_ls_matrix, ls_betas, vcl_ls_Q, vcl_ls_R);
+
+   // x = R^{-1} (Q^T b)(0:n):
+   ublas::matrix<NumericT> ls_R(ls_rows, ls_cols);
+   ublas::vector<NumericT> ls_QTb(ls_rows);
+   viennacl::copy(vcl_ls_R, ls_R);
+   viennacl::copy(vcl_ls_rhs, ls_QTb);
+   ublas::matrix<NumericT> ls_R_square = ublas::project(ls_R, ublas::range(0, ls_cols), ublas::range(0, ls_cols));
+   ublas::vector<NumericT> ls_x = ublas::project(ls_QTb, ublas::range(0, ls_cols));
+   ublas::inplace_solve(ls_R_square, ls_x, ublas::upper_tag());
+
+   ublas::vector<NumericT> ls_residual = ublas::prod(ls_matrix, ls_x) - ls_rhs;
+   NumericT ls_orthogonality = norm_inf(ublas::vector<NumericT>(ublas::prod(ublas::trans(ls_matrix), ls_residual))) / (norm_inf(ls_matrix) * norm_inf(ls_rhs));
+
+   // Q R must reproduce A:
+   ublas::matrix<NumericT> ls_Q(ls_rows, ls_rows);
+   viennacl::copy(vcl_ls_Q, ls_Q);
+   NumericT ls_QR_error = norm_inf(ublas::matrix<NumericT>(ublas::prod(ls_Q, ls_R) - ls_matrix)) / norm_inf(ls_matrix);
+
+   if ( ls_orthogonality > epsilon || ls_QR_error > epsilon )
+   {
+      std::cout << "# Error at operation: least-squares solver" << std::endl;
+      std::cout << "  errors: " << ls_orthogonality << ", " << ls_QR_error << std::endl;
+      retval = EXIT_FAILURE;
+   }
+
+   //batches of small matrices (compile-time size and run-time size with padding between the matrices):
+   std::cout << "Batched small matrices" << std::endl;
+   if (test_batched<NumericT, F>(epsilon, 4, 500, 16) == EXIT_FAILURE)
+     retval = EXIT_FAILURE;
+   if (test_batched<NumericT, F>(epsilon, 7, 300, 53) == EXIT_FAILURE)
+     retval = EXIT_FAILURE;
    
    
 
@@ -38,6 +38,8 @@
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/io/matrix_market.hpp"*/
 #include "viennacl/matrix_proxy.hpp"
+#include "viennacl/io/matrix_market.hpp"
+#include "viennacl/io/binary.hpp"
 #include "viennacl/vector_proxy.hpp"
 #include "boost/numeric/ublas/vector.hpp"
 #include "boost/numeric/ublas/matrix.hpp"
@@ -891,6 +893,140 @@ int run_test(double epsilon)
     return EXIT_SUCCESS;
 }
 
+//
+// Reads a small matrix in MatrixMarket 'array' format into a viennacl::matrix, writes it and reads it again:
+//
+template <typename T, typename ScalarType>
+int run_matrix_market_test(double epsilon)
+{
+  typedef boost::numeric::ublas::matrix<ScalarType>       MatrixType;
+  typedef viennacl::matrix<ScalarType, T>                 VCLMatrixType;
+
+  const char * array_file = "matrix-test-array.mtx";
+  const char * symmetric_file = "matrix-test-array-symmetric.mtx";
+  const char * written_file = "matrix-test-array-written.mtx";
+
+  {
+    std::ofstream writer(array_file);
+    writer << "%%MatrixMarket matrix array real general" << std::endl;
+    writer << "% entries are listed column by column" << std::endl;
+    writer << "3 2" << std::endl;
+    writer << "1.5\n2.25\n3\n4e-1\n0\n6.125" << std::endl;
+  }
+  {
+    std::ofstream writer(symmetric_file);
+    writer << "%%MatrixMarket matrix array real symmetric" << std::endl;
+    writer << "3 3" << std::endl;
+    writer << "1\n2\n3\n4\n5\n6" << std::endl;  //lower triangle, column by column
+  }
+
+  MatrixType ublas_A(3, 2);
+  ublas_A(0,0) = ScalarType(1.5);  ublas_A(0,1) = ScalarType(0.4);
+  ublas_A(1,0) = ScalarType(2.25); ublas_A(1,1) = ScalarType(0);
+  ublas_A(2,0) = ScalarType(3);    ublas_A(2,1) = ScalarType(6.125);
+
+  MatrixType ublas_S(3, 3);
+  ublas_S(0,0) = 1; ublas_S(0,1) = 2; ublas_S(0,2) = 3;
+  ublas_S(1,0) = 2; ublas_S(1,1) = 4; ublas_S(1,2) = 5;
+  ublas_S(2,0) = 3; ublas_S(2,1) = 5; ublas_S(2,2) = 6;
+
+  std::cout << "Testing MatrixMarket reader, array format... ";
+  VCLMatrixType vcl_A;
+  if (!viennacl::io::read_matrix_market_file(vcl_A, array_file)
+      || vcl_A.size1() != 3 || vcl_A.size2() != 2 || !check_for_equality(ublas_A, vcl_A, epsilon))
+  {
+    std::cout << "# Error at operation: read_matrix_market_file() for array format" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Testing MatrixMarket reader, symmetric array format... ";
+  VCLMatrixType vcl_S;
+  if (!viennacl::io::read_matrix_market_file(vcl_S, symmetric_file)
+      || vcl_S.size1() != 3 || vcl_S.size2() != 3 || !check_for_equality(ublas_S, vcl_S, epsilon))
+  {
+    std::cout << "# Error at operation: read_matrix_market_file() for symmetric array format" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Testing MatrixMarket writer, array format... ";
+  VCLMatrixType vcl_B;
+  viennacl::io::write_matrix_market_file(vcl_A, written_file);
+  if (!viennacl::io::read_matrix_market_file(vcl_B, written_file)
+      || vcl_B.size1() != 3 || vcl_B.size2() != 2 || !check_for_equality(ublas_A, vcl_B, epsilon))
+  {
+    std::cout << "# Error at operation: write_matrix_market_file() for array format" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::remove(array_file);
+  std::remove(symmetric_file);
+  std::remove(written_file);
+
+  return EXIT_SUCCESS;
+}
+
+//
+// Saves a matrix in the binary format and loads it into matrices of both storage layouts:
+//
+template <typename T, typename ScalarType>
+int run_binary_io_test(double epsilon)
+{
+  typedef boost::numeric::ublas::matrix<ScalarType>       MatrixType;
+
+  const char * filename = "matrix-test.vclbin";
+
+  MatrixType ublas_A(37, 19);
+  for (std::size_t i=0; i<ublas_A.size1(); ++i)
+    for (std::size_t j=0; j<ublas_A.size2(); ++j)
+      ublas_A(i,j) = ScalarType(i * ublas_A.size2() + j + 1);
+
+  viennacl::matrix<ScalarType, T> vcl_A(ublas_A.size1(), ublas_A.size2());
+  viennacl::copy(ublas_A, vcl_A);
+
+  std::cout << "Testing binary save... ";
+  if (!viennacl::io::save(vcl_A, filename))
+  {
+    std::cout << "# Error at operation: binary save of matrix" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "PASSED!" << std::endl;
+
+  std::cout << "Testing binary load, row-major (memory mapped)... ";
+  viennacl::matrix<ScalarType, viennacl::row_major> vcl_row;
+  if (!viennacl::io::load(vcl_row, filename) || vcl_row.size1() != ublas_A.size1() || vcl_row.size2() != ublas_A.size2() || !check_for_equality(ublas_A, vcl_row, epsilon))
+  {
+    std::cout << "# Error at operation: binary load into row-major matrix" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Testing binary load, column-major (buffered read)... ";
+  viennacl::matrix<ScalarType, viennacl::column_major> vcl_col;
+  if (!viennacl::io::load(vcl_col, filename, false) || vcl_col.size1() != ublas_A.size1() || vcl_col.size2() != ublas_A.size2() || !check_for_equality(ublas_A, vcl_col, epsilon))
+  {
+    std::cout << "# Error at operation: binary load into column-major matrix" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the loaded matrices must be usable in computations:
+  std::cout << "Testing addition of loaded matrices... ";
+  MatrixType ublas_B = ublas_A + ublas_A;
+  viennacl::matrix<ScalarType, T> vcl_B;
+  if (!viennacl::io::load(vcl_B, filename))
+  {
+    std::cout << "# Error at operation: binary load of matrix" << std::endl;
+    return EXIT_FAILURE;
+  }
+  vcl_B += vcl_A;
+  if (!check_for_equality(ublas_B, vcl_B, epsilon))
+  {
+    std::cout << "# Error at operation: addition of loaded matrix" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::remove(filename);
+  return EXIT_SUCCESS;
+}
+
 int main (int, const char **)
 {
   std::cout << std::endl;
@@ -909,6 +1045,14 @@ int main (int, const char **)
     return EXIT_FAILURE;
   if (run_test<viennacl::column_major, float>(epsilon) != EXIT_SUCCESS)
     return EXIT_FAILURE;
+  if (run_matrix_market_test<viennacl::row_major, float>(epsilon) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  if (run_matrix_market_test<viennacl::column_major, float>(epsilon) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  if (run_binary_io_test<viennacl::row_major, float>(epsilon) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  if (run_binary_io_test<viennacl::column_major, float>(epsilon) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
   
   
 #ifdef VIENNACL_WITH_OPENCL   
@@ -924,6 +1068,14 @@ int main (int, const char **)
       return EXIT_FAILURE;
     if (run_test<viennacl::column_major, double>(epsilon) != EXIT_SUCCESS)
       return EXIT_FAILURE;
+    if (run_matrix_market_test<viennacl::row_major, double>(epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    if (run_matrix_market_test<viennacl::column_major, double>(epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    if (run_binary_io_test<viennacl::row_major, double>(epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    if (run_binary_io_test<viennacl::column_major, double>(epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
   }
 
    std::cout << std::endl;
@@ -54,7 +54,12 @@ void fill_random(std::vector<ScalarType>& v)
 }
 
 
-void test_nmf(std::size_t m, std::size_t k, std::size_t n)
+/** @brief Runs NMF with the configuration 'conf' on V = W * H for random nonnegative W and H.
+*
+* Checks that the product of the computed factors matches V up to a relative error of 'tolerance' and that at most 'max_iterations' iterations were needed.
+*/
+void test_nmf(std::size_t m, std::size_t k, std::size_t n,
+              viennacl::linalg::nmf_config conf, ScalarType tolerance, std::size_t max_iterations)
 {
     std::vector<ScalarType> stl_w(m * k);
     std::vector<ScalarType> stl_h(k * n);
@@ -83,18 +88,18 @@ void test_nmf(std::size_t m, std::size_t k, std::size_t n)
     
     
 
-    viennacl::linalg::nmf_config conf;
     viennacl::linalg::nmf(v_ref, w_nmf, h_nmf, conf);
 
     viennacl::matrix<ScalarType> v_nmf = viennacl::linalg::prod(w_nmf, h_nmf);
 
     float diff  = matrix_compare(v_ref, v_nmf);
-    bool diff_ok = fabs(diff) < EPS;
+    bool diff_ok = fabs(diff) < tolerance;
+    bool iters_ok = conf.iters() <= max_iterations;
 
     long iterations = static_cast<long>(conf.iters());
-    printf("%6s [%lux%lux%lu] diff = %.6f (%ld iterations)\n", diff_ok ? "[[OK]]":"[FAIL]", m, k, n, diff, iterations);
+    printf("%6s [%lux%lux%lu] diff = %.8f (%ld iterations, tolerance %g)\n", (diff_ok && iters_ok) ? "[[OK]]":"[FAIL]", m, k, n, diff, iterations, conf.tolerance());
     
-    if (!diff_ok)
+    if (!diff_ok || !iters_ok)
       exit(EXIT_FAILURE);
 }
 
@@ -102,11 +107,18 @@ int main()
 {
   //srand(time(NULL));  //let's use deterministic tests, so keep the default srand() initialization
 
-  test_nmf(3, 3, 3);
-  test_nmf(3, 2, 3);
-  test_nmf(16, 7, 12);
-  test_nmf(160, 73, 200);
-  test_nmf(1000, 15, 1000);
+  viennacl::linalg::nmf_config conf;
+  test_nmf(3, 3, 3, conf, EPS, conf.max_iterations());
+  test_nmf(3, 2, 3, conf, EPS, conf.max_iterations());
+  test_nmf(16, 7, 12, conf, EPS, conf.max_iterations());
+  test_nmf(160, 73, 200, conf, EPS, conf.max_iterations());
+  test_nmf(1000, 15, 1000, conf, EPS, conf.max_iterations());
+
+  // The residual from the trace identity is only accurate to about sqrt(epsilon) ||V||. With a tolerance below that,
+  // the iteration must neither stop at a noisy (or zero) residual before W * H reaches the working precision,
+  // nor keep iterating until max_iterations() once it has:
+  viennacl::linalg::nmf_config tight_conf(1e-10, 1e-5, 20000, 10);
+  test_nmf(16, 7, 12, tight_conf, ScalarType(1e-5), tight_conf.max_iterations() - 1);
 
   std::cout << std::endl;
   std::cout << "------- Test completed --------" << std::endl;
@@ -30,6 +30,7 @@ M=fscanfMat('nsm1.example');e=spec(M);e=gsort(e);rr=real(e);ii=imag(e);e=cat(1,
 #include <fstream>
 #include <stdexcept>
 #include <vector>
+#include <limits>
 
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/qr-method.hpp"
@@ -156,7 +157,7 @@ ScalarType vector_compare(ublas::vector<ScalarType>& res,
     return diff / mx;
 }
 
-void test_eigen(const std::string& fn, bool is_symm) 
+bool test_eigen(const std::string& fn, bool is_symm) 
 {
     std::cout << "Reading..." << "\n";
     std::size_t sz;
@@ -190,7 +191,7 @@ void test_eigen(const std::string& fn, bool is_symm)
         viennacl::linalg::qr_method_nsm(A_input, Q, eigen_re, eigen_im);
 
     // std::cout << A_input << "\n";
-    viennacl::ocl::get_queue().finish();
+    viennacl::backend::finish();
 
     double time_spend = timer.get();
 
@@ -216,7 +217,11 @@ void test_eigen(const std::string& fn, bool is_symm)
         is_ok = is_ok && is_tridiag;
 
     is_ok = is_ok && (eigen_diff < EPS);
-    is_ok = is_ok && (prods_diff < EPS);
+    // the residual of the host solver for symmetric matrices grows with n times the machine precision:
+    ScalarType prods_tolerance = EPS;
+    if (is_symm)
+      prods_tolerance = std::max<ScalarType>(EPS, static_cast<ScalarType>(sz) * std::numeric_limits<ScalarType>::epsilon());
+    is_ok = is_ok && (prods_diff < prods_tolerance);
     
     // std::cout << A_ref << "\n";
     // std::cout << A_input << "\n";
@@ -233,18 +238,33 @@ void test_eigen(const std::string& fn, bool is_symm)
 
     printf("%6s [%dx%d] %40s time = %.4f\n", is_ok?"[[OK]]":"[FAIL]", (int)A_ref.size1(), (int)A_ref.size2(), fn.c_str(), time_spend);
     printf("tridiagonal = %d, hessenberg = %d prod-diff = %f eigen-diff = %f\n", is_tridiag, is_hessenberg, prods_diff, eigen_diff);
+
+    return is_ok;
 }
 
 int main()
 {
+  bool ok = true;
+
+#ifndef VIENNACL_WITH_OPENCL   // the symmetric solver is tested for the host backend only
+  ok = test_eigen("../../examples/testdata/eigen/symm1.example", true) && ok;
+  ok = test_eigen("../../examples/testdata/eigen/symm2.example", true) && ok;
+  ok = test_eigen("../../examples/testdata/eigen/symm3.example", true) && ok;
+#else
   // test_eigen("../../examples/testdata/eigen/symm1.example", true);
   // test_eigen("../../examples/testdata/eigen/symm2.example", true);
   // test_eigen("../../examples/testdata/eigen/symm3.example", true);
+#endif
 
+#ifdef VIENNACL_WITH_OPENCL   // nonsymmetric matrices are not supported by the host backend
   test_eigen("../../examples/testdata/eigen/nsm1.example", false);
   test_eigen("../../examples/testdata/eigen/nsm2.example", false);
   test_eigen("../../examples/testdata/eigen/nsm3.example", false);
   test_eigen("../../examples/testdata/eigen/nsm4.example", false);
+#endif
+
+  if (!ok)
+    return EXIT_FAILURE;
 
   std::cout << std::endl;
   std::cout << "------- Test completed --------" << std::endl;
@@ -23,6 +23,9 @@
 // *** System
 //
 #include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <map>
 
 //
 // *** Boost
@@ -43,6 +46,8 @@
 #define VIENNACL_WITH_UBLAS 1
 #include "viennacl/scalar.hpp"
 #include "viennacl/compressed_matrix.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
 #include "viennacl/coordinate_matrix.hpp"
 #include "viennacl/ell_matrix.hpp"
 #include "viennacl/hyb_matrix.hpp"
@@ -52,6 +57,8 @@
 #include "viennacl/linalg/ilu.hpp"
 #include "viennacl/linalg/detail/ilu/common.hpp"
 #include "viennacl/io/matrix_market.hpp"
+#include "viennacl/io/binary.hpp"
+#include "viennacl/out_of_core_compressed_matrix.hpp"
 #include "examples/tutorial/Random.hpp"
 #include "examples/tutorial/vector-io.hpp"
 
@@ -165,6 +172,170 @@ ScalarType diff(ublas::compressed_matrix<ScalarType> & cpu_matrix, VCL_MATRIX &
 }
 
 
+template <typename VCL_MATRIX, typename ScalarType>
+bool binary_io_roundtrip(VCL_MATRIX const & vcl_matrix, viennacl::vector<ScalarType> & vcl_rhs, ublas::vector<ScalarType> & result, ScalarType epsilon)
+{
+  VCL_MATRIX vcl_loaded_matrix;
+  if (!viennacl::io::save(vcl_matrix, "sparse-test.vclbin") || !viennacl::io::load(vcl_loaded_matrix, "sparse-test.vclbin"))
+    return false;
+
+  viennacl::vector<ScalarType> vcl_result = viennacl::linalg::prod(vcl_loaded_matrix, vcl_rhs);
+  std::remove("sparse-test.vclbin");
+  return std::fabs(diff(result, vcl_result)) <= epsilon;
+}
+
+
+template <typename ScalarType>
+bool out_of_core_test(ublas::compressed_matrix<ScalarType> & ublas_matrix, viennacl::vector<ScalarType> & vcl_rhs, ublas::vector<ScalarType> & result, ScalarType epsilon)
+{
+  {
+    viennacl::io::compressed_matrix_writer<ScalarType> writer("sparse-test-ooc.vclbin", ublas_matrix.size1(), ublas_matrix.size2(), ublas_matrix.nnz());
+    std::vector<unsigned int> cols;
+    std::vector<ScalarType> entries;
+    for (typename ublas::compressed_matrix<ScalarType>::const_iterator1 row_it = ublas_matrix.begin1(); row_it != ublas_matrix.end1(); ++row_it)
+    {
+      cols.clear();
+      entries.clear();
+      for (typename ublas::compressed_matrix<ScalarType>::const_iterator2 col_it = row_it.begin(); col_it != row_it.end(); ++col_it)
+      {
+        cols.push_back(static_cast<unsigned int>(col_it.index2()));
+        entries.push_back(*col_it);
+      }
+      writer.add_row(cols.size(), cols.size() > 0 ? &(cols[0]) : NULL, entries.size() > 0 ? &(entries[0]) : NULL);
+    }
+    if (!writer.close())
+      return false;
+  }
+
+  viennacl::out_of_core_compressed_matrix<ScalarType> vcl_matrix("sparse-test-ooc.vclbin", 64 * 1024);  //small blocks to test streaming
+  viennacl::vector<ScalarType> vcl_result = viennacl::linalg::prod(vcl_matrix, vcl_rhs);
+  bool success = (vcl_matrix.blocks() > 1) && (vcl_matrix.statistics().products == 1) && (std::fabs(diff(result, vcl_result)) <= epsilon);
+
+  vcl_result -= viennacl::linalg::prod(vcl_matrix, vcl_rhs);
+  success = success && (viennacl::linalg::norm_2(vcl_result) <= epsilon);
+
+  std::remove("sparse-test-ooc.vclbin");
+  return success;
+}
+
+
+/** @brief Writes 'contents' to a MatrixMarket file, reads it into a compressed_matrix and compares with the expected entries */
+template <typename ScalarType>
+bool matrix_market_fixture(std::string const & name, const char * contents,
+                           std::size_t rows, std::size_t cols,
+                           std::vector< std::map<unsigned int, ScalarType> > const & expected, ScalarType epsilon)
+{
+  {
+    std::ofstream writer("sparse-test.mtx");
+    writer << contents;
+  }
+
+  viennacl::compressed_matrix<ScalarType> vcl_matrix;
+  long lines_read = viennacl::io::read_matrix_market_file(vcl_matrix, "sparse-test.mtx");
+  std::remove("sparse-test.mtx");
+
+  std::size_t expected_nnz = 0;
+  for (std::size_t i=0; i<expected.size(); ++i)
+    expected_nnz += expected[i].size();
+
+  bool success = (lines_read > 0) && (vcl_matrix.size1() == rows) && (vcl_matrix.size2() == cols) && (vcl_matrix.nnz() == expected_nnz);
+  if (success)
+  {
+    std::vector< std::map<unsigned int, ScalarType> > cpu_matrix(rows);
+    viennacl::copy(vcl_matrix, cpu_matrix);
+    for (std::size_t i=0; i<rows; ++i)
+    {
+      success = success && (cpu_matrix[i].size() == expected[i].size());
+      for (typename std::map<unsigned int, ScalarType>::const_iterator it = expected[i].begin(); it != expected[i].end(); ++it)
+        success = success && (cpu_matrix[i].count(it->first) == 1) && (std::fabs(cpu_matrix[i][it->first] - it->second) <= epsilon * std::fabs(it->second));
+    }
+  }
+
+  if (!success)
+    std::cout << "# Error at operation: reading MatrixMarket file (" << name << ")" << std::endl;
+  return success;
+}
+
+/** @brief Reads small MatrixMarket files covering duplicate entries, symmetric storage and pattern files */
+template <typename ScalarType>
+int matrix_market_fixture_test(ScalarType epsilon)
+{
+  int retval = EXIT_SUCCESS;
+
+  // general matrix with comments and duplicate entries (which are summed up):
+  {
+    const char * contents = "%%MatrixMarket matrix coordinate real general\n"
+                            "% duplicate entries are summed up\n"
+                            "3 4 6\n"
+                            "1 1 1.5\n"
+                            "2 3 -2\n"
+                            "1 1 0.5\n"
+                            "3 4 4e-1\n"
+                            "2 3 1\n"
+                            "3 1 7\n";
+    std::vector< std::map<unsigned int, ScalarType> > expected(3);
+    expected[0][0] = ScalarType(2);
+    expected[1][2] = ScalarType(-1);
+    expected[2][0] = ScalarType(7);
+    expected[2][3] = ScalarType(0.4);
+    if (!matrix_market_fixture("general, duplicates", contents, 3, 4, expected, epsilon))
+      retval = EXIT_FAILURE;
+  }
+
+  // symmetric matrix, only the lower triangle is stored:
+  {
+    const char * contents = "%%MatrixMarket matrix coordinate real symmetric\n"
+                            "3 3 4\n"
+                            "1 1 4\n"
+                            "2 1 -1\n"
+                            "3 2 -1.5\n"
+                            "3 3 2\n";
+    std::vector< std::map<unsigned int, ScalarType> > expected(3);
+    expected[0][0] = ScalarType(4);
+    expected[0][1] = ScalarType(-1);
+    expected[1][0] = ScalarType(-1);
+    expected[1][2] = ScalarType(-1.5);
+    expected[2][1] = ScalarType(-1.5);
+    expected[2][2] = ScalarType(2);
+    if (!matrix_market_fixture("symmetric", contents, 3, 3, expected, epsilon))
+      retval = EXIT_FAILURE;
+  }
+
+  // pattern matrix, all entries are one:
+  {
+    const char * contents = "%%MatrixMarket matrix coordinate pattern general\n"
+                            "2 3 3\n"
+                            "1 2\n"
+                            "2 1\n"
+                            "2 3\n";
+    std::vector< std::map<unsigned int, ScalarType> > expected(2);
+    expected[0][1] = ScalarType(1);
+    expected[1][0] = ScalarType(1);
+    expected[1][2] = ScalarType(1);
+    if (!matrix_market_fixture("pattern", contents, 2, 3, expected, epsilon))
+      retval = EXIT_FAILURE;
+  }
+
+  // symmetric pattern matrix:
+  {
+    const char * contents = "%%MatrixMarket matrix coordinate pattern symmetric\n"
+                            "3 3 3\n"
+                            "1 1\n"
+                            "3 1\n"
+                            "2 2\n";
+    std::vector< std::map<unsigned int, ScalarType> > expected(3);
+    expected[0][0] = ScalarType(1);
+    expected[0][2] = ScalarType(1);
+    expected[1][1] = ScalarType(1);
+    expected[2][0] = ScalarType(1);
+    if (!matrix_market_fixture("symmetric pattern", contents, 3, 3, expected, epsilon))
+      retval = EXIT_FAILURE;
+  }
+
+  return retval;
+}
+
+
 template< typename NumericT, typename VCL_MATRIX, typename Epsilon >
 int resize_test(Epsilon const& epsilon)
 {
@@ -349,13 +520,63 @@ int test(Epsilon const& epsilon)
   ublas::vector<NumericT> result;
   ublas::compressed_matrix<NumericT> ublas_matrix;
 
-  if (!viennacl::io::read_matrix_market_file(ublas_matrix, "../../examples/testdata/mat65k.mtx"))
+  std::string matrix_file = "../../examples/testdata/mat65k.mtx";
+  if (!viennacl::io::read_matrix_market_file(ublas_matrix, matrix_file))
   {
-    std::cout << "Error reading Matrix file" << std::endl;
-    return EXIT_FAILURE;
+    // test matrix not available, use the 5-point stencil on a 255x255 grid (65025 unknowns) instead:
+    std::cout << "Matrix file not available, using 2D Laplace matrix instead" << std::endl;
+    std::size_t m = 255;
+    ublas_matrix.resize(m * m, m * m, false);
+    for (std::size_t i=0; i<m; ++i)
+      for (std::size_t j=0; j<m; ++j)
+      {
+        std::size_t row = i * m + j;
+        if (i > 0)     ublas_matrix(row, row - m) = NumericT(-1);
+        if (j > 0)     ublas_matrix(row, row - 1) = NumericT(-1);
+                       ublas_matrix(row, row)     = NumericT(4);
+        if (j + 1 < m) ublas_matrix(row, row + 1) = NumericT(-1);
+        if (i + 1 < m) ublas_matrix(row, row + m) = NumericT(-1);
+      }
+
+    matrix_file = "sparse-test-laplace.mtx";
+    viennacl::io::write_matrix_market_file(ublas_matrix, matrix_file);
   }
   //unsigned int cg_mat_size = cg_mat.size(); 
   std::cout << "done reading matrix" << std::endl;
+
+  std::cout << "Testing reading of compressed_matrix from file..." << std::endl;
+  if (matrix_market_fixture_test<NumericT>(epsilon) != EXIT_SUCCESS)
+    retval = EXIT_FAILURE;
+  {
+    viennacl::compressed_matrix<NumericT> vcl_file_matrix;
+    long lines_read = viennacl::io::read_matrix_market_file(vcl_file_matrix, matrix_file);
+    if (matrix_file == "sparse-test-laplace.mtx")
+      std::remove("sparse-test-laplace.mtx");
+    if (!lines_read)
+    {
+      std::cout << "Error reading Matrix file into compressed_matrix" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    ublas::compressed_matrix<NumericT> ublas_file_matrix(vcl_file_matrix.size1(), vcl_file_matrix.size2());
+    viennacl::copy(vcl_file_matrix, ublas_file_matrix);
+
+    NumericT max_diff = 0;
+    for (typename ublas::compressed_matrix<NumericT>::const_iterator1 row_it = ublas_matrix.begin1(); row_it != ublas_matrix.end1(); ++row_it)
+      for (typename ublas::compressed_matrix<NumericT>::const_iterator2 col_it = row_it.begin(); col_it != row_it.end(); ++col_it)
+      {
+        NumericT entry = ublas_file_matrix(col_it.index1(), col_it.index2());
+        if (*col_it != entry)
+          max_diff = std::max<NumericT>(max_diff, std::fabs(*col_it - entry) / std::max(std::fabs(*col_it), std::fabs(entry)));
+      }
+
+    if (vcl_file_matrix.size1() != ublas_matrix.size1() || vcl_file_matrix.nnz() != ublas_matrix.nnz() || max_diff > epsilon)
+    {
+      std::cout << "# Error at operation: reading compressed_matrix from file" << std::endl;
+      std::cout << "  nonzeros: " << vcl_file_matrix.nnz() << " vs. " << ublas_matrix.nnz() << ", diff: " << max_diff << std::endl;
+      retval = EXIT_FAILURE;
+    }
+  }
   
 
   rhs.resize(ublas_matrix.size2());
@@ -393,7 +614,72 @@ int test(Epsilon const& epsilon)
     std::cout << "  diff: " << std::fabs(diff(result, vcl_result)) << std::endl;
     retval = EXIT_FAILURE;
   }
-  
+
+  std::cout << "Testing products: compressed_matrix with dense matrix" << std::endl;
+  ublas::matrix<NumericT> ublas_dense(rhs.size(), 5);
+  for (std::size_t i=0; i<ublas_dense.size1(); ++i)
+    for (std::size_t j=0; j<ublas_dense.size2(); ++j)
+      ublas_dense(i,j) = NumericT(1) + random<NumericT>();
+  ublas::matrix<NumericT> ublas_dense_result = ublas::prod(ublas_matrix, ublas_dense);
+
+  viennacl::matrix<NumericT> vcl_dense(ublas_dense.size1(), ublas_dense.size2());
+  viennacl::matrix<NumericT, viennacl::column_major> vcl_dense_trans(ublas_dense.size2(), ublas_dense.size1());
+  viennacl::matrix<NumericT> vcl_dense_result(ublas_dense.size1(), ublas_dense.size2());
+  viennacl::copy(ublas_dense, vcl_dense);
+  viennacl::copy(ublas::matrix<NumericT>(ublas::trans(ublas_dense)), vcl_dense_trans);
+
+  // strided operands for the fallback without unit-stride rows: a slice of a row-major matrix and a column-major matrix
+  viennacl::matrix<NumericT> vcl_dense_big(ublas_dense.size1(), 2 * ublas_dense.size2());
+  viennacl::slice dense_columns(1, 2, ublas_dense.size2());
+  viennacl::matrix_slice<viennacl::matrix<NumericT> > vcl_dense_slice(vcl_dense_big, viennacl::slice(0, 1, ublas_dense.size1()), dense_columns);
+  vcl_dense_slice = vcl_dense;
+  viennacl::matrix<NumericT, viennacl::column_major> vcl_dense_col(ublas_dense.size1(), ublas_dense.size2());
+  viennacl::copy(ublas_dense, vcl_dense_col);
+
+  for (std::size_t pass=0; pass<5; ++pass)
+  {
+    if (pass == 0)
+      vcl_dense_result = viennacl::linalg::prod(vcl_compressed_matrix, vcl_dense);
+    else if (pass == 1)
+      vcl_dense_result = viennacl::linalg::prod(vcl_compressed_matrix, trans(vcl_dense_trans));
+    else if (pass == 2)
+      vcl_dense_result = viennacl::linalg::prod(vcl_compressed_matrix, vcl_dense_slice);
+    else if (pass == 3)
+      vcl_dense_result = viennacl::linalg::prod(vcl_compressed_matrix, vcl_dense_col);
+    else
+    {
+      // result and dense operand are the same object:
+      vcl_dense_result = vcl_dense;
+      vcl_dense_result = viennacl::linalg::prod(vcl_compressed_matrix, vcl_dense_result);
+    }
+
+    ublas::matrix<NumericT> vcl_dense_result_cpu(ublas_dense.size1(), ublas_dense.size2());
+    viennacl::copy(vcl_dense_result, vcl_dense_result_cpu);
+
+    NumericT dense_diff = 0;
+    for (std::size_t i=0; i<ublas_dense_result.size1(); ++i)
+      for (std::size_t j=0; j<ublas_dense_result.size2(); ++j)
+        dense_diff = std::max(dense_diff, std::fabs(ublas_dense_result(i,j) - vcl_dense_result_cpu(i,j)) / std::max(std::fabs(ublas_dense_result(i,j)), NumericT(1)));
+
+    if( dense_diff > epsilon )
+    {
+      std::cout << "# Error at operation: matrix-matrix product with compressed_matrix (pass " << pass << ")" << std::endl;
+      std::cout << "  diff: " << dense_diff << std::endl;
+      retval = EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Testing products: compressed_matrix with compressed_matrix" << std::endl;
+  ublas::compressed_matrix<NumericT> ublas_matrix_squared = ublas::sparse_prod<ublas::compressed_matrix<NumericT> >(ublas_matrix, ublas_matrix);
+  viennacl::compressed_matrix<NumericT> vcl_compressed_matrix_squared = viennacl::linalg::prod(vcl_compressed_matrix, vcl_compressed_matrix);
+
+  if( std::fabs(diff(ublas_matrix_squared, vcl_compressed_matrix_squared)) > epsilon )
+  {
+    std::cout << "# Error at operation: matrix-matrix product with compressed_matrix" << std::endl;
+    std::cout << "  diff: " << std::fabs(diff(ublas_matrix_squared, vcl_compressed_matrix_squared)) << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
   //
   // Triangular solvers for A \ b:
   //
@@ -650,6 +936,35 @@ int test(Epsilon const& epsilon)
     retval = EXIT_FAILURE;
   }
 
+  std::cout << "Testing binary save/load of sparse matrices" << std::endl;
+  if (!binary_io_roundtrip(vcl_compressed_matrix, vcl_rhs, result, epsilon))
+  {
+    std::cout << "# Error at operation: binary save/load of compressed_matrix" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+  if (!binary_io_roundtrip(vcl_coordinate_matrix, vcl_rhs, result, epsilon))
+  {
+    std::cout << "# Error at operation: binary save/load of coordinate_matrix" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+  if (!binary_io_roundtrip(vcl_ell_matrix, vcl_rhs, result, epsilon))
+  {
+    std::cout << "# Error at operation: binary save/load of ell_matrix" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+  if (!binary_io_roundtrip(vcl_hyb_matrix, vcl_rhs, result, epsilon))
+  {
+    std::cout << "# Error at operation: binary save/load of hyb_matrix" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
+  std::cout << "Testing products: out_of_core_compressed_matrix" << std::endl;
+  if (!out_of_core_test(ublas_matrix, vcl_rhs, result, NumericT(epsilon)))
+  {
+    std::cout << "# Error at operation: matrix-vector product with out_of_core_compressed_matrix" << std::endl;
+    retval = EXIT_FAILURE;
+  }
+
   
   // --------------------------------------------------------------------------            
   // --------------------------------------------------------------------------            
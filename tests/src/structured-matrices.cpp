@@ -585,7 +585,9 @@ int main()
   
   std::cout << std::endl;
 
+#ifdef VIENNACL_WITH_OPENCL
   if( viennacl::ocl::current_device().double_support() )
+#endif
   {
     eps = 1e-10;
     
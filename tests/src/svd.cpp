@@ -155,7 +155,7 @@ ScalarType sigmas_compare(viennacl::matrix<ScalarType>& res,
 
 
 template <typename ScalarType>
-void test_svd(const std::string & fn, ScalarType EPS) 
+bool test_svd(const std::string & fn, ScalarType EPS) 
 {
   std::size_t sz1, sz2;
 
@@ -189,7 +189,7 @@ void test_svd(const std::string & fn, ScalarType EPS)
 
   viennacl::linalg::svd(Ai, QL, QR);
 
-  viennacl::ocl::get_queue().finish();
+  viennacl::backend::finish();
 
   double time_spend = timer.get();
 
@@ -204,6 +204,29 @@ void test_svd(const std::string & fn, ScalarType EPS)
                    && (fabs(prods_diff) < std::sqrt(EPS));  //note: computing the product is not accurate down to 10^{-16}, so we allow for a higher tolerance here
 
   printf("%6s [%dx%d] %40s sigma_diff = %.6f; prod_diff = %.6f; time = %.6f\n", sigma_ok?"[[OK]]":"[FAIL]", (int)Aref.size1(), (int)Aref.size2(), fn.c_str(), sigma_diff, prods_diff, time_spend);
+
+  return sigma_ok;
+}
+
+
+/** @brief Checks that matrices with no rows or no columns are handled: the non-empty orthogonal factor is the identity */
+template <typename ScalarType>
+bool test_svd_empty(std::size_t sz1, std::size_t sz2)
+{
+  viennacl::matrix<ScalarType> Ai(sz1, sz2), QL(sz1, sz1), QR(sz2, sz2);
+
+  viennacl::linalg::svd(Ai, QL, QR);
+
+  bool ok = true;
+  for (std::size_t i = 0; i < sz1; ++i)
+    for (std::size_t j = 0; j < sz1; ++j)
+      ok = ok && (QL(i, j) == ScalarType((i == j) ? 1 : 0));
+  for (std::size_t i = 0; i < sz2; ++i)
+    for (std::size_t j = 0; j < sz2; ++j)
+      ok = ok && (QR(i, j) == ScalarType((i == j) ? 1 : 0));
+
+  printf("%6s [%dx%d] %40s\n", ok?"[[OK]]":"[FAIL]", static_cast<int>(sz1), static_cast<int>(sz2), "empty matrix");
+  return ok;
 }
 
 
@@ -222,7 +245,7 @@ void time_svd(std::size_t sz1, std::size_t sz2)
   timer.start();
 
   viennacl::linalg::svd(Ai, QL, QR);
-  viennacl::ocl::get_queue().finish();
+  viennacl::backend::finish();
   double time_spend = timer.get();
 
   printf("[%dx%d] time = %.6f\n", static_cast<int>(sz1), static_cast<int>(sz2), time_spend);
@@ -233,17 +256,28 @@ template <typename ScalarType>
 int test(ScalarType epsilon) 
 {
 
-    test_svd<ScalarType>(std::string("../../examples/testdata/svd/qr.example"), epsilon);
-    test_svd<ScalarType>(std::string("../../examples/testdata/svd/wiki.example"), epsilon);
-    test_svd<ScalarType>(std::string("../../examples/testdata/svd/wiki.qr.example"), epsilon);
-    test_svd<ScalarType>(std::string("../../examples/testdata/svd/pysvd.example"), epsilon);
-    test_svd<ScalarType>(std::string("../../examples/testdata/svd/random.example"), epsilon);
-
+    bool ok = true;
+    ok = test_svd<ScalarType>(std::string("../../examples/testdata/svd/qr.example"), epsilon) && ok;
+    ok = test_svd<ScalarType>(std::string("../../examples/testdata/svd/wiki.example"), epsilon) && ok;
+    ok = test_svd<ScalarType>(std::string("../../examples/testdata/svd/wiki.qr.example"), epsilon) && ok;
+    ok = test_svd<ScalarType>(std::string("../../examples/testdata/svd/pysvd.example"), epsilon) && ok;
+    ok = test_svd<ScalarType>(std::string("../../examples/testdata/svd/random.example"), epsilon) && ok;
+#ifndef VIENNACL_WITH_OPENCL
+    ok = test_svd_empty<ScalarType>(0, 4) && ok;
+    ok = test_svd_empty<ScalarType>(4, 0) && ok;
+#endif
+
+    if (!ok)
+      return EXIT_FAILURE;
+
+    // timings of larger problems take minutes on a CPU, hence they are only run on request (compile with -DVIENNACL_SVD_TIMINGS):
+#ifdef VIENNACL_SVD_TIMINGS
     time_svd<ScalarType>(500, 500);
     time_svd<ScalarType>(1000, 1000);
     time_svd<ScalarType>(4096, 512);
     time_svd<ScalarType>(2048, 2048);
     //time_svd(4096, 4096);  //takes too long for a standard sanity test. Feel free to uncomment
+#endif
 
     return EXIT_SUCCESS;
 }
@@ -281,7 +315,9 @@ int main()
    std::cout << std::endl;
    std::cout << "----------------------------------------------" << std::endl;
    std::cout << std::endl;
+#ifdef VIENNACL_WITH_OPENCL
    if( viennacl::ocl::current_device().double_support() )
+#endif
    {
       {
         typedef double NumericT;
@@ -20,6 +20,7 @@
 //
 #include <iostream>
 #include <iomanip>
+#include <fstream>
 
 //
 // *** Boost
@@ -39,6 +40,7 @@
 #include "viennacl/linalg/norm_1.hpp"
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/linalg/norm_inf.hpp"
+#include "viennacl/io/binary.hpp"
 
 #include "Random.hpp"
 
@@ -193,6 +195,49 @@ int test(Epsilon const& epsilon,
     return EXIT_FAILURE;
   if (check(cpu_result, gpu_result, epsilon) != EXIT_SUCCESS)
     return EXIT_FAILURE;
+
+  // --------------------------------------------------------------------------
+  std::cout << "Testing multiple inner products..." << std::endl;
+  {
+    std::vector<viennacl::vector_base<NumericT> const *> vcl_tuple_vecs(5);
+    vcl_tuple_vecs[0] = &vcl_v1; vcl_tuple_vecs[1] = &vcl_v2; vcl_tuple_vecs[2] = &vcl_v1;
+    vcl_tuple_vecs[3] = &vcl_v2; vcl_tuple_vecs[4] = &vcl_v2;
+    viennacl::vector_tuple<NumericT> vcl_tuple(vcl_tuple_vecs);
+
+    NumericT cpu_result_11 = viennacl::linalg::inner_prod(ublas_v1, ublas_v1);
+    NumericT cpu_result_12 = viennacl::linalg::inner_prod(ublas_v1, ublas_v2);
+
+    viennacl::vector<NumericT> vcl_result(2);
+    vcl_result = viennacl::linalg::inner_prod(vcl_v1, viennacl::tie(vcl_v1, vcl_v2));
+    if (check(cpu_result_11, NumericT(vcl_result[0]), epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    if (check(cpu_result_12, NumericT(vcl_result[1]), epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+
+    viennacl::vector<NumericT> vcl_result5(5);
+    vcl_result5 = viennacl::linalg::inner_prod(vcl_v1, vcl_tuple);
+    for (std::size_t i=0; i<vcl_result5.size(); ++i)
+      if (check((i == 0 || i == 2) ? cpu_result_11 : cpu_result_12, NumericT(vcl_result5[i]), epsilon) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+
+    std::cout << "Testing multi_axpy..." << std::endl;
+    // x += alpha * sum_i coeffs[i] * y_i with y = (v1, v2, v1, v2, v2):
+    ublas::vector<NumericT> ublas_x(ublas_v1.size());
+    viennacl::vector<NumericT> vcl_x(ublas_v1.size());
+    ublas_x = ublas::scalar_vector<NumericT>(ublas_v1.size(), NumericT(1.0));
+    vcl_x = viennacl::scalar_vector<NumericT>(vcl_x.size(), NumericT(1.0));
+
+    std::vector<NumericT> std_coeffs(5);
+    std_coeffs[0] = NumericT(0.5); std_coeffs[1] = NumericT(-1.0); std_coeffs[2] = NumericT(1.5);
+    std_coeffs[3] = NumericT(2.0); std_coeffs[4] = NumericT(0.25);
+    viennacl::vector<NumericT> vcl_coeffs(5);
+    viennacl::copy(std_coeffs, vcl_coeffs);
+
+    ublas_x += NumericT(-0.5) * ((std_coeffs[0] + std_coeffs[2]) * ublas_v1 + (std_coeffs[1] + std_coeffs[3] + std_coeffs[4]) * ublas_v2);
+    viennacl::linalg::multi_axpy(vcl_x, NumericT(-0.5), vcl_coeffs, vcl_tuple);
+    if (check(ublas_x, vcl_x, epsilon) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
   
   // --------------------------------------------------------------------------
   std::cout << "Testing norm_1..." << std::endl;
@@ -1058,6 +1103,138 @@ int test(Epsilon const& epsilon)
   return EXIT_SUCCESS;
 }
 
+/** @brief Checks that reuse and trimming of buffers in main RAM are reflected by the statistics of the memory pool */
+int test_memory_pool()
+{
+  typedef viennacl::backend::cpu_ram::memory_pool_statistics  StatisticsType;
+
+  std::size_t num_bytes  = 123457;
+  std::size_t size_class = viennacl::backend::cpu_ram::detail::memory_pool::size_class(num_bytes);
+
+  viennacl::backend::cpu_ram::trim_pool();
+  StatisticsType initial = viennacl::backend::cpu_ram::pool_statistics();
+  if (initial.bytes_cached != 0)
+  {
+    std::cout << "# Error: trim_pool() did not release cached buffers" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // a new buffer is allocated and cached after release:
+  {
+    viennacl::backend::cpu_ram::handle_type buffer = viennacl::backend::cpu_ram::memory_create(num_bytes);
+    StatisticsType in_use = viennacl::backend::cpu_ram::pool_statistics();
+    if (in_use.num_allocations != initial.num_allocations + 1 || in_use.num_reuses != initial.num_reuses
+        || in_use.bytes_live != initial.bytes_live + size_class || in_use.bytes_peak < in_use.bytes_live)
+    {
+      std::cout << "# Error: Statistics after first allocation are wrong" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  StatisticsType released = viennacl::backend::cpu_ram::pool_statistics();
+  if (released.bytes_live != initial.bytes_live || released.bytes_cached != size_class)
+  {
+    std::cout << "# Error: Released buffer is not cached" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // an allocation of the same size class reuses the cached buffer:
+  {
+    viennacl::backend::cpu_ram::handle_type buffer = viennacl::backend::cpu_ram::memory_create(size_class);
+    StatisticsType reused = viennacl::backend::cpu_ram::pool_statistics();
+    if (reused.num_reuses != initial.num_reuses + 1 || reused.bytes_cached != 0 || reused.hit_rate() <= 0 || reused.hit_rate() > 1)
+    {
+      std::cout << "# Error: Cached buffer is not reused" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+#ifdef VIENNACL_WITH_OPENMP
+  // concurrent allocations and releases must leave the pool consistent:
+  #pragma omp parallel for
+  for (long i = 0; i < 2000; ++i)
+  {
+    viennacl::backend::cpu_ram::handle_type buffer = viennacl::backend::cpu_ram::memory_create(static_cast<std::size_t>(64 + (i % 17) * 1000));
+    buffer.get()[0] = 1;
+  }
+  if (viennacl::backend::cpu_ram::pool_statistics().bytes_live != initial.bytes_live)
+  {
+    std::cout << "# Error: Concurrent use of the memory pool" << std::endl;
+    return EXIT_FAILURE;
+  }
+#endif
+
+  viennacl::backend::cpu_ram::trim_pool();
+  if (viennacl::backend::cpu_ram::pool_statistics().bytes_cached != 0)
+  {
+    std::cout << "# Error: trim_pool() did not release cached buffers" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+
+/** @brief Saves a vector in the binary format and loads it again, with and without memory mapping and with conversion of the scalar type */
+template <typename NumericT>
+int test_binary_io(NumericT epsilon)
+{
+  const char * filename = "vector-test.vclbin";
+
+  ublas::vector<NumericT> ublas_vec(3001);
+  for (std::size_t i=0; i<ublas_vec.size(); ++i)
+    ublas_vec[i] = NumericT(1.0) + random<NumericT>();
+
+  viennacl::vector<NumericT> vcl_vec(ublas_vec.size());
+  viennacl::copy(ublas_vec, vcl_vec);
+
+  if (!viennacl::io::save(vcl_vec, filename))
+  {
+    std::cout << "# Error at operation: binary save of vector" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  viennacl::vector<NumericT> vcl_mapped;
+  if (!viennacl::io::load(vcl_mapped, filename) || vcl_mapped.size() != ublas_vec.size() || check(ublas_vec, vcl_mapped, epsilon) != EXIT_SUCCESS)
+  {
+    std::cout << "# Error at operation: binary load of vector (memory mapped)" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // pages are mapped copy-on-write, so modifying the vector must not alter the file:
+  vcl_mapped *= NumericT(2);
+  viennacl::vector<NumericT> vcl_read;
+  if (!viennacl::io::load(vcl_read, filename, false) || vcl_read.size() != ublas_vec.size() || check(ublas_vec, vcl_read, epsilon) != EXIT_SUCCESS)
+  {
+    std::cout << "# Error at operation: binary load of vector (buffered read)" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  viennacl::vector<double> vcl_converted;
+  ublas::vector<double> ublas_converted(ublas_vec);
+  if (!viennacl::io::load(vcl_converted, filename) || check(ublas_converted, vcl_converted, epsilon) != EXIT_SUCCESS)
+  {
+    std::cout << "# Error at operation: binary load of vector with a different scalar type" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // files with a version other than the one written must be rejected (the version is stored as 64-bit word after magic and byte order):
+  {
+    std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+    char zero_version[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    file.seekp(16);
+    file.write(zero_version, 8);
+  }
+  viennacl::vector<NumericT> vcl_invalid;
+  if (viennacl::io::load(vcl_invalid, filename) || viennacl::io::load(vcl_invalid, filename, false))
+  {
+    std::cout << "# Error at operation: binary load of vector with invalid version" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::remove(filename);
+  return EXIT_SUCCESS;
+}
+
 
 
 //
@@ -1114,6 +1291,27 @@ int main()
       std::cout << std::endl;
    }
    
+  std::cout << "# Testing binary save/load" << std::endl;
+  retval = test_binary_io<float>(1e-4f);
+#ifdef VIENNACL_WITH_OPENCL
+  if( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    if (retval == EXIT_SUCCESS)
+      retval = test_binary_io<double>(1e-12);
+  }
+  if( retval == EXIT_SUCCESS )
+    std::cout << "# Test passed" << std::endl;
+  else
+    return retval;
+
+  std::cout << "# Testing memory pool in main RAM" << std::endl;
+  retval = test_memory_pool();
+  if( retval == EXIT_SUCCESS )
+    std::cout << "# Test passed" << std::endl;
+  else
+    return retval;
+
   std::cout << std::endl;
   std::cout << "------- Test completed --------" << std::endl;
   std::cout << std::endl;
@@ -24,7 +24,34 @@
 
 
 #include <vector>
+#include <map>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
 #include "viennacl/tools/shared_ptr.hpp"
+#include "viennacl/tools/mutex.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+/** @brief Alignment (in bytes) of all buffers in main RAM. Must be a power of two. */
+#ifndef VIENNACL_CPU_RAM_ALIGNMENT
+  #define VIENNACL_CPU_RAM_ALIGNMENT  64
+#endif
+
+/** @brief Maximum number of bytes kept in the pool of released buffers for later reuse. Set to zero in order to disable caching. */
+#ifndef VIENNACL_CPU_RAM_POOL_MAX_CACHED_BYTES
+  #define VIENNACL_CPU_RAM_POOL_MAX_CACHED_BYTES  (std::size_t(256) * 1024 * 1024)
+#endif
+
+/** @brief Minimum number of bytes for copying buffers in main RAM with multiple OpenMP threads */
+#ifndef VIENNACL_CPU_RAM_PARALLEL_COPY_MIN_SIZE
+  #define VIENNACL_CPU_RAM_PARALLEL_COPY_MIN_SIZE  (std::size_t(1) << 20)
+#endif
+
+/* If VIENNACL_CPU_RAM_FIRST_TOUCH is defined, newly allocated buffers are zero-filled by the OpenMP threads using the same static partition as the compute kernels,
+   so that on NUMA systems the memory pages are placed close to the threads working on them. */
 
 namespace viennacl
 {
@@ -55,7 +82,217 @@ namespace viennacl
         
       }
       
+      /** @brief Usage statistics of the pool of buffers in main RAM. All sizes refer to the size classes of the buffers, i.e. include rounding. */
+      struct memory_pool_statistics
+      {
+        memory_pool_statistics() : bytes_live(0), bytes_peak(0), bytes_cached(0), num_allocations(0), num_reuses(0) {}
+        
+        /** @brief Returns the fraction of allocations served from cached buffers */
+        double hit_rate() const { return num_allocations ? static_cast<double>(num_reuses) / static_cast<double>(num_allocations) : 0; }
+        
+        std::size_t bytes_live;       //bytes in buffers currently in use
+        std::size_t bytes_peak;       //maximum of bytes_live so far
+        std::size_t bytes_cached;     //bytes in released buffers kept for reuse
+        std::size_t num_allocations;  //number of calls to memory_create()
+        std::size_t num_reuses;       //number of allocations served from released buffers
+      };
+      
+      namespace detail
+      {
+        /** @brief A caching pool of aligned buffers in main RAM, organized in size classes.
+        *
+        * Released buffers are kept for reuse by subsequent allocations of the same size class, up to VIENNACL_CPU_RAM_POOL_MAX_CACHED_BYTES.
+        * Size classes are spaced four per power of two, so at most 25 percent of a buffer are wasted by rounding.
+        * The pool is protected by a mutex, so buffers may be created and released concurrently by several host threads, with or without OpenMP.
+        */
+        class memory_pool
+        {
+            typedef std::map<std::size_t, std::vector<char *> >    free_list_type;
+            
+          public:
+            /** @brief Returns the process-wide pool. The pool is never destroyed, since buffers held by static objects may be released at program exit. */
+            static memory_pool & instance()
+            {
+              static memory_pool * pool = new memory_pool();
+              return *pool;
+            }
+            
+            /** @brief Rounds the requested number of bytes up to the next size class */
+            static std::size_t size_class(std::size_t size_in_bytes)
+            {
+              if (size_in_bytes <= VIENNACL_CPU_RAM_ALIGNMENT)
+                return VIENNACL_CPU_RAM_ALIGNMENT;
+              
+              std::size_t step = 1;
+              while (step * 8 < size_in_bytes)
+                step *= 2;
+              step = (step < VIENNACL_CPU_RAM_ALIGNMENT) ? VIENNACL_CPU_RAM_ALIGNMENT : step;
+              return ((size_in_bytes + step - 1) / step) * step;
+            }
+            
+            /** @brief Returns the aligned address within a raw buffer obtained from allocate() */
+            static char * aligned(char * raw_ptr)
+            {
+              std::size_t misalignment = reinterpret_cast<std::size_t>(raw_ptr) % VIENNACL_CPU_RAM_ALIGNMENT;
+              return misalignment ? raw_ptr + (VIENNACL_CPU_RAM_ALIGNMENT - misalignment) : raw_ptr;
+            }
+            
+            /** @brief Returns a raw buffer with at least size_class + VIENNACL_CPU_RAM_ALIGNMENT - 1 bytes, reusing a released one if available.
+            *
+            * @param size_class     The size class of the buffer
+            * @param is_new_buffer  Set to true if the buffer has been newly allocated rather than reused
+            */
+            char * allocate(std::size_t size_class, bool & is_new_buffer)
+            {
+              char * raw_ptr = NULL;
+              {
+                viennacl::tools::lock_guard guard(mutex_);
+                ++stats_.num_allocations;
+                free_list_type::iterator it = free_blocks_.find(size_class);
+                if (it != free_blocks_.end() && it->second.size() > 0)
+                {
+                  raw_ptr = it->second.back();
+                  it->second.pop_back();
+                  stats_.bytes_cached -= size_class;
+                  ++stats_.num_reuses;
+                }
+                stats_.bytes_live += size_class;
+                stats_.bytes_peak = std::max(stats_.bytes_peak, stats_.bytes_live);
+              }
+              
+              is_new_buffer = (raw_ptr == NULL);
+              if (is_new_buffer)
+                raw_ptr = new char[size_class + VIENNACL_CPU_RAM_ALIGNMENT - 1];
+              return raw_ptr;
+            }
+            
+            /** @brief Returns a raw buffer to the pool. The buffer is freed if the pool is full. */
+            void release(char * raw_ptr, std::size_t size_class)
+            {
+              bool keep = false;
+              {
+                viennacl::tools::lock_guard guard(mutex_);
+                stats_.bytes_live -= size_class;
+                if (stats_.bytes_cached + size_class <= VIENNACL_CPU_RAM_POOL_MAX_CACHED_BYTES)
+                {
+                  free_blocks_[size_class].push_back(raw_ptr);
+                  stats_.bytes_cached += size_class;
+                  keep = true;
+                }
+              }
+              
+              if (!keep)
+                delete[] raw_ptr;
+            }
+            
+            /** @brief Frees all cached buffers */
+            void trim()
+            {
+              free_list_type blocks;
+              {
+                viennacl::tools::lock_guard guard(mutex_);
+                blocks.swap(free_blocks_);
+                stats_.bytes_cached = 0;
+              }
+              
+              for (free_list_type::iterator it = blocks.begin(); it != blocks.end(); ++it)
+                for (std::size_t i=0; i<it->second.size(); ++i)
+                  delete[] it->second[i];
+            }
+            
+            /** @brief Returns the current usage statistics */
+            memory_pool_statistics statistics()
+            {
+              viennacl::tools::lock_guard guard(mutex_);
+              return stats_;
+            }
+            
+          private:
+            memory_pool() {}
+            memory_pool(memory_pool const &);
+            memory_pool & operator=(memory_pool const &);
+            
+            viennacl::tools::mutex mutex_;
+            free_list_type free_blocks_;
+            memory_pool_statistics stats_;
+        };
+        
+        /** @brief Returns the number of threads used for copying or filling the given number of bytes */
+        inline long copy_threads(std::size_t num_bytes)
+        {
+#ifdef VIENNACL_WITH_OPENMP
+          if (num_bytes > VIENNACL_CPU_RAM_PARALLEL_COPY_MIN_SIZE)
+            return static_cast<long>(omp_get_max_threads());
+#endif
+          (void)num_bytes;
+          return 1;
+        }
+        
+        /** @brief Copies bytes between non-overlapping memory regions. Large copies are split into one contiguous chunk per OpenMP thread. */
+        inline void copy_bytes(char * dst, const char * src, std::size_t num_bytes)
+        {
+          long num_chunks = copy_threads(num_bytes);
+          std::size_t chunk_size = (num_bytes + static_cast<std::size_t>(num_chunks) - 1) / static_cast<std::size_t>(num_chunks);
+          
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for schedule(static) if (num_chunks > 1)
+#endif
+          for (long chunk = 0; chunk < num_chunks; ++chunk)
+          {
+            std::size_t begin = static_cast<std::size_t>(chunk) * chunk_size;
+            if (begin < num_bytes)
+              std::memcpy(dst + begin, src + begin, std::min(chunk_size, num_bytes - begin));
+          }
+        }
+        
+        /** @brief Zero-fills a buffer using one contiguous chunk per OpenMP thread, so that memory pages are first touched by the threads using them. */
+        inline void first_touch(char * ptr, std::size_t num_bytes)
+        {
+          long num_chunks = 1;
+#ifdef VIENNACL_WITH_OPENMP
+          num_chunks = static_cast<long>(omp_get_max_threads());
+#endif
+          std::size_t chunk_size = (num_bytes + static_cast<std::size_t>(num_chunks) - 1) / static_cast<std::size_t>(num_chunks);
+          
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for schedule(static) if (num_chunks > 1)
+#endif
+          for (long chunk = 0; chunk < num_chunks; ++chunk)
+          {
+            std::size_t begin = static_cast<std::size_t>(chunk) * chunk_size;
+            if (begin < num_bytes)
+              std::memset(ptr + begin, 0, std::min(chunk_size, num_bytes - begin));
+          }
+        }
+        
+        /** @brief Deleter returning a buffer to the memory pool once the last handle to it is destroyed */
+        struct pool_deleter
+        {
+          pool_deleter(char * raw_ptr, std::size_t size_class) : raw_ptr_(raw_ptr), size_class_(size_class) {}
+          
+          void operator()(char *) const { memory_pool::instance().release(raw_ptr_, size_class_); }
+          
+          char * raw_ptr_;
+          std::size_t size_class_;
+        };
+      }
+      
+      /** @brief Returns the usage statistics of the pool of buffers in main RAM */
+      inline memory_pool_statistics pool_statistics()
+      {
+        return detail::memory_pool::instance().statistics();
+      }
+      
+      /** @brief Frees all buffers in main RAM which have been released and are kept for reuse */
+      inline void trim_pool()
+      {
+        detail::memory_pool::instance().trim();
+      }
+      
+
       /** @brief Creates an array of the specified size in main RAM. If the second argument is provided, the buffer is initialized with data from that pointer.
+       * 
+       * The array is aligned to VIENNACL_CPU_RAM_ALIGNMENT bytes and taken from the pool of released buffers if possible.
        * 
        * @param size_in_bytes   Number of bytes to allocate
        * @param host_ptr        Pointer to data which will be copied to the new array. Must point to at least 'size_in_bytes' bytes of data.
@@ -63,16 +300,19 @@ namespace viennacl
        */
       inline handle_type  memory_create(std::size_t size_in_bytes, const void * host_ptr = NULL)
       {
-        if (!host_ptr)
-          return handle_type(new char[size_in_bytes], detail::array_deleter<char>());
+        std::size_t size_class = detail::memory_pool::size_class(size_in_bytes);
+        bool is_new_buffer = false;
+        char * raw_ptr = detail::memory_pool::instance().allocate(size_class, is_new_buffer);
         
-        handle_type new_handle(new char[size_in_bytes], detail::array_deleter<char>());
+        handle_type new_handle(detail::memory_pool::aligned(raw_ptr), detail::pool_deleter(raw_ptr, size_class));
         
-        // copy data:
-        char * raw_ptr = new_handle.get();
-        const char * data_ptr = static_cast<const char *>(host_ptr);
-        for (std::size_t i=0; i<size_in_bytes; ++i)
-          raw_ptr[i] = data_ptr[i];
+        // copy data (the copy is split among threads in the same way as the first touch below):
+        if (host_ptr)
+          detail::copy_bytes(new_handle.get(), static_cast<const char *>(host_ptr), size_in_bytes);
+#ifdef VIENNACL_CPU_RAM_FIRST_TOUCH
+        else if (is_new_buffer)
+          detail::first_touch(new_handle.get(), size_in_bytes);
+#endif
         
         return new_handle;
       }
@@ -94,8 +334,12 @@ namespace viennacl
         assert( (dst_buffer.get() != NULL) && bool("Memory not initialized!"));
         assert( (src_buffer.get() != NULL) && bool("Memory not initialized!"));
         
-        for (std::size_t i=0; i<bytes_to_copy; ++i)
-          dst_buffer.get()[i+dst_offset] = src_buffer.get()[i + src_offset];
+        char * dst = dst_buffer.get() + dst_offset;
+        const char * src = src_buffer.get() + src_offset;
+        if (dst < src + bytes_to_copy && src < dst + bytes_to_copy)  //overlapping regions within the same buffer
+          std::memmove(dst, src, bytes_to_copy);
+        else
+          detail::copy_bytes(dst, src, bytes_to_copy);
       }
       
       /** @brief Writes data from main RAM identified by 'ptr' to the buffer identified by 'dst_buffer'
@@ -112,8 +356,7 @@ namespace viennacl
       {
         assert( (dst_buffer.get() != NULL) && bool("Memory not initialized!"));
         
-        for (std::size_t i=0; i<bytes_to_copy; ++i)
-          dst_buffer.get()[i+dst_offset] = static_cast<const char *>(ptr)[i];
+        detail::copy_bytes(dst_buffer.get() + dst_offset, static_cast<const char *>(ptr), bytes_to_copy);
       }
       
       /** @brief Reads data from a buffer back to main RAM.
@@ -130,8 +373,7 @@ namespace viennacl
       {
         assert( (src_buffer.get() != NULL) && bool("Memory not initialized!"));
         
-        for (std::size_t i=0; i<bytes_to_copy; ++i)
-          static_cast<char *>(ptr)[i] = src_buffer.get()[i+src_offset];
+        detail::copy_bytes(static_cast<char *>(ptr), src_buffer.get() + src_offset, bytes_to_copy);
       }
       
     
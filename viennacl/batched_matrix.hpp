@@ -0,0 +1,180 @@
+#ifndef VIENNACL_BATCHED_MATRIX_HPP_
+#define VIENNACL_BATCHED_MATRIX_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/batched_matrix.hpp
+    @brief Implementation of the batched_matrix class, which holds many small dense matrices of equal size in a single buffer.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "viennacl/forwards.h"
+#include "viennacl/backend/memory.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/batched_operations.hpp"
+
+namespace viennacl
+{
+  /** @brief A batch of independent small dense matrices of equal size, stored in a single buffer.
+  *
+  * Matrix b of the batch starts at offset b * stride() in the buffer and is stored without padding in the layout F,
+  * i.e. entry (i,j) of matrix b is located at b * stride() + F::mem_index(i, j, size1(), size2()).
+  *
+  * @tparam SCALARTYPE   The underlying scalar type (either float or double)
+  * @tparam F            Storage layout of each matrix: Either viennacl::row_major or viennacl::column_major
+  */
+  template <class SCALARTYPE, typename F>
+  class batched_matrix
+  {
+      typedef batched_matrix<SCALARTYPE, F>    self_type;
+
+    public:
+      typedef viennacl::backend::mem_handle    handle_type;
+      typedef SCALARTYPE                       cpu_value_type;
+      typedef vcl_size_t                       size_type;
+
+      /** @brief The default constructor. Does not allocate any memory. */
+      batched_matrix() : batch_size_(0), size1_(0), size2_(0), stride_(0) {}
+
+      /** @brief Creates a zero-initialized batch of matrices.
+      *
+      * @param batch_size  Number of matrices in the batch
+      * @param rows        Number of rows of each matrix
+      * @param columns     Number of columns of each matrix
+      * @param stride      Distance (in entries) between the first entries of two consecutive matrices. Zero selects rows * columns.
+      * @param mem_type    The memory domain the buffer is created in
+      */
+      explicit batched_matrix(size_type batch_size, size_type rows, size_type columns, size_type stride = 0,
+                              viennacl::memory_types mem_type = viennacl::MAIN_MEMORY)
+        : batch_size_(batch_size), size1_(rows), size2_(columns), stride_(stride > 0 ? stride : rows * columns)
+      {
+        assert( (stride_ >= size1_ * size2_) && bool("Stride of batched_matrix smaller than the size of a matrix!"));
+
+        elements_.switch_active_handle_id(mem_type);
+        if (internal_size() > 0)
+        {
+          std::vector<SCALARTYPE> temp(internal_size());
+          viennacl::backend::memory_create(elements_, sizeof(SCALARTYPE) * internal_size(), &(temp[0]));
+        }
+      }
+
+      /** @brief Deep copy constructor */
+      batched_matrix(self_type const & other)
+        : batch_size_(other.batch_size_), size1_(other.size1_), size2_(other.size2_), stride_(other.stride_)
+      {
+        elements_.switch_active_handle_id(other.handle().get_active_handle_id());
+        if (internal_size() > 0)
+        {
+          viennacl::backend::memory_create(elements_, sizeof(SCALARTYPE) * internal_size());
+          viennacl::backend::memory_copy(other.handle(), elements_, 0, 0, sizeof(SCALARTYPE) * internal_size());
+        }
+      }
+
+      /** @brief Deep copy. The sizes of the matrices and the batch size are taken over from 'other'. */
+      self_type & operator=(self_type const & other)
+      {
+        if (this == &other)
+          return *this;
+
+        if (internal_size() != other.internal_size() || handle().get_active_handle_id() != other.handle().get_active_handle_id())
+        {
+          elements_ = handle_type();
+          elements_.switch_active_handle_id(other.handle().get_active_handle_id());
+          if (other.internal_size() > 0)
+            viennacl::backend::memory_create(elements_, sizeof(SCALARTYPE) * other.internal_size());
+        }
+
+        batch_size_ = other.batch_size_;
+        size1_      = other.size1_;
+        size2_      = other.size2_;
+        stride_     = other.stride_;
+
+        if (internal_size() > 0)
+          viennacl::backend::memory_copy(other.handle(), elements_, 0, 0, sizeof(SCALARTYPE) * internal_size());
+
+        return *this;
+      }
+
+      /** @brief Computes C_b = A_b * B_b for all matrices of the batch. Memory is allocated if this batch is empty. */
+      self_type & operator=(matrix_expression<const self_type, const self_type, op_prod> const & proxy)
+      {
+        if (batch_size_ == 0)
+          *this = self_type(proxy.lhs().batch_size(), proxy.lhs().size1(), proxy.rhs().size2(), 0, proxy.lhs().handle().get_active_handle_id());
+
+        viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), *this);
+        return *this;
+      }
+
+      /** @brief Returns the number of matrices in the batch */
+      size_type batch_size() const { return batch_size_; }
+      /** @brief Returns the number of rows of each matrix */
+      size_type size1() const { return size1_; }
+      /** @brief Returns the number of columns of each matrix */
+      size_type size2() const { return size2_; }
+      /** @brief Returns the distance (in entries) between the first entries of two consecutive matrices */
+      size_type stride() const { return stride_; }
+      /** @brief Returns the number of entries of the buffer */
+      size_type internal_size() const { return batch_size_ * stride_; }
+
+      /** @brief Returns the memory handle */
+      handle_type & handle() { return elements_; }
+      /** @brief Returns the memory handle, const-version */
+      handle_type const & handle() const { return elements_; }
+
+    private:
+      size_type batch_size_;
+      size_type size1_;
+      size_type size2_;
+      size_type stride_;
+      handle_type elements_;
+  };
+
+
+  /** @brief Copies a batch of matrices from a contiguous host buffer (with the same stride and layout) to a batched_matrix
+  *
+  * @param cpu_begin   Pointer to the first entry of the host buffer
+  * @param cpu_end     Pointer past the last entry of the host buffer. At most internal_size() entries are copied.
+  * @param gpu_batch   The destination batch
+  */
+  template <typename SCALARTYPE, typename F>
+  void fast_copy(SCALARTYPE const * cpu_begin, SCALARTYPE const * cpu_end, batched_matrix<SCALARTYPE, F> & gpu_batch)
+  {
+    vcl_size_t num_entries = std::min<vcl_size_t>(static_cast<vcl_size_t>(cpu_end - cpu_begin), gpu_batch.internal_size());
+    if (num_entries > 0)
+      viennacl::backend::memory_write(gpu_batch.handle(), 0, sizeof(SCALARTYPE) * num_entries, cpu_begin);
+  }
+
+  /** @brief Copies a batch of matrices to a host buffer holding at least internal_size() entries
+  *
+  * @param gpu_batch   The source batch
+  * @param cpu_begin   Pointer to the first entry of the host buffer
+  */
+  template <typename SCALARTYPE, typename F>
+  void fast_copy(batched_matrix<SCALARTYPE, F> const & gpu_batch, SCALARTYPE * cpu_begin)
+  {
+    if (gpu_batch.internal_size() > 0)
+      viennacl::backend::memory_read(gpu_batch.handle(), 0, sizeof(SCALARTYPE) * gpu_batch.internal_size(), cpu_begin);
+  }
+
+} //namespace viennacl
+
+#endif
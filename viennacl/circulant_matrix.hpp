@@ -24,7 +24,6 @@
 
 #include "viennacl/forwards.h"
 #include "viennacl/vector.hpp"
-#include "viennacl/ocl/context.hpp"
 
 #include "viennacl/linalg/circulant_matrix_operations.hpp"
 
@@ -50,7 +49,6 @@ namespace viennacl
          */
         explicit circulant_matrix()
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
 
         /**
@@ -63,7 +61,6 @@ namespace viennacl
         {
           assert(rows == cols && bool("Circulant matrix must be square!"));
           (void)cols;  // avoid 'unused parameter' warning in optimized builds
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
 
         /** @brief Resizes the matrix.
@@ -494,6 +494,37 @@ namespace viennacl
         }
         
         
+        /** @brief Creates the matrix from the sparse matrix-matrix product C = prod(A, B). */
+        template <unsigned int ALIGNMENT_A, unsigned int ALIGNMENT_B>
+        compressed_matrix(matrix_expression<const compressed_matrix<SCALARTYPE, ALIGNMENT_A>,
+                                            const compressed_matrix<SCALARTYPE, ALIGNMENT_B>,
+                                            op_prod> const & proxy) : rows_(0), cols_(0), nonzeros_(0)
+        {
+          viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), *this);
+        }
+
+        /** @brief Assigns the sparse matrix-matrix product C = prod(A, B). The sparsity pattern of the matrix is replaced by the one of the product. */
+        template <unsigned int ALIGNMENT_A, unsigned int ALIGNMENT_B>
+        compressed_matrix & operator=(matrix_expression<const compressed_matrix<SCALARTYPE, ALIGNMENT_A>,
+                                                        const compressed_matrix<SCALARTYPE, ALIGNMENT_B>,
+                                                        op_prod> const & proxy)
+        {
+          assert( (rows_ == 0 || rows_ == proxy.lhs().size1()) && bool("Size mismatch") );
+          assert( (cols_ == 0 || cols_ == proxy.rhs().size2()) && bool("Size mismatch") );
+
+          // check for the special cases A = A * B and B = A * B
+          if (proxy.lhs().handle() == elements_ || proxy.rhs().handle() == elements_)
+          {
+            compressed_matrix temp(proxy);
+            *this = temp;
+            return *this;
+          }
+
+          viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), *this);
+          return *this;
+        }
+
+
         /** @brief Sets the row, column and value arrays of the compressed matrix
         *
         * @param row_jumper     Pointer to an array holding the indices of the first element of each row (starting with zero). E.g. row_jumper[10] returns the index of the first entry of the 11th row. The array length is 'cols + 1'
@@ -662,6 +693,8 @@ namespace viennacl
           return row_buffer_.get_active_handle_id();
         }
         
+        friend class viennacl::io::detail::binary_object_access;
+
       private:
         
         std::size_t element_index(std::size_t i, std::size_t j)
@@ -303,6 +303,8 @@ namespace viennacl
         friend void copy(const CPU_MATRIX & cpu_matrix, coordinate_matrix<SCALARTYPE2, ALIGNMENT2> & gpu_matrix );
         #endif
 
+        friend class viennacl::io::detail::binary_object_access;
+
       private:
         /** @brief Copy constructor is by now not available. */
         coordinate_matrix(coordinate_matrix const &);
@@ -75,6 +75,8 @@ namespace viennacl
         friend void copy(const CPU_MATRIX & cpu_matrix, ell_matrix<T, ALIGN> & gpu_matrix );
       #endif        
         
+        friend class viennacl::io::detail::binary_object_access;
+
       private:
         std::size_t rows_;
         std::size_t cols_;
@@ -25,7 +25,11 @@
 #include <viennacl/vector.hpp>
 #include <viennacl/matrix.hpp>
 
-#include "viennacl/linalg/kernels/fft_kernels.h"
+#include "viennacl/linalg/host_based/fft_operations.hpp"
+
+#ifdef VIENNACL_WITH_OPENCL
+  #include "viennacl/linalg/kernels/fft_kernels.h"
+#endif
 
 #include <cmath>
 
@@ -38,13 +42,6 @@ namespace viennacl
     namespace fft
     {
         const std::size_t MAX_LOCAL_POINTS_NUM = 512;
-
-        namespace FFT_DATA_ORDER {
-            enum DATA_ORDER {
-                ROW_MAJOR,
-                COL_MAJOR
-            };
-        }
     }
   }
 }
@@ -89,7 +86,7 @@ namespace viennacl
             return bits_datasize;
         }
 
-
+#ifdef VIENNACL_WITH_OPENCL
         /**
          * @brief Direct algorithm for computing Fourier transformation.
          *
@@ -196,7 +193,7 @@ namespace viennacl
             } 
             else
             {
-                reorder<SCALARTYPE>(in, size, stride, bits_datasize, batch_num);
+                reorder<SCALARTYPE>(in, size, stride, bits_datasize, batch_num, data_order);
 
                 for(std::size_t step = 0; step < bits_datasize; step++) 
                 {
@@ -214,6 +211,69 @@ namespace viennacl
 
             }
         }
+#endif
+
+        /**
+         * @brief Direct algorithm for computing Fourier transformation.
+         *
+         * Works on any sizes of data.
+         * Serial implementation has o(n^2) complexity
+        */
+        template<class SCALARTYPE>
+        void direct(viennacl::backend::mem_handle const & in,
+                    viennacl::backend::mem_handle & out,
+                    std::size_t size,
+                    std::size_t stride,
+                    std::size_t batch_num,
+                    SCALARTYPE sign = -1.0f,
+                    FFT_DATA_ORDER::DATA_ORDER data_order = FFT_DATA_ORDER::ROW_MAJOR
+                    )
+        {
+          switch (in.get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::direct(in, out, size, stride, batch_num, sign, data_order);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+              direct(in.opencl_handle(), out.opencl_handle(), size, stride, batch_num, sign, data_order);
+              break;
+#endif
+            default:
+              throw "not implemented";
+          }
+        }
+
+        /**
+         * @brief Radix-2 algorithm for computing Fourier transformation.
+         *
+         * Works only on power-of-two sizes of data.
+         * Serial implementation has o(n * lg n) complexity.
+         * This is a Cooley-Tukey algorithm
+        */
+        template<class SCALARTYPE>
+        void radix2(viennacl::backend::mem_handle & in,
+                    std::size_t size,
+                    std::size_t stride,
+                    std::size_t batch_num,
+                    SCALARTYPE sign = -1.0f,
+                    FFT_DATA_ORDER::DATA_ORDER data_order = FFT_DATA_ORDER::ROW_MAJOR
+                    )
+        {
+          switch (in.get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::radix2(in, size, stride, batch_num, sign, data_order);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+              radix2(in.opencl_handle(), size, stride, batch_num, sign, data_order);
+              break;
+#endif
+            default:
+              throw "not implemented";
+          }
+        }
 
         /**
          * @brief Bluestein's algorithm for computing Fourier transformation.
@@ -227,52 +287,66 @@ namespace viennacl
                        viennacl::vector<SCALARTYPE, ALIGNMENT>& out,
                        std::size_t /*batch_num*/)
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+          switch (viennacl::traits::handle(in).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::bluestein(in, out);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
 
-            std::size_t size = in.size() >> 1;
-            std::size_t ext_size = next_power_2(2 * size - 1);
+                std::size_t size = in.size() >> 1;
+                std::size_t ext_size = next_power_2(2 * size - 1);
 
-            viennacl::vector<SCALARTYPE, ALIGNMENT> A(ext_size << 1);
-            viennacl::vector<SCALARTYPE, ALIGNMENT> B(ext_size << 1);
+                viennacl::vector<SCALARTYPE, ALIGNMENT> A(ext_size << 1);
+                viennacl::vector<SCALARTYPE, ALIGNMENT> B(ext_size << 1);
 
-            viennacl::vector<SCALARTYPE, ALIGNMENT> Z(ext_size << 1);
+                viennacl::vector<SCALARTYPE, ALIGNMENT> Z(ext_size << 1);
 
-            {
-                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("zero2");
-                viennacl::ocl::enqueue(kernel(
-                                            A,
-                                            B,
-                                            static_cast<cl_uint>(ext_size)
-                                            ));
+                {
+                    viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("zero2");
+                    viennacl::ocl::enqueue(kernel(
+                                                A,
+                                                B,
+                                                static_cast<cl_uint>(ext_size)
+                                                ));
 
-            }
-            {
-                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("bluestein_pre");
-                viennacl::ocl::enqueue(kernel(
-                                           in,
-                                           A,
-                                           B,
-                                           static_cast<cl_uint>(size),
-                                           static_cast<cl_uint>(ext_size)
-                                       ));
-            }
+                }
+                {
+                    viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("bluestein_pre");
+                    viennacl::ocl::enqueue(kernel(
+                                               in,
+                                               A,
+                                               B,
+                                               static_cast<cl_uint>(size),
+                                               static_cast<cl_uint>(ext_size)
+                                           ));
+                }
 
-            viennacl::linalg::convolve_i(A, B, Z);
+                viennacl::linalg::convolve_i(A, B, Z);
 
-            {
-                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                                 .get_kernel("bluestein_post");
-                viennacl::ocl::enqueue(kernel(
-                                            Z,
-                                            out,
-                                            static_cast<cl_uint>(size)
-                                            ));
+                {
+                    viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                     .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                     .get_kernel("bluestein_post");
+                    viennacl::ocl::enqueue(kernel(
+                                                Z,
+                                                out,
+                                                static_cast<cl_uint>(size)
+                                                ));
+                }
+              break;
             }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
 
         template<class SCALARTYPE, unsigned int ALIGNMENT>
@@ -280,52 +354,108 @@ namespace viennacl
                       viennacl::vector<SCALARTYPE, ALIGNMENT> const & input2,
                       viennacl::vector<SCALARTYPE, ALIGNMENT> & output) 
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
-            std::size_t size = input1.size() >> 1;
-            viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("fft_mult_vec");
-            viennacl::ocl::enqueue(kernel(input1, input2, output, static_cast<cl_uint>(size)));
+          switch (viennacl::traits::handle(input1).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::multiply(input1, input2, output);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+                std::size_t size = input1.size() >> 1;
+                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("fft_mult_vec");
+                viennacl::ocl::enqueue(kernel(input1, input2, output, static_cast<cl_uint>(size)));
+              break;
+            }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
 
         template<class SCALARTYPE, unsigned int ALIGNMENT>
         void normalize(viennacl::vector<SCALARTYPE, ALIGNMENT> & input) 
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
-            viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("fft_div_vec_scalar");
-            std::size_t size = input.size() >> 1;
-            SCALARTYPE norm_factor = static_cast<SCALARTYPE>(size);
-            viennacl::ocl::enqueue(kernel(input, static_cast<cl_uint>(size), norm_factor));
+          switch (viennacl::traits::handle(input).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::normalize(input);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("fft_div_vec_scalar");
+                std::size_t size = input.size() >> 1;
+                SCALARTYPE norm_factor = static_cast<SCALARTYPE>(size);
+                viennacl::ocl::enqueue(kernel(input, static_cast<cl_uint>(size), norm_factor));
+              break;
+            }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
 
         template<class SCALARTYPE, unsigned int ALIGNMENT>
         void transpose(viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> & input) 
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
-            viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("transpose_inplace");
-            viennacl::ocl::enqueue(kernel(input,
-                                          static_cast<cl_uint>(input.internal_size1()),
-                                          static_cast<cl_uint>(input.internal_size2()) >> 1));
+          switch (viennacl::traits::handle(input).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::transpose(input);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("transpose_inplace");
+                viennacl::ocl::enqueue(kernel(input,
+                                              static_cast<cl_uint>(input.internal_size1()),
+                                              static_cast<cl_uint>(input.internal_size2()) >> 1));
+              break;
+            }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
 
         template<class SCALARTYPE, unsigned int ALIGNMENT>
         void transpose(viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> const & input,
                        viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> & output)
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
-          
-            viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("transpose");
-            viennacl::ocl::enqueue(kernel(input,
-                                          output,
-                                          static_cast<cl_uint>(input.internal_size1()),
-                                          static_cast<cl_uint>(input.internal_size2() >> 1))
-                                  );
+          switch (viennacl::traits::handle(input).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::transpose(input, output);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+
+                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("transpose");
+                viennacl::ocl::enqueue(kernel(input,
+                                              output,
+                                              static_cast<cl_uint>(input.internal_size1()),
+                                              static_cast<cl_uint>(input.internal_size2() >> 1))
+                                      );
+              break;
+            }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
         
         template<class SCALARTYPE>
@@ -333,11 +463,25 @@ namespace viennacl
                              viennacl::vector_base<SCALARTYPE> & out,
                              std::size_t size) 
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
-            viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("real_to_complex");
-            viennacl::ocl::enqueue(kernel(in, out, static_cast<cl_uint>(size)));
+          switch (viennacl::traits::handle(in).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::real_to_complex(in, out, size);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("real_to_complex");
+                viennacl::ocl::enqueue(kernel(in, out, static_cast<cl_uint>(size)));
+              break;
+            }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
 
         template<class SCALARTYPE>
@@ -345,22 +489,50 @@ namespace viennacl
                              viennacl::vector_base<SCALARTYPE>& out,
                              std::size_t size)
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
-            viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("complex_to_real");
-            viennacl::ocl::enqueue(kernel(in, out, static_cast<cl_uint>(size)));
+          switch (viennacl::traits::handle(in).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::complex_to_real(in, out, size);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("complex_to_real");
+                viennacl::ocl::enqueue(kernel(in, out, static_cast<cl_uint>(size)));
+              break;
+            }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
 
         template<class SCALARTYPE>
         void reverse(viennacl::vector_base<SCALARTYPE>& in)
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
-            std::size_t size = in.size();
-            viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
-                                             .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
-                                             .get_kernel("reverse_inplace");
-            viennacl::ocl::enqueue(kernel(in, static_cast<cl_uint>(size)));
+          switch (viennacl::traits::handle(in).get_active_handle_id())
+          {
+            case viennacl::MAIN_MEMORY:
+              viennacl::linalg::host_based::fft::reverse(in);
+              break;
+#ifdef VIENNACL_WITH_OPENCL
+            case viennacl::OPENCL_MEMORY:
+            {
+              viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
+                std::size_t size = in.size();
+                viennacl::ocl::kernel& kernel = viennacl::ocl::current_context()
+                                                 .get_program(viennacl::linalg::kernels::fft<SCALARTYPE, 1>::program_name())
+                                                 .get_kernel("reverse_inplace");
+                viennacl::ocl::enqueue(kernel(in, static_cast<cl_uint>(size)));
+              break;
+            }
+#endif
+            default:
+              throw "not implemented";
+          }
         }
 
         
@@ -381,11 +553,17 @@ namespace viennacl
   {
       std::size_t size = (input.size() >> 1) / batch_num;
 
+      if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::fft::transform(input.handle(), input.handle(), size, size, batch_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
+        return;
+      }
+
       if(!detail::fft::is_radix2(size)) 
       {
           viennacl::vector<SCALARTYPE, ALIGNMENT> output(input.size());
-          detail::fft::direct(viennacl::traits::opencl_handle(input),
-                              viennacl::traits::opencl_handle(output),
+          detail::fft::direct(input.handle(),
+                              output.handle(),
                               size,
                               size,
                               batch_num,
@@ -393,7 +571,7 @@ namespace viennacl
 
           viennacl::copy(output, input);
       } else {
-          detail::fft::radix2(viennacl::traits::opencl_handle(input), size, size, batch_num, sign);
+          detail::fft::radix2(input.handle(), size, size, batch_num, sign);
       }
   }
 
@@ -414,13 +592,19 @@ namespace viennacl
   {
       std::size_t size = (input.size() >> 1) / batch_num;
 
+      if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::fft::transform(input.handle(), output.handle(), size, size, batch_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
+        return;
+      }
+
       if(detail::fft::is_radix2(size))
       {
           viennacl::copy(input, output);
-          detail::fft::radix2(viennacl::traits::opencl_handle(output), size, size, batch_num, sign);
+          detail::fft::radix2(output.handle(), size, size, batch_num, sign);
       } else {
-          detail::fft::direct(viennacl::traits::opencl_handle(input),
-                              viennacl::traits::opencl_handle(output),
+          detail::fft::direct(input.handle(),
+                              output.handle(),
                               size,
                               size,
                               batch_num,
@@ -443,17 +627,24 @@ namespace viennacl
 
       std::size_t cols_int = input.internal_size2() >> 1;
 
+      if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::fft::transform(input.handle(), input.handle(), cols_num, cols_int, rows_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
+        viennacl::linalg::host_based::fft::transform(input.handle(), input.handle(), rows_num, cols_int, cols_num, sign, detail::fft::FFT_DATA_ORDER::COL_MAJOR);
+        return;
+      }
+
       // batch with rows
       if(detail::fft::is_radix2(cols_num)) 
       {
-          detail::fft::radix2(viennacl::traits::opencl_handle(input), cols_num, cols_int, rows_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
+          detail::fft::radix2(input.handle(), cols_num, cols_int, rows_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
       } 
       else
       {
           viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> output(input.size1(), input.size2());
 
-          detail::fft::direct(viennacl::traits::opencl_handle(input),
-                              viennacl::traits::opencl_handle(output),
+          detail::fft::direct(input.handle(),
+                              output.handle(),
                               cols_num,
                               cols_int,
                               rows_num,
@@ -466,12 +657,12 @@ namespace viennacl
 
       // batch with cols
       if (detail::fft::is_radix2(rows_num)) {
-          detail::fft::radix2(viennacl::traits::opencl_handle(input), rows_num, cols_int, cols_num, sign, detail::fft::FFT_DATA_ORDER::COL_MAJOR);
+          detail::fft::radix2(input.handle(), rows_num, cols_int, cols_num, sign, detail::fft::FFT_DATA_ORDER::COL_MAJOR);
       } else {
           viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> output(input.size1(), input.size2());
 
-          detail::fft::direct(viennacl::traits::opencl_handle(input),
-                              viennacl::traits::opencl_handle(output),
+          detail::fft::direct(input.handle(),
+                              output.handle(),
                               rows_num,
                               cols_int,
                               cols_num,
@@ -500,16 +691,23 @@ namespace viennacl
 
       std::size_t cols_int = input.internal_size2() >> 1;
 
+      if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::fft::transform(input.handle(), output.handle(), cols_num, cols_int, rows_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
+        viennacl::linalg::host_based::fft::transform(output.handle(), output.handle(), rows_num, cols_int, cols_num, sign, detail::fft::FFT_DATA_ORDER::COL_MAJOR);
+        return;
+      }
+
       // batch with rows
       if(detail::fft::is_radix2(cols_num))
       {
           output = input;
-          detail::fft::radix2(viennacl::traits::opencl_handle(output), cols_num, cols_int, rows_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
+          detail::fft::radix2(output.handle(), cols_num, cols_int, rows_num, sign, detail::fft::FFT_DATA_ORDER::ROW_MAJOR);
       } 
       else
       {
-          detail::fft::direct(viennacl::traits::opencl_handle(input),
-                              viennacl::traits::opencl_handle(output),
+          detail::fft::direct(input.handle(),
+                              output.handle(),
                               cols_num,
                               cols_int,
                               rows_num,
@@ -521,15 +719,15 @@ namespace viennacl
       // batch with cols
       if(detail::fft::is_radix2(rows_num))
       {
-          detail::fft::radix2(viennacl::traits::opencl_handle(output), rows_num, cols_int, cols_num, sign, detail::fft::FFT_DATA_ORDER::COL_MAJOR);
+          detail::fft::radix2(output.handle(), rows_num, cols_int, cols_num, sign, detail::fft::FFT_DATA_ORDER::COL_MAJOR);
       } 
       else
       {
           viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> tmp(output.size1(), output.size2());
           tmp = output;
 
-          detail::fft::direct(viennacl::traits::opencl_handle(tmp),
-                              viennacl::traits::opencl_handle(output),
+          detail::fft::direct(tmp.handle(),
+                              output.handle(),
                               rows_num,
                               cols_int,
                               cols_num,
@@ -575,6 +773,128 @@ namespace viennacl
       detail::fft::normalize(output);
   }
 
+  /**
+    * @brief 1-D Fourier transformation of real data.
+    *
+    * Computes the first n/2+1 entries of the spectrum of the n real entries of 'input'. The remaining entries follow from conjugate symmetry.
+    * For even n, only a complex transformation of length n/2 is computed instead of expanding the input to n complex entries.
+    * Input and output may be vector ranges or slices.
+    *
+    * @param input      Input vector with n real entries
+    * @param output     Output vector, receives n/2+1 complex entries (interleaved). Must hold at least 2*(n/2+1) entries.
+    */
+  template<class SCALARTYPE>
+  void rfft(viennacl::vector_base<SCALARTYPE> const & input,
+            viennacl::vector_base<SCALARTYPE> & output)
+  {
+      std::size_t size = input.size();
+      assert(output.size() >= 2 * (size / 2 + 1) && bool("Output vector too small"));
+
+      switch (viennacl::traits::handle(input).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::fft::real_plan<SCALARTYPE>(size).forward(input, output);
+          break;
+        default:
+        {
+          viennacl::vector<SCALARTYPE> contiguous_input(input);   //the kernels ignore start and stride of ranges and slices
+          viennacl::vector<SCALARTYPE> tmp(2 * size);
+          viennacl::vector<SCALARTYPE> tmp2(2 * size);
+          detail::fft::real_to_complex(contiguous_input, tmp, size);
+          viennacl::fft(tmp, tmp2);
+
+          viennacl::vector_base<SCALARTYPE> spectrum(tmp2.handle(), 2 * (size / 2 + 1), 0, 1);
+          viennacl::vector_base<SCALARTYPE> output_head(output.handle(), 2 * (size / 2 + 1), output.start(), output.stride());
+          output_head = spectrum;
+        }
+      }
+  }
+
+  /**
+    * @brief Inverse 1-D Fourier transformation with real result.
+    *
+    * Computes the n real entries of 'output' from the first n/2+1 entries of their spectrum, as computed by rfft(). The result is normalized.
+    *
+    * @param input      Input vector with n/2+1 complex entries (interleaved)
+    * @param output     Output vector with n real entries
+    */
+  template<class SCALARTYPE>
+  void irfft(viennacl::vector_base<SCALARTYPE> const & input,
+             viennacl::vector_base<SCALARTYPE> & output)
+  {
+      std::size_t size = output.size();
+      assert(input.size() >= 2 * (size / 2 + 1) && bool("Input vector too small"));
+
+      switch (viennacl::traits::handle(input).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::fft::real_plan<SCALARTYPE>(size).inverse(input, output);
+          break;
+        default:
+          throw "not implemented";
+      }
+  }
+
+  /**
+    * @brief A reusable plan for batches of 1-D Fourier transformations of a fixed size and direction.
+    *
+    * For vectors in main memory, all tables required by the transformation (twiddle factors, bit-reversal permutation, Bluestein chirp spectrum) are computed
+    * when the plan is created and shared with all other plans of the same size, direction and precision. Scratch buffers are pooled, so that repeated
+    * transformations do not allocate memory. A plan can be shared by several threads. For other memory domains, the plan forwards to viennacl::fft().
+    */
+  template<class SCALARTYPE>
+  class fft_plan
+  {
+    public:
+      /** @brief Creates a plan.
+      *
+      * @param size        Number of complex entries per transformation
+      * @param batch_num   Number of transformations stored consecutively in a vector
+      * @param sign        Sign of exponent, default is -1.0 (forward transformation)
+      */
+      explicit fft_plan(std::size_t size, std::size_t batch_num = 1, SCALARTYPE sign = -1.0)
+        : size_(size), batch_num_(batch_num), sign_(sign), host_plan_(size, sign) {}
+
+      std::size_t size() const { return size_; }
+      std::size_t batch_num() const { return batch_num_; }
+      SCALARTYPE sign() const { return sign_; }
+
+      /** @brief Computes the transformation in place */
+      template<unsigned int ALIGNMENT>
+      void execute(viennacl::vector<SCALARTYPE, ALIGNMENT> & data) const
+      {
+        assert(data.size() == 2 * size_ * batch_num_ && bool("Size mismatch"));
+
+        if (viennacl::traits::handle(data).get_active_handle_id() == viennacl::MAIN_MEMORY)
+          host_plan_.execute(data.handle(), data.handle(), size_, batch_num_);
+        else
+          viennacl::inplace_fft(data, batch_num_, sign_);
+      }
+
+      /** @brief Computes the transformation of 'input' and writes the result to 'output' */
+      template<unsigned int ALIGNMENT>
+      void execute(viennacl::vector<SCALARTYPE, ALIGNMENT> const & input,
+                   viennacl::vector<SCALARTYPE, ALIGNMENT> & output) const
+      {
+        assert(input.size() == 2 * size_ * batch_num_ && bool("Size mismatch"));
+        assert(output.size() == input.size() && bool("Size mismatch"));
+
+        if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+          host_plan_.execute(input.handle(), output.handle(), size_, batch_num_);
+        else
+        {
+          output = input;
+          viennacl::inplace_fft(output, batch_num_, sign_);
+        }
+      }
+
+    private:
+      std::size_t size_;
+      std::size_t batch_num_;
+      SCALARTYPE sign_;
+      viennacl::linalg::host_based::fft::plan<SCALARTYPE> host_plan_;
+  };
+
   namespace linalg
   {
     /**
@@ -610,6 +930,50 @@ namespace viennacl
         viennacl::ifft(tmp3, output);
     }
 
+    /**
+      * @brief Cyclic 1-D convolution of two real vectors.
+      *
+      * For data in main memory, the convolution is computed with transformations of real data of half length,
+      * otherwise the inputs are expanded to complex vectors and convolve() is used.
+      *
+      * @param input1     Input vector #1.
+      * @param input2     Input vector #2.
+      * @param output     Output vector. May coincide with any of the input vectors.
+      */
+    template<class SCALARTYPE>
+    void real_convolve(viennacl::vector_base<SCALARTYPE> const & input1,
+                       viennacl::vector_base<SCALARTYPE> const & input2,
+                       viennacl::vector_base<SCALARTYPE> & output)
+    {
+        assert(input1.size() == input2.size());
+        assert(input1.size() == output.size());
+
+        std::size_t size = input1.size();
+
+        switch (viennacl::traits::handle(input1).get_active_handle_id())
+        {
+          case viennacl::MAIN_MEMORY:
+            viennacl::linalg::host_based::fft::real_plan<SCALARTYPE>(size).convolve(input1, input2, output);
+            break;
+          default:
+          {
+            // the kernels ignore start and stride of ranges and slices, hence contiguous copies are used:
+            viennacl::vector<SCALARTYPE> contiguous_input1(input1);
+            viennacl::vector<SCALARTYPE> contiguous_input2(input2);
+            viennacl::vector<SCALARTYPE> contiguous_output(size);
+            viennacl::vector<SCALARTYPE> tmp1(2 * size);
+            viennacl::vector<SCALARTYPE> tmp2(2 * size);
+            viennacl::vector<SCALARTYPE> tmp3(2 * size);
+
+            viennacl::detail::fft::real_to_complex(contiguous_input1, tmp1, size);
+            viennacl::detail::fft::real_to_complex(contiguous_input2, tmp2, size);
+            viennacl::linalg::convolve(tmp1, tmp2, tmp3);
+            viennacl::detail::fft::complex_to_real(tmp3, contiguous_output, size);
+            output = contiguous_output;
+          }
+        }
+    }
+
     /**
       * @brief 1-D convolution of two vectors.
       *
@@ -112,6 +112,9 @@ namespace viennacl
   
   template<class SCALARTYPE, unsigned int ALIGNMENT = 1>
   class vector;
+
+  template<typename SCALARTYPE>
+  class vector_tuple;
   
   //the following forwards are needed for GMRES
   template <typename SCALARTYPE, unsigned int ALIGNMENT, typename CPU_ITERATOR>
@@ -202,6 +205,12 @@ namespace viennacl
 
   template<class SCALARTYPE, unsigned int ALIGNMENT = 1>
   class hyb_matrix;
+
+  template<class SCALARTYPE>
+  class out_of_core_compressed_matrix;
+
+  template<class SCALARTYPE, typename F = row_major>
+  class batched_matrix;
   
   template<class SCALARTYPE, unsigned int ALIGNMENT = 1>
   class circulant_matrix;
@@ -564,7 +573,15 @@ namespace viennacl
     namespace fft
     {
       /** @brief Helper namespace for fast-Fourier transformation. Deprecated. */
-      namespace FFT_DATA_ORDER {}
+      namespace FFT_DATA_ORDER
+      {
+        /** @brief Layout of a batch of transforms: ROW_MAJOR stores each transform contiguously, COL_MAJOR interleaves the transforms */
+        enum DATA_ORDER
+        {
+          ROW_MAJOR,
+          COL_MAJOR
+        };
+      }
     }
   }
   
@@ -589,7 +606,10 @@ namespace viennacl
   namespace io 
   {
     /** @brief Implementation details for IO functionality. Usually not of interest for a library user. */
-    namespace detail {}
+    namespace detail
+    {
+      class binary_object_access;
+    }
     
     /** @brief Namespace holding the various XML tag definitions for the kernel parameter tuning facility. */
     namespace tag {}
@@ -25,7 +25,6 @@
 
 #include "viennacl/forwards.h"
 #include "viennacl/vector.hpp"
-#include "viennacl/ocl/context.hpp"
 
 #include "viennacl/toeplitz_matrix.hpp"
 #include "viennacl/fft.hpp"
@@ -51,7 +50,6 @@ namespace viennacl {
          */
         explicit hankel_matrix()
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
 
         /**
@@ -63,7 +61,6 @@ namespace viennacl {
         explicit hankel_matrix(std::size_t rows, std::size_t cols) : elements_(rows, cols)
         {
           assert(rows == cols && bool("Hankel matrix must be square!"));
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
 
         /** @brief Resizes the matrix.
@@ -77,11 +74,11 @@ namespace viennacl {
             elements_.resize(sz, preserve);
         }
 
-        /** @brief Returns the OpenCL handle
+        /** @brief Returns the memory handle
         *
-        *   @return OpenCL handle
+        *   @return Memory handle
         */
-        viennacl::ocl::handle<cl_mem> handle() const { return elements_.handle(); }
+        handle_type const & handle() const { return elements_.handle(); }
 
         /**
          * @brief Returns an internal viennacl::toeplitz_matrix, which represents a Hankel matrix elements
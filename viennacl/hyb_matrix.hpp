@@ -75,6 +75,8 @@ namespace viennacl
         friend void copy(const CPU_MATRIX & cpu_matrix, hyb_matrix<T, ALIGN> & gpu_matrix );
       #endif
         
+        friend class viennacl::io::detail::binary_object_access;
+
       private:
         SCALARTYPE  csr_threshold_;
         std::size_t rows_;
@@ -0,0 +1,1054 @@
+#ifndef VIENNACL_IO_BINARY_HPP
+#define VIENNACL_IO_BINARY_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** @file binary.hpp
+    @brief A native binary file format for ViennaCL vectors, dense matrices and sparse matrices.
+
+    A file consists of a header block followed by the raw arrays of the object (e.g. row pointers, column indices and values of a compressed_matrix).
+    Each array starts at a multiple of the header block size, so that a memory mapped file can be used directly as the buffer of the cpu_ram backend.
+*/
+
+#include <algorithm>
+#include <string>
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include "viennacl/forwards.h"
+#include "viennacl/backend/memory.hpp"
+#include "viennacl/tools/tools.hpp"
+#include "viennacl/tools/shared_ptr.hpp"
+#include "viennacl/tools/large_file.hpp"
+#include "viennacl/meta/predicate.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/coordinate_matrix.hpp"
+#include "viennacl/ell_matrix.hpp"
+#include "viennacl/hyb_matrix.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define VIENNACL_IO_BINARY_WITH_MMAP
+#endif
+
+namespace viennacl
+{
+  namespace io
+  {
+    namespace detail
+    {
+      /** @brief Identifiers for the objects stored in a binary file */
+      enum binary_object_type
+      {
+        BINARY_VECTOR = 1,
+        BINARY_MATRIX,
+        BINARY_COMPRESSED_MATRIX,
+        BINARY_COORDINATE_MATRIX,
+        BINARY_ELL_MATRIX,
+        BINARY_HYB_MATRIX
+      };
+
+      static const char        binary_magic[8]       = { 'V', 'I', 'E', 'N', 'N', 'A', 'C', 'L' };
+      static const std::size_t binary_version        = 1;
+      static const std::size_t binary_block_size     = 4096;     //size of the header and alignment of each array in the file
+      static const std::size_t binary_max_arrays     = 5;
+      static const unsigned int binary_byte_order    = 0x01020304;
+
+      /** @brief The header of a binary file. Integers are stored as 64-bit little endian words, arrays are stored in the native byte order (which is recorded in the header). */
+      struct binary_header
+      {
+        binary_header() : version(binary_version), object_type(0), scalar_size(0), index_size(sizeof(unsigned int)), alignment(1), row_major(0),
+                          size1(0), size2(0), nnz(0), param1(0), param2(0), value(0), num_arrays(0)
+        {
+          for (std::size_t i=0; i<binary_max_arrays; ++i)
+          {
+            array_offset[i] = 0;
+            array_bytes[i] = 0;
+          }
+        }
+
+        std::size_t version;
+        std::size_t object_type;
+        std::size_t scalar_size;
+        std::size_t index_size;
+        std::size_t alignment;
+        std::size_t row_major;
+        std::size_t size1;
+        std::size_t size2;
+        std::size_t nnz;
+        std::size_t param1;      //maximum number of nonzeros per row for ELL, number of groups for coordinate_matrix
+        std::size_t param2;      //number of CSR nonzeros for HYB
+        double      value;       //CSR threshold for HYB
+        std::size_t num_arrays;
+        std::size_t array_offset[binary_max_arrays];
+        std::size_t array_bytes[binary_max_arrays];
+      };
+
+      inline void encode_word(char * buffer, std::size_t & pos, std::size_t value)
+      {
+        for (std::size_t i=0; i<8; ++i)
+        {
+          buffer[pos++] = static_cast<char>(value & 0xFF);
+          value >>= 8;
+        }
+      }
+
+      inline std::size_t decode_word(const char * buffer, std::size_t & pos)
+      {
+        std::size_t value = 0;
+        for (std::size_t i=8; i>0; --i)
+          value = (value << 8) | static_cast<unsigned char>(buffer[pos + i - 1]);
+        pos += 8;
+        return value;
+      }
+
+      /** @brief Writes the header to a buffer of size binary_block_size */
+      inline void encode_header(binary_header const & header, char * buffer)
+      {
+        std::memset(buffer, 0, binary_block_size);
+        std::memcpy(buffer, binary_magic, 8);
+        std::memcpy(buffer + 8, &binary_byte_order, sizeof(unsigned int));
+
+        std::size_t pos = 16;
+        encode_word(buffer, pos, header.version);
+        encode_word(buffer, pos, header.object_type);
+        encode_word(buffer, pos, header.scalar_size);
+        encode_word(buffer, pos, header.index_size);
+        encode_word(buffer, pos, header.alignment);
+        encode_word(buffer, pos, header.row_major);
+        encode_word(buffer, pos, header.size1);
+        encode_word(buffer, pos, header.size2);
+        encode_word(buffer, pos, header.nnz);
+        encode_word(buffer, pos, header.param1);
+        encode_word(buffer, pos, header.param2);
+        std::memcpy(buffer + pos, &header.value, sizeof(double)); pos += 8;
+        encode_word(buffer, pos, header.num_arrays);
+        for (std::size_t i=0; i<binary_max_arrays; ++i)
+        {
+          encode_word(buffer, pos, header.array_offset[i]);
+          encode_word(buffer, pos, header.array_bytes[i]);
+        }
+      }
+
+      /** @brief Reads the header from a buffer of size binary_block_size and checks it for consistency. Returns false if the header is invalid. */
+      inline bool decode_header(const char * buffer, std::size_t file_size, binary_header & header)
+      {
+        if (std::memcmp(buffer, binary_magic, 8) != 0)
+        {
+          std::cerr << "ViennaCL: Error in binary reader: Not a ViennaCL binary file" << std::endl;
+          return false;
+        }
+
+        unsigned int byte_order;
+        std::memcpy(&byte_order, buffer + 8, sizeof(unsigned int));
+        if (byte_order != binary_byte_order)
+        {
+          std::cerr << "ViennaCL: Error in binary reader: File was written on a machine with different byte order" << std::endl;
+          return false;
+        }
+
+        std::size_t pos = 16;
+        header.version     = decode_word(buffer, pos);
+        header.object_type = decode_word(buffer, pos);
+        header.scalar_size = decode_word(buffer, pos);
+        header.index_size  = decode_word(buffer, pos);
+        header.alignment   = decode_word(buffer, pos);
+        header.row_major   = decode_word(buffer, pos);
+        header.size1       = decode_word(buffer, pos);
+        header.size2       = decode_word(buffer, pos);
+        header.nnz         = decode_word(buffer, pos);
+        header.param1      = decode_word(buffer, pos);
+        header.param2      = decode_word(buffer, pos);
+        std::memcpy(&header.value, buffer + pos, sizeof(double)); pos += 8;
+        header.num_arrays  = decode_word(buffer, pos);
+        for (std::size_t i=0; i<binary_max_arrays; ++i)
+        {
+          header.array_offset[i] = decode_word(buffer, pos);
+          header.array_bytes[i]  = decode_word(buffer, pos);
+        }
+
+        if (header.version != binary_version)
+        {
+          std::cerr << "ViennaCL: Error in binary reader: Unsupported file version " << header.version << std::endl;
+          return false;
+        }
+
+        if (header.index_size != sizeof(unsigned int))
+        {
+          std::cerr << "ViennaCL: Error in binary reader: Unsupported index size " << header.index_size << std::endl;
+          return false;
+        }
+
+        if (header.scalar_size != sizeof(float) && header.scalar_size != sizeof(double))
+        {
+          std::cerr << "ViennaCL: Error in binary reader: Unsupported scalar size " << header.scalar_size << std::endl;
+          return false;
+        }
+
+        if (header.num_arrays > binary_max_arrays || header.alignment == 0)
+        {
+          std::cerr << "ViennaCL: Error in binary reader: Invalid file header" << std::endl;
+          return false;
+        }
+
+        for (std::size_t i=0; i<header.num_arrays; ++i)
+        {
+          if (header.array_offset[i] % binary_block_size != 0 || header.array_offset[i] > file_size || header.array_bytes[i] > file_size - header.array_offset[i])
+          {
+            std::cerr << "ViennaCL: Error in binary reader: File is truncated or corrupt" << std::endl;
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+
+      /** @brief An array of an object to be written to a binary file */
+      struct binary_array
+      {
+        binary_array() : handle(NULL), bytes(0) {}
+        binary_array(viennacl::backend::mem_handle const & h, std::size_t num_bytes) : handle(&h), bytes(num_bytes) {}
+
+        viennacl::backend::mem_handle const * handle;
+        std::size_t bytes;
+      };
+
+      /** @brief Writes the header and the arrays to the file. Array offsets in the header are filled in here. */
+      inline bool write_binary_file(std::string const & filename, binary_header & header, std::vector<binary_array> const & arrays)
+      {
+        header.num_arrays = arrays.size();
+        std::size_t offset = binary_block_size;
+        for (std::size_t i=0; i<arrays.size(); ++i)
+        {
+          header.array_offset[i] = offset;
+          header.array_bytes[i]  = arrays[i].bytes;
+          offset += viennacl::tools::roundUpToNextMultiple<std::size_t>(arrays[i].bytes, binary_block_size);
+        }
+
+        std::FILE * file = std::fopen(filename.c_str(), "wb");
+        if (!file)
+        {
+          std::cerr << "ViennaCL: Error in binary writer: Cannot open file " << filename << std::endl;
+          return false;
+        }
+
+        std::vector<char> block(binary_block_size);
+        encode_header(header, &(block[0]));
+        bool success = (std::fwrite(&(block[0]), 1, binary_block_size, file) == binary_block_size);
+
+        std::vector<char> host_buffer;
+        std::fill(block.begin(), block.end(), 0);
+        for (std::size_t i=0; success && i<arrays.size(); ++i)
+        {
+          viennacl::backend::mem_handle const & handle = *(arrays[i].handle);
+          std::size_t bytes = std::min(arrays[i].bytes, handle.raw_size());   //missing trailing bytes are written as zeros
+
+          const char * data = NULL;
+          if (bytes > 0 && handle.get_active_handle_id() == viennacl::MAIN_MEMORY)
+            data = handle.ram_handle().get();
+          else if (bytes > 0)
+          {
+            host_buffer.resize(bytes);
+            viennacl::backend::memory_read(handle, 0, bytes, &(host_buffer[0]));
+            data = &(host_buffer[0]);
+          }
+
+          if (bytes > 0)
+            success = (std::fwrite(data, 1, bytes, file) == bytes);
+
+          std::size_t padding = viennacl::tools::roundUpToNextMultiple<std::size_t>(arrays[i].bytes, binary_block_size) - bytes;
+          while (success && padding > 0)
+          {
+            std::size_t chunk = std::min(padding, binary_block_size);
+            success = (std::fwrite(&(block[0]), 1, chunk, file) == chunk);
+            padding -= chunk;
+          }
+        }
+
+        if (std::fclose(file) != 0)
+          success = false;
+
+        if (!success)
+          std::cerr << "ViennaCL: Error in binary writer: Failed to write file " << filename << std::endl;
+        return success;
+      }
+
+
+      /** @brief A file mapped into memory. Pages are mapped copy-on-write, so objects using them can be modified without altering the file. */
+      class mapped_file_region
+      {
+        public:
+          mapped_file_region(void * ptr, std::size_t size) : ptr_(ptr), size_(size) {}
+          ~mapped_file_region()
+          {
+#ifdef VIENNACL_IO_BINARY_WITH_MMAP
+            ::munmap(ptr_, size_);
+#endif
+          }
+
+          char * data() const { return static_cast<char *>(ptr_); }
+
+        private:
+          mapped_file_region(mapped_file_region const &);
+          mapped_file_region & operator=(mapped_file_region const &);
+
+          void * ptr_;
+          std::size_t size_;
+      };
+
+      /** @brief Deleter for cpu_ram handles pointing into a mapped file. The mapping is released together with the last handle referring to it. */
+      struct mapped_file_deleter
+      {
+        mapped_file_deleter(viennacl::tools::shared_ptr<mapped_file_region> const & region) : region_(region) {}
+
+        void operator()(char *) const {}
+
+        viennacl::tools::shared_ptr<mapped_file_region> region_;
+      };
+
+      /** @brief Reads the header and the arrays of a binary file, either through a memory map or through buffered reads */
+      class binary_file_reader
+      {
+        public:
+          binary_file_reader(std::string const & filename, bool use_memory_map) : file_(NULL), good_(false)
+          {
+            std::size_t file_size = 0;
+#ifdef VIENNACL_IO_BINARY_WITH_MMAP
+            if (use_memory_map)
+            {
+              int fd = ::open(filename.c_str(), O_RDONLY);
+              struct stat file_status;
+              if (fd >= 0 && ::fstat(fd, &file_status) == 0 && file_status.st_size > 0)
+              {
+                file_size = static_cast<std::size_t>(file_status.st_size);
+                void * ptr = ::mmap(NULL, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                if (ptr != MAP_FAILED)
+                  mapping_ = viennacl::tools::shared_ptr<mapped_file_region>(new mapped_file_region(ptr, file_size));
+              }
+              if (fd >= 0)
+                ::close(fd);
+            }
+#else
+            (void)use_memory_map;
+#endif
+
+            std::vector<char> block(binary_block_size);
+            if (mapping_.get())
+            {
+              if (file_size < binary_block_size)
+              {
+                std::cerr << "ViennaCL: Error in binary reader: File " << filename << " is too short" << std::endl;
+                return;
+              }
+              std::memcpy(&(block[0]), mapping_->data(), binary_block_size);
+            }
+            else
+            {
+              file_ = std::fopen(filename.c_str(), "rb");
+              if (!file_)
+              {
+                std::cerr << "ViennaCL: Error in binary reader: Cannot open file " << filename << std::endl;
+                return;
+              }
+              if (!viennacl::tools::file_size(file_, file_size))
+              {
+                std::cerr << "ViennaCL: Error in binary reader: Cannot determine the size of file " << filename << std::endl;
+                return;
+              }
+
+              if (std::fread(&(block[0]), 1, binary_block_size, file_) != binary_block_size)
+              {
+                std::cerr << "ViennaCL: Error in binary reader: File " << filename << " is too short" << std::endl;
+                return;
+              }
+            }
+
+            good_ = decode_header(&(block[0]), file_size, header_);
+          }
+
+          ~binary_file_reader()
+          {
+            if (file_)
+              std::fclose(file_);
+          }
+
+          bool good() const { return good_; }
+          binary_header const & header() const { return header_; }
+
+          /** @brief Checks that the file holds an object of the expected type with the expected number of arrays */
+          bool check_object(std::size_t object_type, std::size_t num_arrays) const
+          {
+            if (header_.object_type != object_type || header_.num_arrays != num_arrays)
+            {
+              std::cerr << "ViennaCL: Error in binary reader: File holds a different type of object" << std::endl;
+              return false;
+            }
+            return true;
+          }
+
+          /** @brief Copies the first 'bytes' bytes of array i to 'dest'. If the array is shorter, the remaining bytes are set to zero. */
+          bool read(std::size_t i, void * dest, std::size_t bytes)
+          {
+            std::size_t available = std::min(bytes, header_.array_bytes[i]);
+            char * dest_char = static_cast<char *>(dest);
+            if (mapping_.get())
+              std::memcpy(dest_char, mapping_->data() + header_.array_offset[i], available);
+            else
+            {
+              if (   !viennacl::tools::seek_file(file_, header_.array_offset[i])
+                  || std::fread(dest_char, 1, available, file_) != available)
+              {
+                std::cerr << "ViennaCL: Error in binary reader: Failed to read array data" << std::endl;
+                return false;
+              }
+            }
+            std::memset(dest_char + available, 0, bytes - available);
+            return true;
+          }
+
+          /** @brief Reads 'count' scalars from array i into 'dest', converting from the scalar type stored in the file if necessary */
+          template <typename ScalarType>
+          bool read_scalars(std::size_t i, ScalarType * dest, std::size_t count)
+          {
+            if (header_.scalar_size == sizeof(ScalarType))
+              return read(i, dest, sizeof(ScalarType) * count);
+
+            if (header_.scalar_size == sizeof(float))
+              return read_converted<float>(i, dest, count);
+            return read_converted<double>(i, dest, count);
+          }
+
+          /** @brief Sets up the buffer 'handle' in the memory domain 'domain' with the first 'bytes' bytes of array i.
+          *
+          * If the file is memory mapped and the buffer resides in main memory, the handle refers to the mapped pages directly and no data is copied.
+          */
+          bool install(std::size_t i, viennacl::backend::mem_handle & handle, std::size_t bytes, viennacl::memory_types domain)
+          {
+            if (bytes == 0)
+              return true;
+
+            handle.switch_active_handle_id(domain);
+            if (mapping_.get() && domain == viennacl::MAIN_MEMORY && header_.array_bytes[i] >= bytes)
+            {
+              handle.ram_handle() = viennacl::backend::cpu_ram::handle_type(mapping_->data() + header_.array_offset[i], mapped_file_deleter(mapping_));
+              handle.raw_size(bytes);
+              return true;
+            }
+            if (domain == viennacl::MAIN_MEMORY)
+            {
+              viennacl::backend::memory_create(handle, bytes);
+              return read(i, handle.ram_handle().get(), bytes);
+            }
+
+            std::vector<char> buffer(bytes);
+            if (!read(i, &(buffer[0]), bytes))
+              return false;
+            viennacl::backend::memory_create(handle, bytes, &(buffer[0]));
+            return true;
+          }
+
+          /** @brief Same as install(), but converts the values if the file holds a different scalar type */
+          template <typename ScalarType>
+          bool install_scalars(std::size_t i, viennacl::backend::mem_handle & handle, std::size_t count, viennacl::memory_types domain)
+          {
+            if (header_.scalar_size == sizeof(ScalarType))
+              return install(i, handle, sizeof(ScalarType) * count, domain);
+
+            if (count == 0)
+              return true;
+
+            std::vector<ScalarType> buffer(count);
+            if (!read_scalars(i, &(buffer[0]), count))
+              return false;
+            handle.switch_active_handle_id(domain);
+            viennacl::backend::memory_create(handle, sizeof(ScalarType) * count, &(buffer[0]));
+            return true;
+          }
+
+        private:
+          binary_file_reader(binary_file_reader const &);
+          binary_file_reader & operator=(binary_file_reader const &);
+
+          template <typename FileScalarType, typename ScalarType>
+          bool read_converted(std::size_t i, ScalarType * dest, std::size_t count)
+          {
+            if (count == 0)
+              return true;
+
+            std::vector<FileScalarType> buffer(count);
+            if (!read(i, &(buffer[0]), sizeof(FileScalarType) * count))
+              return false;
+            for (std::size_t k=0; k<count; ++k)
+              dest[k] = static_cast<ScalarType>(buffer[k]);
+            return true;
+          }
+
+          std::FILE * file_;
+          viennacl::tools::shared_ptr<mapped_file_region> mapping_;    //empty if the file is not memory mapped
+          binary_header header_;
+          bool good_;
+      };
+
+
+      /** @brief Returns the memory domain the buffers of an object are loaded into */
+      inline viennacl::memory_types target_memory_domain(viennacl::backend::mem_handle const & handle)
+      {
+        if (handle.get_active_handle_id() == viennacl::MEMORY_NOT_INITIALIZED)
+          return viennacl::backend::default_memory_type();
+        return handle.get_active_handle_id();
+      }
+
+      /** @brief Loads the ELL part of an ell_matrix or hyb_matrix. Entries are repacked if the file was written with a different alignment. */
+      template <typename ScalarType>
+      bool load_ell_arrays(binary_file_reader & reader,
+                           std::size_t coords_index, viennacl::backend::mem_handle & coords,
+                           std::size_t elements_index, viennacl::backend::mem_handle & elements,
+                           std::size_t rows, std::size_t ellnnz, std::size_t alignment,
+                           viennacl::memory_types domain)
+      {
+        std::size_t file_internal_rows   = viennacl::tools::roundUpToNextMultiple<std::size_t>(rows,   reader.header().alignment);
+        std::size_t file_internal_ellnnz = viennacl::tools::roundUpToNextMultiple<std::size_t>(ellnnz, reader.header().alignment);
+        std::size_t internal_rows        = viennacl::tools::roundUpToNextMultiple<std::size_t>(rows,   alignment);
+        std::size_t internal_ellnnz      = viennacl::tools::roundUpToNextMultiple<std::size_t>(ellnnz, alignment);
+
+        if (file_internal_rows == internal_rows && file_internal_ellnnz == internal_ellnnz)
+          return reader.install(coords_index, coords, sizeof(unsigned int) * internal_rows * internal_ellnnz, domain)
+              && reader.install_scalars<ScalarType>(elements_index, elements, internal_rows * internal_ellnnz, domain);
+
+        std::vector<unsigned int> file_coords(file_internal_rows * file_internal_ellnnz);
+        std::vector<ScalarType>   file_elements(file_internal_rows * file_internal_ellnnz);
+        if (file_coords.size() > 0 && (   !reader.read(coords_index, &(file_coords[0]), sizeof(unsigned int) * file_coords.size())
+                                       || !reader.read_scalars(elements_index, &(file_elements[0]), file_elements.size())))
+          return false;
+
+        std::vector<unsigned int> new_coords(internal_rows * internal_ellnnz);
+        std::vector<ScalarType>   new_elements(internal_rows * internal_ellnnz);
+        for (std::size_t k=0; k<ellnnz; ++k)
+        {
+          for (std::size_t row=0; row<rows; ++row)
+          {
+            new_coords[k * internal_rows + row]   = file_coords[k * file_internal_rows + row];
+            new_elements[k * internal_rows + row] = file_elements[k * file_internal_rows + row];
+          }
+        }
+
+        if (new_coords.size() > 0)
+        {
+          coords.switch_active_handle_id(domain);
+          elements.switch_active_handle_id(domain);
+          viennacl::backend::memory_create(coords,   sizeof(unsigned int) * new_coords.size(), &(new_coords[0]));
+          viennacl::backend::memory_create(elements, sizeof(ScalarType) * new_elements.size(), &(new_elements[0]));
+        }
+        return true;
+      }
+
+
+      /** @brief Provides access to the internals of ViennaCL types when loading them from a binary file. Declared as friend in the respective classes. */
+      class binary_object_access
+      {
+        public:
+
+          template <typename ScalarType, unsigned int ALIGNMENT>
+          static bool load(binary_file_reader & reader, viennacl::vector<ScalarType, ALIGNMENT> & vec)
+          {
+            if (!reader.check_object(BINARY_VECTOR, 1))
+              return false;
+
+            std::size_t size = reader.header().size1;
+            viennacl::backend::mem_handle elements;
+            if (!reader.install_scalars<ScalarType>(0, elements, size, target_memory_domain(vec.elements_)))
+              return false;
+
+            vec.size_     = size;
+            vec.start_    = 0;
+            vec.stride_   = 1;
+            vec.elements_ = elements;
+            return true;
+          }
+
+          template <typename ScalarType, typename F, unsigned int ALIGNMENT>
+          static bool load(binary_file_reader & reader, viennacl::matrix<ScalarType, F, ALIGNMENT> & mat)
+          {
+            if (!reader.check_object(BINARY_MATRIX, 1))
+              return false;
+
+            std::size_t rows = reader.header().size1;
+            std::size_t cols = reader.header().size2;
+            viennacl::memory_types domain = target_memory_domain(mat.elements_);
+            viennacl::backend::mem_handle elements;
+
+            if ((reader.header().row_major != 0) == static_cast<bool>(viennacl::is_row_major<F>::value))
+            {
+              if (!reader.install_scalars<ScalarType>(0, elements, rows * cols, domain))
+                return false;
+            }
+            else if (rows * cols > 0) //storage layout differs, so entries need to be transposed
+            {
+              std::vector<ScalarType> file_entries(rows * cols);
+              if (!reader.read_scalars(0, &(file_entries[0]), file_entries.size()))
+                return false;
+
+              std::vector<ScalarType> entries(rows * cols);
+              for (std::size_t i=0; i<rows; ++i)
+                for (std::size_t j=0; j<cols; ++j)
+                  entries[F::mem_index(i, j, rows, cols)] = (reader.header().row_major != 0) ? file_entries[i * cols + j] : file_entries[i + j * rows];
+
+              elements.switch_active_handle_id(domain);
+              viennacl::backend::memory_create(elements, sizeof(ScalarType) * entries.size(), &(entries[0]));
+            }
+
+            mat.size1_ = rows;
+            mat.size2_ = cols;
+            mat.start1_ = 0;
+            mat.start2_ = 0;
+            mat.stride1_ = 1;
+            mat.stride2_ = 1;
+            mat.internal_size1_ = rows;
+            mat.internal_size2_ = cols;
+            mat.elements_ = elements;
+            return true;
+          }
+
+          template <typename ScalarType, unsigned int ALIGNMENT>
+          static bool load(binary_file_reader & reader, viennacl::compressed_matrix<ScalarType, ALIGNMENT> & mat)
+          {
+            if (!reader.check_object(BINARY_COMPRESSED_MATRIX, 3))
+              return false;
+
+            binary_header const & header = reader.header();
+            viennacl::memory_types domain = target_memory_domain(mat.row_buffer_);
+            viennacl::backend::mem_handle row_buffer;
+            viennacl::backend::mem_handle col_buffer;
+            viennacl::backend::mem_handle elements;
+
+            if (   !reader.install(0, row_buffer, (header.size1 > 0) ? sizeof(unsigned int) * (header.size1 + 1) : 0, domain)
+                || !reader.install(1, col_buffer, sizeof(unsigned int) * header.nnz, domain)
+                || !reader.install_scalars<ScalarType>(2, elements, header.nnz, domain))
+              return false;
+
+            mat.rows_       = header.size1;
+            mat.cols_       = header.size2;
+            mat.nonzeros_   = header.nnz;
+            mat.row_buffer_ = row_buffer;
+            mat.col_buffer_ = col_buffer;
+            mat.elements_   = elements;
+            return true;
+          }
+
+          template <typename ScalarType, unsigned int ALIGNMENT>
+          static bool load(binary_file_reader & reader, viennacl::coordinate_matrix<ScalarType, ALIGNMENT> & mat)
+          {
+            if (!reader.check_object(BINARY_COORDINATE_MATRIX, 3))
+              return false;
+
+            binary_header const & header = reader.header();
+            std::size_t internal_nnz = viennacl::tools::roundUpToNextMultiple<std::size_t>(header.nnz, ALIGNMENT);
+            viennacl::memory_types domain = target_memory_domain(mat.coord_buffer_);
+            viennacl::backend::mem_handle coord_buffer;
+            viennacl::backend::mem_handle elements;
+            viennacl::backend::mem_handle group_boundaries;
+
+            if (   !reader.install(0, coord_buffer, sizeof(unsigned int) * 2 * internal_nnz, domain)
+                || !reader.install_scalars<ScalarType>(1, elements, internal_nnz, domain)
+                || !reader.install(2, group_boundaries, (header.param1 > 0) ? sizeof(unsigned int) * (header.param1 + 1) : 0, domain))
+              return false;
+
+            mat.rows_             = header.size1;
+            mat.cols_             = header.size2;
+            mat.nonzeros_         = header.nnz;
+            mat.group_num_        = header.param1;
+            mat.coord_buffer_     = coord_buffer;
+            mat.elements_         = elements;
+            mat.group_boundaries_ = group_boundaries;
+            return true;
+          }
+
+          template <typename ScalarType, unsigned int ALIGNMENT>
+          static bool load(binary_file_reader & reader, viennacl::ell_matrix<ScalarType, ALIGNMENT> & mat)
+          {
+            if (!reader.check_object(BINARY_ELL_MATRIX, 2))
+              return false;
+
+            binary_header const & header = reader.header();
+            viennacl::backend::mem_handle coords;
+            viennacl::backend::mem_handle elements;
+
+            if (!load_ell_arrays<ScalarType>(reader, 0, coords, 1, elements, header.size1, header.param1, ALIGNMENT, target_memory_domain(mat.elements_)))
+              return false;
+
+            mat.rows_     = header.size1;
+            mat.cols_     = header.size2;
+            mat.maxnnz_   = header.param1;
+            mat.coords_   = coords;
+            mat.elements_ = elements;
+            return true;
+          }
+
+          template <typename ScalarType, unsigned int ALIGNMENT>
+          static bool load(binary_file_reader & reader, viennacl::hyb_matrix<ScalarType, ALIGNMENT> & mat)
+          {
+            if (!reader.check_object(BINARY_HYB_MATRIX, 5))
+              return false;
+
+            binary_header const & header = reader.header();
+            viennacl::memory_types domain = target_memory_domain(mat.ell_elements_);
+            viennacl::backend::mem_handle ell_coords;
+            viennacl::backend::mem_handle ell_elements;
+            viennacl::backend::mem_handle csr_rows;
+            viennacl::backend::mem_handle csr_cols;
+            viennacl::backend::mem_handle csr_elements;
+
+            if (   !load_ell_arrays<ScalarType>(reader, 0, ell_coords, 1, ell_elements, header.size1, header.param1, ALIGNMENT, domain)
+                || !reader.install(2, csr_rows, (header.size1 > 0) ? sizeof(unsigned int) * (header.size1 + 1) : 0, domain)
+                || !reader.install(3, csr_cols, sizeof(unsigned int) * header.param2, domain)
+                || !reader.install_scalars<ScalarType>(4, csr_elements, header.param2, domain))
+              return false;
+
+            mat.csr_threshold_ = static_cast<ScalarType>(header.value);
+            mat.rows_          = header.size1;
+            mat.cols_          = header.size2;
+            mat.ellnnz_        = header.param1;
+            mat.csrnnz_        = header.param2;
+            mat.ell_coords_    = ell_coords;
+            mat.ell_elements_  = ell_elements;
+            mat.csr_rows_      = csr_rows;
+            mat.csr_cols_      = csr_cols;
+            mat.csr_elements_  = csr_elements;
+            return true;
+          }
+      };
+
+      template <typename ScalarType>
+      binary_header make_binary_header(std::size_t object_type, std::size_t alignment, std::size_t size1, std::size_t size2, std::size_t nnz)
+      {
+        binary_header header;
+        header.object_type = object_type;
+        header.scalar_size = sizeof(ScalarType);
+        header.alignment   = alignment;
+        header.size1       = size1;
+        header.size2       = size2;
+        header.nnz         = nnz;
+        return header;
+      }
+
+      template <typename ObjectType>
+      bool load_binary_file(ObjectType & obj, std::string const & filename, bool use_memory_map)
+      {
+        binary_file_reader reader(filename, use_memory_map);
+        if (!reader.good())
+          return false;
+        return binary_object_access::load(reader, obj);
+      }
+
+    } //namespace detail
+
+
+    /** @brief Writes a vector to a file in the ViennaCL binary format
+    *
+    * @param vec        The vector to be written
+    * @param filename   Name of the file
+    * @return           True on success
+    */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool save(viennacl::vector<ScalarType, ALIGNMENT> const & vec, std::string const & filename)
+    {
+      detail::binary_header header = detail::make_binary_header<ScalarType>(detail::BINARY_VECTOR, ALIGNMENT, vec.size(), 1, vec.size());
+      std::vector<detail::binary_array> arrays;
+      arrays.push_back(detail::binary_array(vec.handle(), sizeof(ScalarType) * vec.size()));
+      return detail::write_binary_file(filename, header, arrays);
+    }
+
+    /** @brief Writes a dense matrix to a file in the ViennaCL binary format. The storage layout is preserved. */
+    template <typename ScalarType, typename F, unsigned int ALIGNMENT>
+    bool save(viennacl::matrix<ScalarType, F, ALIGNMENT> const & mat, std::string const & filename)
+    {
+      detail::binary_header header = detail::make_binary_header<ScalarType>(detail::BINARY_MATRIX, ALIGNMENT, mat.size1(), mat.size2(), mat.size1() * mat.size2());
+      header.row_major = viennacl::is_row_major<F>::value ? 1 : 0;
+      std::vector<detail::binary_array> arrays;
+      arrays.push_back(detail::binary_array(mat.handle(), sizeof(ScalarType) * mat.internal_size()));
+      return detail::write_binary_file(filename, header, arrays);
+    }
+
+    /** @brief Writes a compressed_matrix to a file in the ViennaCL binary format. The row, column and value arrays are stored unmodified. */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool save(viennacl::compressed_matrix<ScalarType, ALIGNMENT> const & mat, std::string const & filename)
+    {
+      detail::binary_header header = detail::make_binary_header<ScalarType>(detail::BINARY_COMPRESSED_MATRIX, ALIGNMENT, mat.size1(), mat.size2(), mat.nnz());
+      std::vector<detail::binary_array> arrays;
+      arrays.push_back(detail::binary_array(mat.handle1(), (mat.size1() > 0) ? sizeof(unsigned int) * (mat.size1() + 1) : 0));
+      arrays.push_back(detail::binary_array(mat.handle2(), sizeof(unsigned int) * mat.nnz()));
+      arrays.push_back(detail::binary_array(mat.handle(),  sizeof(ScalarType) * mat.nnz()));
+      return detail::write_binary_file(filename, header, arrays);
+    }
+
+    /** @brief Writes a coordinate_matrix to a file in the ViennaCL binary format */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool save(viennacl::coordinate_matrix<ScalarType, ALIGNMENT> const & mat, std::string const & filename)
+    {
+      detail::binary_header header = detail::make_binary_header<ScalarType>(detail::BINARY_COORDINATE_MATRIX, ALIGNMENT, mat.size1(), mat.size2(), mat.nnz());
+      header.param1 = mat.groups();
+      std::vector<detail::binary_array> arrays;
+      arrays.push_back(detail::binary_array(mat.handle12(), sizeof(unsigned int) * 2 * mat.internal_nnz()));
+      arrays.push_back(detail::binary_array(mat.handle(),   sizeof(ScalarType) * mat.internal_nnz()));
+      arrays.push_back(detail::binary_array(mat.handle3(),  (mat.groups() > 0) ? sizeof(unsigned int) * (mat.groups() + 1) : 0));
+      return detail::write_binary_file(filename, header, arrays);
+    }
+
+    /** @brief Writes an ell_matrix to a file in the ViennaCL binary format */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool save(viennacl::ell_matrix<ScalarType, ALIGNMENT> const & mat, std::string const & filename)
+    {
+      detail::binary_header header = detail::make_binary_header<ScalarType>(detail::BINARY_ELL_MATRIX, ALIGNMENT, mat.size1(), mat.size2(), mat.nnz());
+      header.param1 = mat.maxnnz();
+      std::vector<detail::binary_array> arrays;
+      arrays.push_back(detail::binary_array(mat.handle2(), sizeof(unsigned int) * mat.internal_nnz()));
+      arrays.push_back(detail::binary_array(mat.handle(),  sizeof(ScalarType) * mat.internal_nnz()));
+      return detail::write_binary_file(filename, header, arrays);
+    }
+
+    /** @brief Writes a hyb_matrix to a file in the ViennaCL binary format */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool save(viennacl::hyb_matrix<ScalarType, ALIGNMENT> const & mat, std::string const & filename)
+    {
+      std::size_t ell_entries = mat.internal_size1() * mat.internal_ellnnz();
+      detail::binary_header header = detail::make_binary_header<ScalarType>(detail::BINARY_HYB_MATRIX, ALIGNMENT, mat.size1(), mat.size2(), mat.ell_nnz() * mat.size1() + mat.csr_nnz());
+      header.param1 = mat.ell_nnz();
+      header.param2 = mat.csr_nnz();
+      header.value  = mat.csr_threshold();
+      std::vector<detail::binary_array> arrays;
+      arrays.push_back(detail::binary_array(mat.handle2(), sizeof(unsigned int) * ell_entries));
+      arrays.push_back(detail::binary_array(mat.handle(),  sizeof(ScalarType) * ell_entries));
+      arrays.push_back(detail::binary_array(mat.handle3(), (mat.size1() > 0) ? sizeof(unsigned int) * (mat.size1() + 1) : 0));
+      arrays.push_back(detail::binary_array(mat.handle4(), sizeof(unsigned int) * mat.csr_nnz()));
+      arrays.push_back(detail::binary_array(mat.handle5(), sizeof(ScalarType) * mat.csr_nnz()));
+      return detail::write_binary_file(filename, header, arrays);
+    }
+
+
+    /** @brief Writes a compressed_matrix to a file in the ViennaCL binary format row by row, so that the full matrix never needs to be held in memory.
+    *
+    * The number of nonzeros needs to be known in advance, since it determines the position of the arrays in the file.
+    * Only the row pointers and a buffer of the most recently added entries are kept in memory.
+    * Usage:
+    *
+    *   compressed_matrix_writer<double> writer("A.vclbin", rows, cols, nnz);
+    *   for (row = 0; row < rows; ++row)
+    *     writer.add_row(row_nnz, row_cols, row_entries);
+    *   writer.close();
+    *
+    * @tparam ScalarType    The floating point type of the entries in the file
+    */
+    template <typename ScalarType>
+    class compressed_matrix_writer
+    {
+      public:
+        compressed_matrix_writer(std::string const & filename, std::size_t rows, std::size_t cols, std::size_t nnz)
+          : filename_(filename), file_(std::fopen(filename.c_str(), "wb")), good_(file_ != NULL), nnz_(0), buffered_begin_(0),
+            header_(detail::make_binary_header<ScalarType>(detail::BINARY_COMPRESSED_MATRIX, 1, rows, cols, nnz))
+        {
+          if (!file_)
+            std::cerr << "ViennaCL: Error in binary writer: Cannot open file " << filename << std::endl;
+
+          header_.num_arrays = 3;
+          header_.array_bytes[0] = (rows > 0) ? sizeof(unsigned int) * (rows + 1) : 0;
+          header_.array_bytes[1] = sizeof(unsigned int) * nnz;
+          header_.array_bytes[2] = sizeof(ScalarType) * nnz;
+          std::size_t offset = detail::binary_block_size;
+          for (std::size_t i=0; i<3; ++i)
+          {
+            header_.array_offset[i] = offset;
+            offset += viennacl::tools::roundUpToNextMultiple<std::size_t>(header_.array_bytes[i], detail::binary_block_size);
+          }
+          file_size_ = offset;
+
+          row_buffer_.reserve(rows + 1);
+          row_buffer_.push_back(0);
+        }
+
+        ~compressed_matrix_writer() { close(); }
+
+        /** @brief Returns false if an error occurred so far */
+        bool good() const { return good_; }
+
+        /** @brief Appends the next row to the matrix.
+        *
+        * @param num_entries   Number of nonzero entries in the row
+        * @param col_indices   Column indices of the entries, sorted in ascending order
+        * @param entries       Values of the entries
+        * @return              False if the row does not fit into the matrix dimensions or the file could not be written
+        */
+        bool add_row(std::size_t num_entries, unsigned int const * col_indices, ScalarType const * entries)
+        {
+          if (!good_)
+            return false;
+
+          if (row_buffer_.size() > header_.size1 || nnz_ + num_entries > header_.nnz)
+          {
+            std::cerr << "ViennaCL: Error in binary writer: Matrix exceeds the dimensions or number of nonzeros given at construction" << std::endl;
+            good_ = false;
+            return false;
+          }
+
+          col_buffer_.insert(col_buffer_.end(), col_indices, col_indices + num_entries);
+          elements_.insert(elements_.end(), entries, entries + num_entries);
+          nnz_ += num_entries;
+          row_buffer_.push_back(static_cast<unsigned int>(nnz_));
+
+          if (col_buffer_.size() >= flush_threshold)
+            flush();
+          return good_;
+        }
+
+        /** @brief Writes the remaining data and the header and closes the file. Called by the destructor if not called explicitly.
+        *
+        * @return   True if the matrix was written completely, i.e. all rows and nonzeros announced at construction have been added
+        */
+        bool close()
+        {
+          if (!file_)
+            return good_;
+
+          flush();
+          if (good_ && (row_buffer_.size() != header_.size1 + 1 || nnz_ != header_.nnz))
+          {
+            std::cerr << "ViennaCL: Error in binary writer: Fewer rows or nonzeros than given at construction written to " << filename_ << std::endl;
+            good_ = false;
+          }
+
+          if (good_ && header_.size1 > 0)
+            good_ = write_at(header_.array_offset[0], &(row_buffer_[0]), sizeof(unsigned int) * row_buffer_.size());
+
+          if (good_)
+          {
+            std::vector<char> block(detail::binary_block_size);
+            detail::encode_header(header_, &(block[0]));
+            good_ = write_at(0, &(block[0]), detail::binary_block_size);
+
+            //pad the file to its full size:
+            char zero = 0;
+            good_ = good_ && write_at(file_size_ - 1, &zero, 1);
+          }
+
+          if (std::fclose(file_) != 0)
+            good_ = false;
+          file_ = NULL;
+
+          if (!good_)
+            std::cerr << "ViennaCL: Error in binary writer: Failed to write file " << filename_ << std::endl;
+          return good_;
+        }
+
+      private:
+        compressed_matrix_writer(compressed_matrix_writer const &);
+        compressed_matrix_writer & operator=(compressed_matrix_writer const &);
+
+        static const std::size_t flush_threshold = 1024 * 1024;    //number of buffered entries triggering a write
+
+        bool write_at(std::size_t offset, void const * data, std::size_t bytes)
+        {
+          return viennacl::tools::seek_file(file_, offset)
+              && std::fwrite(data, 1, bytes, file_) == bytes;
+        }
+
+        void flush()
+        {
+          if (good_ && col_buffer_.size() > 0)
+            good_ =  write_at(header_.array_offset[1] + sizeof(unsigned int) * buffered_begin_, &(col_buffer_[0]), sizeof(unsigned int) * col_buffer_.size())
+                  && write_at(header_.array_offset[2] + sizeof(ScalarType) * buffered_begin_,   &(elements_[0]),   sizeof(ScalarType) * elements_.size());
+          buffered_begin_ = nnz_;
+          col_buffer_.clear();
+          elements_.clear();
+        }
+
+        std::string filename_;
+        std::FILE * file_;
+        bool good_;
+        std::size_t nnz_;
+        std::size_t buffered_begin_;   //index of the first buffered entry
+        std::size_t file_size_;
+        detail::binary_header header_;
+        std::vector<unsigned int> row_buffer_;
+        std::vector<unsigned int> col_buffer_;
+        std::vector<ScalarType>   elements_;
+    };
+
+
+    /** @brief Reads a vector from a file in the ViennaCL binary format
+    *
+    * If the vector resides in main memory and memory mapping is available, the buffer of the vector refers to the pages of the mapped file directly and no data is copied.
+    * Pages are mapped copy-on-write, hence later modifications of the vector do not alter the file.
+    * Otherwise the data is read and copied to the memory domain of the vector.
+    *
+    * @param vec             The vector to be filled
+    * @param filename        Name of the file
+    * @param use_memory_map  If false, the data is always read into a newly allocated buffer
+    * @return                True on success
+    */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool load(viennacl::vector<ScalarType, ALIGNMENT> & vec, std::string const & filename, bool use_memory_map = true)
+    {
+      return detail::load_binary_file(vec, filename, use_memory_map);
+    }
+
+    /** @brief Reads a dense matrix from a file in the ViennaCL binary format. See load() for vectors for details on memory mapping. */
+    template <typename ScalarType, typename F, unsigned int ALIGNMENT>
+    bool load(viennacl::matrix<ScalarType, F, ALIGNMENT> & mat, std::string const & filename, bool use_memory_map = true)
+    {
+      return detail::load_binary_file(mat, filename, use_memory_map);
+    }
+
+    /** @brief Reads a compressed_matrix from a file in the ViennaCL binary format. See load() for vectors for details on memory mapping. */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool load(viennacl::compressed_matrix<ScalarType, ALIGNMENT> & mat, std::string const & filename, bool use_memory_map = true)
+    {
+      return detail::load_binary_file(mat, filename, use_memory_map);
+    }
+
+    /** @brief Reads a coordinate_matrix from a file in the ViennaCL binary format. See load() for vectors for details on memory mapping. */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool load(viennacl::coordinate_matrix<ScalarType, ALIGNMENT> & mat, std::string const & filename, bool use_memory_map = true)
+    {
+      return detail::load_binary_file(mat, filename, use_memory_map);
+    }
+
+    /** @brief Reads an ell_matrix from a file in the ViennaCL binary format. See load() for vectors for details on memory mapping. */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool load(viennacl::ell_matrix<ScalarType, ALIGNMENT> & mat, std::string const & filename, bool use_memory_map = true)
+    {
+      return detail::load_binary_file(mat, filename, use_memory_map);
+    }
+
+    /** @brief Reads a hyb_matrix from a file in the ViennaCL binary format. See load() for vectors for details on memory mapping. */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    bool load(viennacl::hyb_matrix<ScalarType, ALIGNMENT> & mat, std::string const & filename, bool use_memory_map = true)
+    {
+      return detail::load_binary_file(mat, filename, use_memory_map);
+    }
+
+  } //namespace io
+} //namespace viennacl
+
+#endif
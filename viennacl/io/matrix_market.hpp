@@ -31,10 +31,19 @@
 #include <vector>
 #include <map>
 #include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include "viennacl/forwards.h"
+#include "viennacl/backend/memory.hpp"
 #include "viennacl/tools/adapter.hpp"
 #include "viennacl/traits/size.hpp"
 #include "viennacl/traits/fill.hpp"
 
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace viennacl
 {
   namespace io
@@ -81,8 +90,429 @@ namespace viennacl
         std::transform(s.begin(), s.end(), s.begin(), static_cast < int(*)(int) > (std::tolower));
         return s;
       }
-      
-      
+
+      //
+      // Helpers for the fast reader used for viennacl::compressed_matrix and viennacl::matrix:
+      //
+
+      /** @brief Header information of a MatrixMarket file */
+      struct matrix_market_header
+      {
+        matrix_market_header() : dense(false), symmetric(false), pattern(false), rows(0), cols(0), nnz(0), data_begin(0), header_lines(0) {}
+
+        bool dense;               //'array' format
+        bool symmetric;
+        bool pattern;             //no values given, all entries are one
+        long rows;
+        long cols;
+        long nnz;                 //number of entries listed in the file (coordinate format only)
+        std::size_t data_begin;   //offset of the first byte after the size line
+        long header_lines;        //number of lines up to and including the size line
+      };
+
+      /** @brief Reads the whole file into a buffer, which is allocated once from the file size. Returns false if the file cannot be read. */
+      inline bool read_file_to_buffer(const char * file, std::vector<char> & buffer)
+      {
+        std::FILE * handle = std::fopen(file, "rb");
+        if (!handle)
+          return false;
+
+        long file_size = -1;
+        if (std::fseek(handle, 0, SEEK_END) == 0)
+          file_size = std::ftell(handle);
+        std::rewind(handle);
+
+        buffer.clear();
+        if (file_size >= 0)
+        {
+          buffer.resize(static_cast<std::size_t>(file_size) + 1);  //one extra byte for the terminating newline below
+          std::size_t bytes_read = (file_size > 0) ? std::fread(&(buffer[0]), 1, static_cast<std::size_t>(file_size), handle) : 0;
+          buffer.resize(bytes_read);
+        }
+        else //file size not available (e.g. a pipe), read in blocks:
+        {
+          std::vector<char> block(1024 * 1024);
+          std::size_t bytes_read = 0;
+          while ( (bytes_read = std::fread(&(block[0]), 1, block.size(), handle)) > 0)
+            buffer.insert(buffer.end(), block.begin(), block.begin() + static_cast<long>(bytes_read));
+        }
+
+        std::fclose(handle);
+        buffer.push_back('\n');  //guarantees that the last line is terminated
+        return true;
+      }
+
+      inline bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+      /** @brief Advances to the first non-blank character of the next line holding data. Empty lines and comment lines are skipped, newlines are counted. */
+      inline const char * next_data_line(const char * p, const char * end, long & newlines)
+      {
+        while (p < end)
+        {
+          while (p < end && is_blank(*p))
+            ++p;
+          if (p < end && *p == '%')
+            while (p < end && *p != '\n')
+              ++p;
+          if (p < end && *p == '\n')
+          {
+            ++newlines;
+            ++p;
+            continue;
+          }
+          break;
+        }
+        return p;
+      }
+
+      /** @brief Parses a signed integer. Returns NULL on failure, otherwise the position after the number. */
+      inline const char * parse_integer(const char * p, const char * end, long & value)
+      {
+        while (p < end && is_blank(*p))
+          ++p;
+
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+          negative = (*p++ == '-');
+
+        if (p == end || *p < '0' || *p > '9')
+          return NULL;
+
+        long result = 0;
+        while (p < end && *p >= '0' && *p <= '9')
+          result = 10 * result + (*p++ - '0');
+
+        value = negative ? -result : result;
+        return p;
+      }
+
+      /** @brief Parses a floating point number. Returns NULL on failure, otherwise the position after the number.
+      *
+      * Numbers with at most 15 significant digits and a decimal exponent of at most 22 in magnitude are converted exactly by a single floating point operation.
+      * All other numbers are handed to strtod().
+      */
+      inline const char * parse_floating_point(const char * p, const char * end, double & value)
+      {
+        static const double powers_of_ten[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9, 1e10, 1e11,
+                                               1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+        while (p < end && is_blank(*p))
+          ++p;
+        const char * token_begin = p;
+
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+          negative = (*p++ == '-');
+
+        double mantissa = 0;
+        long significant_digits = 0;
+        long exponent = 0;
+        bool has_digits = false;
+
+        while (p < end && *p == '0')  //leading zeros are not significant
+        {
+          ++p;
+          has_digits = true;
+        }
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+          mantissa = 10 * mantissa + (*p++ - '0');
+          ++significant_digits;
+          has_digits = true;
+        }
+        if (p < end && *p == '.')
+        {
+          ++p;
+          if (significant_digits == 0)
+            while (p < end && *p == '0')
+            {
+              ++p;
+              --exponent;
+              has_digits = true;
+            }
+          while (p < end && *p >= '0' && *p <= '9')
+          {
+            mantissa = 10 * mantissa + (*p++ - '0');
+            ++significant_digits;
+            --exponent;
+            has_digits = true;
+          }
+        }
+        if (!has_digits)
+          return NULL;
+
+        if (p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D'))
+        {
+          long exponent_part = 0;
+          const char * exponent_end = parse_integer(p + 1, end, exponent_part);
+          if (!exponent_end || is_blank(*(p+1)))
+            return NULL;
+          exponent += exponent_part;
+          p = exponent_end;
+        }
+
+        if (significant_digits <= 15 && exponent >= -22 && exponent <= 22)  //exact fast path
+        {
+          value = (exponent < 0) ? mantissa / powers_of_ten[-exponent] : mantissa * powers_of_ten[exponent];
+          if (negative)
+            value = -value;
+          return p;
+        }
+
+        // slow path: let strtod() deal with the token. Fortran-style exponents are converted.
+        char token[128];
+        std::size_t token_length = std::min(static_cast<std::size_t>(p - token_begin), sizeof(token) - 1);
+        for (std::size_t i=0; i<token_length; ++i)
+          token[i] = (token_begin[i] == 'd' || token_begin[i] == 'D') ? 'e' : token_begin[i];
+        token[token_length] = 0;
+        value = std::strtod(token, NULL);
+        return p;
+      }
+
+      /** @brief Parses the banner and the size line of a MatrixMarket file. Prints an error message and returns false on failure. */
+      inline bool parse_matrix_market_header(std::vector<char> const & buffer, const char * file, matrix_market_header & header)
+      {
+        const char * p   = &(buffer[0]);
+        const char * end = p + buffer.size();
+
+        // banner (files without banner are read as general real matrices in coordinate format):
+        long newlines = 0;
+        if (buffer.size() > 2 && p[0] == '%' && p[1] == '%')
+        {
+          const char * line_end = std::find(p, end, '\n');
+          std::stringstream banner(std::string(p, line_end));
+          std::string token;
+          banner >> token;
+          if (tolower(token) != "%%matrixmarket")
+          {
+            std::cerr << "Error in file " << file << " at line 1: Expected '%%MatrixMarket', got '" << token << "'" << std::endl;
+            return false;
+          }
+
+          banner >> token;
+          if (tolower(token) != "matrix")
+          {
+            std::cerr << "Error in file " << file << " at line 1: Expected 'matrix', got '" << token << "'" << std::endl;
+            return false;
+          }
+
+          banner >> token;
+          if (tolower(token) == "array")
+            header.dense = true;
+          else if (tolower(token) != "coordinate")
+          {
+            std::cerr << "Error in file " << file << " at line 1: Expected 'array' or 'coordinate', got '" << token << "'" << std::endl;
+            return false;
+          }
+
+          banner >> token;
+          if (tolower(token) == "pattern" && !header.dense)
+            header.pattern = true;
+          else if (tolower(token) != "real" && tolower(token) != "integer")
+          {
+            std::cerr << "Error in file " << file << ": The MatrixMarket reader provided with ViennaCL supports only real, integer, or (for coordinate format) pattern matrices." << std::endl;
+            return false;
+          }
+
+          banner >> token;
+          if (tolower(token) == "symmetric")
+            header.symmetric = true;
+          else if (tolower(token) != "general")
+          {
+            std::cerr << "Error in file " << file << ": The MatrixMarket reader provided with ViennaCL supports only general or symmetric matrices." << std::endl;
+            return false;
+          }
+
+          p = line_end + 1;
+          newlines = 1;
+        }
+
+        // size line:
+        p = next_data_line(p, end, newlines);
+        p = parse_integer(p, end, header.rows);
+        if (p)
+          p = parse_integer(p, end, header.cols);
+        if (p && !header.dense)
+          p = parse_integer(p, end, header.nnz);
+        if (!p || header.rows < 0 || header.cols < 0 || header.nnz < 0)
+        {
+          std::cerr << "Error in file " << file << ": Could not get matrix dimensions in line " << newlines + 1 << std::endl;
+          return false;
+        }
+
+        const char * line_end = std::find(p, end, '\n');
+        header.data_begin = static_cast<std::size_t>(line_end - &(buffer[0])) + 1;
+        header.header_lines = newlines + 1;
+        return true;
+      }
+
+      /** @brief Splits the range [begin, end) into chunks starting at the beginning of a line. Returns the chunk boundaries. */
+      inline std::vector<const char *> split_into_lines(const char * begin, const char * end, std::size_t num_chunks)
+      {
+        std::vector<const char *> boundaries(num_chunks + 1, end);
+        boundaries[0] = begin;
+        for (std::size_t i=1; i<num_chunks; ++i)
+        {
+          const char * p = begin + static_cast<long>(static_cast<std::size_t>(end - begin) * i / num_chunks);
+          p = std::max(p, boundaries[i-1]);
+          while (p < end && *(p-1) != '\n')
+            ++p;
+          boundaries[i] = p;
+        }
+        return boundaries;
+      }
+
+      /** @brief Parses all numbers in the data section of a MatrixMarket file in parallel.
+      *
+      * The data section is split into chunks at line boundaries. In a first pass, the data lines in each chunk are counted in order to determine the output offsets.
+      * In the second pass, each line is parsed into 'indices' (row and column index for coordinate format) and 'values'.
+      *
+      * @return The number of data lines parsed, or -1 on a parse error
+      */
+      template <typename ScalarType>
+      long parse_matrix_market_data(std::vector<char> const & buffer,
+                                    const char * file,
+                                    matrix_market_header const & header,
+                                    long expected_lines,
+                                    std::vector<long> & indices,
+                                    std::vector<ScalarType> & values)
+      {
+        const char * data_begin = &(buffer[0]) + header.data_begin;
+        const char * data_end   = &(buffer[0]) + buffer.size();
+
+        std::size_t num_chunks = 1;
+#ifdef VIENNACL_WITH_OPENMP
+        if (data_end - data_begin > (1 << 20))
+          num_chunks = 4 * static_cast<std::size_t>(omp_get_max_threads());
+#endif
+        std::vector<const char *> chunk_begin = split_into_lines(data_begin, data_end, num_chunks);
+        std::vector<long> lines_in_chunk(num_chunks + 1);  //data lines (later: offsets)
+        std::vector<long> newlines_in_chunk(num_chunks + 1);  //all lines, for error messages
+
+        // pass 1: count data lines in each chunk
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for schedule(dynamic)
+#endif
+        for (long chunk = 0; chunk < static_cast<long>(num_chunks); ++chunk)
+        {
+          long data_lines = 0;
+          long newlines = 0;
+          const char * end = chunk_begin[chunk+1];
+          const char * p = next_data_line(chunk_begin[chunk], end, newlines);
+          while (p < end)
+          {
+            ++data_lines;
+            while (p < end && *p != '\n')
+              ++p;
+            p = next_data_line(p, end, newlines);
+          }
+          lines_in_chunk[chunk+1]    = data_lines;
+          newlines_in_chunk[chunk+1] = newlines;
+        }
+
+        for (std::size_t i=1; i<=num_chunks; ++i)
+        {
+          lines_in_chunk[i]    += lines_in_chunk[i-1];
+          newlines_in_chunk[i] += newlines_in_chunk[i-1];
+        }
+
+        long num_lines = std::min(lines_in_chunk[num_chunks], expected_lines);
+        if (num_lines < expected_lines)
+        {
+          std::cerr << "Error in file " << file << ": Expected " << expected_lines << " entries, but found only " << num_lines << std::endl;
+          return -1;
+        }
+
+        long indices_per_line = header.dense ? 0 : 2;
+        indices.resize(static_cast<std::size_t>(indices_per_line * num_lines));
+        values.resize(static_cast<std::size_t>(num_lines));
+
+        // pass 2: parse
+        long error_line = 0;
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for schedule(dynamic)
+#endif
+        for (long chunk = 0; chunk < static_cast<long>(num_chunks); ++chunk)
+        {
+          long line_index = lines_in_chunk[chunk];
+          long newlines = newlines_in_chunk[chunk];
+          const char * end = chunk_begin[chunk+1];
+          const char * p = next_data_line(chunk_begin[chunk], end, newlines);
+          for (; p < end && line_index < num_lines; ++line_index)
+          {
+            bool ok = true;
+            if (!header.dense)
+            {
+              long row = 0;
+              long col = 0;
+              p = parse_integer(p, end, row);
+              if (p)
+                p = parse_integer(p, end, col);
+              ok = (p != NULL);
+              indices[2*line_index]   = row;
+              indices[2*line_index+1] = col;
+            }
+            if (ok && !header.pattern)
+            {
+              double value = 0;
+              p = parse_floating_point(p, end, value);
+              ok = (p != NULL);
+              values[line_index] = static_cast<ScalarType>(value);
+            }
+            else
+              values[line_index] = ScalarType(1);
+
+            if (!ok)
+            {
+#ifdef VIENNACL_WITH_OPENMP
+              #pragma omp critical
+#endif
+              if (error_line == 0 || newlines + header.header_lines + 1 < error_line)
+                error_line = newlines + header.header_lines + 1;
+              break;
+            }
+
+            while (p < end && *p != '\n')
+              ++p;
+            p = next_data_line(p, end, newlines);
+          }
+        }
+
+        if (error_line > 0)
+        {
+          std::cerr << "Error in file " << file << ": Parse error for matrix entry in line " << error_line << std::endl;
+          return -1;
+        }
+
+        return num_lines;
+      }
+
+      /** @brief Sorts the entries of a compressed row by column index using insertion sort (rows are typically short and often already sorted) */
+      template <typename ScalarType>
+      void sort_compressed_row(unsigned int * cols, ScalarType * values, std::size_t num_entries)
+      {
+        for (std::size_t i=1; i<num_entries; ++i)
+        {
+          unsigned int col = cols[i];
+          ScalarType value = values[i];
+          std::size_t j = i;
+          for (; j > 0 && cols[j-1] > col; --j)
+          {
+            cols[j]   = cols[j-1];
+            values[j] = values[j-1];
+          }
+          cols[j]   = col;
+          values[j] = value;
+        }
+      }
+
+      /** @brief Helper for sorting (column, value) pairs by column index */
+      template <typename ScalarType>
+      bool compare_first(std::pair<unsigned int, ScalarType> const & a, std::pair<unsigned int, ScalarType> const & b)
+      {
+        return a.first < b.first;
+      }
+
       
     } //namespace 
     
@@ -119,7 +549,7 @@ namespace viennacl
       
       if (!reader){
         std::cerr << "ViennaCL: Matrix Market Reader: Cannot open file " << file << std::endl;
-        return EXIT_FAILURE;
+        return 0;
       }
       
       while (reader.good())
@@ -159,8 +589,6 @@ namespace viennacl
               if (detail::tolower(token) == "array")
               {
                 dense_format = true;
-                std::cerr << "Error in file " << file << " at line " << linenum << " in file " << file << ": 'array' type is not supported yet!" << std::endl;
-                return 0;
               }
               else
               {
@@ -224,10 +652,15 @@ namespace viennacl
               }
             }
             
+            if (dense_format)
+              nnz = symmetric ? rows * (rows + 1) / 2 : rows * cols;
+            
             if (rows > 0 && cols > 0)
               viennacl::traits::resize(mat, rows, cols);
             
             is_header = false;
+            if (nnz == 0)
+              break;
           }
           else
           {
@@ -237,13 +670,18 @@ namespace viennacl
               ScalarType value;
               line >> value;
               viennacl::traits::fill(mat, cur_row, cur_col, value);
+              if (symmetric && cur_row != cur_col)
+                viennacl::traits::fill(mat, cur_col, cur_row, value);
               
               if (++cur_row == static_cast<long>(viennacl::traits::size1(mat)))
               {
-                //next column
+                //next column (only the lower triangular part is stored for symmetric matrices)
                 ++cur_col;
-                cur_row = 0;
+                cur_row = symmetric ? cur_col : 0;
               }
+              
+              if (++valid_entries == nnz)
+                break;
             }
             else //sparse format
             {
@@ -308,11 +746,273 @@ namespace viennacl
       reader.close();
       return linenum;
     }
+
+    /** @brief Reads a sparse matrix from a file (MatrixMarket format) directly into a compressed_matrix.
+    *
+    * The file is read in blocks and the entries are parsed in parallel (if OpenMP is enabled). The compressed row representation is assembled
+    * by a counting sort over the rows without intermediate maps: Symmetric matrices are expanded, duplicate entries are summed up.
+    * Zero entries of files in 'array' format are dropped.
+    *
+    * @param mat The matrix that is to be read
+    * @param file Filename from which the matrix should be read
+    * @param index_base The index base, typically 1
+    * @return Returns nonzero if file is read correctly
+    */
+    template <typename ScalarType, unsigned int ALIGNMENT>
+    long read_matrix_market_file_impl(viennacl::compressed_matrix<ScalarType, ALIGNMENT> & mat,
+                                      const char * file,
+                                      long index_base)
+    {
+      std::vector<char> buffer;
+      if (!detail::read_file_to_buffer(file, buffer))
+      {
+        std::cerr << "ViennaCL: Matrix Market Reader: Cannot open file " << file << std::endl;
+        return 0;
+      }
+
+      detail::matrix_market_header header;
+      if (!detail::parse_matrix_market_header(buffer, file, header))
+        return 0;
+
+      long rows = header.rows;
+      long cols = header.cols;
+      long num_entries = header.dense ? (header.symmetric ? rows * (rows + 1) / 2 : rows * cols) : header.nnz;
+
+      std::vector<long> indices;
+      std::vector<ScalarType> values;
+      if (detail::parse_matrix_market_data(buffer, file, header, num_entries, indices, values) < 0)
+        return 0;
+      std::vector<char>().swap(buffer);  //release file contents
+
+      if (header.dense)  //entries are listed column by column
+      {
+        indices.resize(2 * num_entries);
+        long k = 0;
+        for (long j = 0; j < cols; ++j)
+          for (long i = (header.symmetric ? j : 0); i < rows; ++i, ++k)
+          {
+            indices[2*k]   = i + index_base;
+            indices[2*k+1] = j + index_base;
+          }
+      }
+
+      //
+      // Count entries per row (including the mirrored entries of symmetric matrices):
+      //
+      std::vector<unsigned int> row_buffer(rows + 1);
+      for (long k = 0; k < num_entries; ++k)
+      {
+        long row = indices[2*k]   - index_base;
+        long col = indices[2*k+1] - index_base;
+
+        if (row >= rows || row < 0)
+        {
+          std::cerr << "Error in file " << file << " at entry " << k + 1 << ": Row index out of bounds: " << row << " (matrix dim: " << rows << " x " << cols << ")" << std::endl;
+          return 0;
+        }
+        if (col >= cols || col < 0)
+        {
+          std::cerr << "Error in file " << file << " at entry " << k + 1 << ": Column index out of bounds: " << col << " (matrix dim: " << rows << " x " << cols << ")" << std::endl;
+          return 0;
+        }
+        if (header.dense && values[k] == ScalarType(0))
+          continue;
+
+        ++row_buffer[row + 1];
+        if (header.symmetric && row != col)
+          ++row_buffer[col + 1];
+      }
+      for (long i = 0; i < rows; ++i)
+        row_buffer[i+1] += row_buffer[i];
+
+      //
+      // Scatter entries into rows (counting sort):
+      //
+      std::vector<unsigned int> col_buffer(row_buffer[rows]);
+      std::vector<ScalarType>   elements(row_buffer[rows]);
+      std::vector<unsigned int> row_fill(row_buffer.begin(), row_buffer.end() - 1);
+      for (long k = 0; k < num_entries; ++k)
+      {
+        if (header.dense && values[k] == ScalarType(0))
+          continue;
+
+        unsigned int row = static_cast<unsigned int>(indices[2*k]   - index_base);
+        unsigned int col = static_cast<unsigned int>(indices[2*k+1] - index_base);
+
+        col_buffer[row_fill[row]] = col;
+        elements[row_fill[row]++] = values[k];
+        if (header.symmetric && row != col)
+        {
+          col_buffer[row_fill[col]] = row;
+          elements[row_fill[col]++] = values[k];
+        }
+      }
+      std::vector<long>().swap(indices);
+      std::vector<ScalarType>().swap(values);
+
+      //
+      // Sort each row by column index and sum up duplicate entries:
+      //
+      std::vector<unsigned int> row_entries(rows + 1);
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel
+#endif
+      {
+        std::vector<std::pair<unsigned int, ScalarType> > long_row;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp for schedule(dynamic, 256)
+#endif
+        for (long row = 0; row < rows; ++row)
+        {
+          unsigned int row_begin = row_buffer[row];
+          unsigned int row_size  = row_buffer[row+1] - row_begin;
+          unsigned int * row_cols = &(col_buffer[0]) + row_begin;
+          ScalarType * row_values = &(elements[0]) + row_begin;
+
+          if (row_size > 64)
+          {
+            long_row.resize(row_size);
+            for (unsigned int i = 0; i < row_size; ++i)
+              long_row[i] = std::make_pair(row_cols[i], row_values[i]);
+            std::stable_sort(long_row.begin(), long_row.end(), detail::compare_first<ScalarType>);
+            for (unsigned int i = 0; i < row_size; ++i)
+            {
+              row_cols[i]   = long_row[i].first;
+              row_values[i] = long_row[i].second;
+            }
+          }
+          else
+            detail::sort_compressed_row(row_cols, row_values, row_size);
+
+          unsigned int unique_entries = 0;
+          for (unsigned int i = 0; i < row_size; ++i)
+          {
+            if (unique_entries > 0 && row_cols[unique_entries-1] == row_cols[i])
+              row_values[unique_entries-1] += row_values[i];
+            else
+            {
+              row_cols[unique_entries]   = row_cols[i];
+              row_values[unique_entries] = row_values[i];
+              ++unique_entries;
+            }
+          }
+          row_entries[row+1] = unique_entries;
+        }
+      }
+
+      //
+      // Remove gaps left by duplicate entries:
+      //
+      for (long i = 0; i < rows; ++i)
+        row_entries[i+1] += row_entries[i];
+      if (row_entries[rows] < row_buffer[rows])
+      {
+        for (long row = 0; row < rows; ++row)
+          for (unsigned int i = 0; i < row_entries[row+1] - row_entries[row]; ++i)
+          {
+            col_buffer[row_entries[row] + i] = col_buffer[row_buffer[row] + i];
+            elements[row_entries[row] + i]   = elements[row_buffer[row] + i];
+          }
+      }
+
+      if (row_entries[rows] > 0)
+        mat.set(&(row_entries[0]), &(col_buffer[0]), &(elements[0]), rows, cols, row_entries[rows]);
+      else
+        mat.resize(rows, cols, false);
+
+      return header.header_lines + num_entries;
+    }
+
+
+    /** @brief Reads a matrix from a file (MatrixMarket format, 'array' or 'coordinate') directly into a dense viennacl::matrix.
+    *
+    * The file is read in blocks and the entries are parsed in parallel (if OpenMP is enabled).
+    *
+    * @param mat The matrix that is to be read
+    * @param file Filename from which the matrix should be read
+    * @param index_base The index base, typically 1
+    * @return Returns nonzero if file is read correctly
+    */
+    template <typename ScalarType, typename F, unsigned int ALIGNMENT>
+    long read_matrix_market_file_impl(viennacl::matrix<ScalarType, F, ALIGNMENT> & mat,
+                                      const char * file,
+                                      long index_base)
+    {
+      std::vector<char> buffer;
+      if (!detail::read_file_to_buffer(file, buffer))
+      {
+        std::cerr << "ViennaCL: Matrix Market Reader: Cannot open file " << file << std::endl;
+        return 0;
+      }
+
+      detail::matrix_market_header header;
+      if (!detail::parse_matrix_market_header(buffer, file, header))
+        return 0;
+
+      long rows = header.rows;
+      long cols = header.cols;
+      long num_entries = header.dense ? (header.symmetric ? rows * (rows + 1) / 2 : rows * cols) : header.nnz;
+
+      std::vector<long> indices;
+      std::vector<ScalarType> values;
+      if (detail::parse_matrix_market_data(buffer, file, header, num_entries, indices, values) < 0)
+        return 0;
+      std::vector<char>().swap(buffer);  //release file contents
+
+      if (rows == 0 || cols == 0)
+        return header.header_lines;
+
+      mat.resize(rows, cols, false);
+      std::size_t internal_rows = mat.internal_size1();
+      std::size_t internal_cols = mat.internal_size2();
+      std::vector<ScalarType> data(mat.internal_size());
+
+      if (header.dense)  //entries are listed column by column
+      {
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for
+#endif
+        for (long j = 0; j < cols; ++j)
+        {
+          long first_row = header.symmetric ? j : 0;
+          long offset = header.symmetric ? j * rows - j * (j - 1) / 2 : j * rows;  //number of entries in previous columns
+          for (long i = first_row; i < rows; ++i)
+          {
+            ScalarType value = values[offset + i - first_row];
+            data[F::mem_index(i, j, internal_rows, internal_cols)] = value;
+            if (header.symmetric)
+              data[F::mem_index(j, i, internal_rows, internal_cols)] = value;
+          }
+        }
+      }
+      else
+      {
+        for (long k = 0; k < num_entries; ++k)
+        {
+          long row = indices[2*k]   - index_base;
+          long col = indices[2*k+1] - index_base;
+
+          if (row >= rows || row < 0 || col >= cols || col < 0)
+          {
+            std::cerr << "Error in file " << file << " at entry " << k + 1 << ": Index out of bounds: (" << row << ", " << col << ") (matrix dim: " << rows << " x " << cols << ")" << std::endl;
+            return 0;
+          }
+
+          data[F::mem_index(row, col, internal_rows, internal_cols)] += values[k];  //duplicate entries are summed up as for compressed_matrix
+          if (header.symmetric && row != col)
+            data[F::mem_index(col, row, internal_rows, internal_cols)] += values[k];
+        }
+      }
+
+      viennacl::backend::memory_create(mat.handle(), sizeof(ScalarType) * data.size(), &(data[0]));
+      return header.header_lines + num_entries;
+    }
     
 
     /** @brief Reads a sparse matrix from a file (MatrixMarket format)
     *
-    * @param mat The matrix that is to be read (ublas-types and std::vector< std::map <unsigned int, ScalarType> > are supported)
+    * @param mat The matrix that is to be read (ublas-types, std::vector< std::map <unsigned int, ScalarType> >, viennacl::compressed_matrix and viennacl::matrix are supported)
     * @param file The filename
     * @param index_base The index base, typically 1
     * @tparam MatrixType A generic matrix type. Type requirements: size1() returns number of rows, size2() returns number columns, operator() writes array entries, resize() allows resizing the matrix.
@@ -382,6 +1082,41 @@ namespace viennacl
       writer.close();
     }
 
+    /** @brief Writes a dense viennacl::matrix to a file in MatrixMarket 'array' format (entries listed column by column) */
+    template <typename ScalarType, typename F, unsigned int ALIGNMENT>
+    void write_matrix_market_file_impl(viennacl::matrix<ScalarType, F, ALIGNMENT> const & mat, const char * file, long /*index_base*/)
+    {
+      std::vector<ScalarType> data(mat.internal_size());
+      if (data.size() > 0)
+        viennacl::backend::memory_read(mat.handle(), 0, sizeof(ScalarType) * data.size(), &(data[0]));
+
+      std::ofstream writer(file);
+      writer.precision(std::numeric_limits<ScalarType>::digits10 + 2);  //enough digits for a lossless round trip
+
+      writer << "%%MatrixMarket matrix array real general" << std::endl;
+      writer << mat.size1() << " " << mat.size2() << std::endl;
+
+      for (std::size_t j = 0; j < mat.size2(); ++j)
+        for (std::size_t i = 0; i < mat.size1(); ++i)
+          writer << data[F::mem_index(i, j, mat.internal_size1(), mat.internal_size2())] << std::endl;
+
+      writer.close();
+    }
+
+    /** @brief Writes a dense matrix to a file (MatrixMarket 'array' format)
+    *
+    * @param mat The matrix that is to be written
+    * @param file The filename
+    * @param index_base Unused, as no indices are written in 'array' format
+    */
+    template <typename ScalarType, typename F, unsigned int ALIGNMENT>
+    void write_matrix_market_file(viennacl::matrix<ScalarType, F, ALIGNMENT> const & mat,
+                                  const char * file,
+                                  long index_base = 1)
+    {
+      write_matrix_market_file_impl(mat, file, index_base);
+    }
+
     template <typename ScalarType>
     void write_matrix_market_file(std::vector< std::map<unsigned int, ScalarType> > const & mat,
                                   const char * file,
@@ -0,0 +1,187 @@
+#ifndef VIENNACL_LINALG_BATCHED_OPERATIONS_HPP_
+#define VIENNACL_LINALG_BATCHED_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/batched_operations.hpp
+    @brief Implementations of products, LU factorizations, triangular solves, and inverses for batches of small dense matrices (viennacl::batched_matrix).
+*/
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/handle.hpp"
+#include "viennacl/linalg/host_based/batched_operations.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+
+    /** @brief Carries out C_b = A_b * B_b for all matrices of the batch. Usually called from C = prod(A, B).
+    *
+    * @param A   The first factors
+    * @param B   The second factors
+    * @param C   The results. Must not share memory with A or B.
+    */
+    template <typename NumericT, typename F>
+    void prod_impl(const batched_matrix<NumericT, F> & A,
+                   const batched_matrix<NumericT, F> & B,
+                         batched_matrix<NumericT, F> & C)
+    {
+      assert( (A.batch_size() == B.batch_size()) && (A.batch_size() == C.batch_size()) && bool("Size check failed at C = prod(A, B): Batch sizes differ"));
+      assert( (A.size1() == C.size1()) && bool("Size check failed at C = prod(A, B): size1(A) != size1(C)"));
+      assert( (A.size2() == B.size1()) && bool("Size check failed at C = prod(A, B): size2(A) != size1(B)"));
+      assert( (B.size2() == C.size2()) && bool("Size check failed at C = prod(A, B): size2(B) != size2(C)"));
+
+      if (C.batch_size() == 0)
+        return;
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::prod_impl(A, B, C);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+    /** @brief LU factorization with partial pivoting of all matrices of a batch.
+    *
+    * @param A             The square matrices, overwritten by the LU factors
+    * @param permutations  The row permutations: Entries [b * n, (b+1) * n) hold the permutation of matrix b. Row i of P_b A_b is row permutations[b * n + i] of A_b.
+    */
+    template <typename NumericT, typename F>
+    void lu_factorize(batched_matrix<NumericT, F> & A, std::vector<std::size_t> & permutations)
+    {
+      assert( (A.size1() == A.size2()) && bool("Matrices must be square for the LU factorization!"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::lu_factorize(A, permutations);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+    /** @brief Solves A_b X_b = B_b in place for all matrices of a batch, given the factors computed by lu_factorize().
+    *
+    * @param A             The LU factors
+    * @param permutations  The row permutations computed by lu_factorize()
+    * @param B             The load vectors (n x num_rhs each), overwritten by the solutions
+    */
+    template <typename NumericT, typename F>
+    void lu_substitute(batched_matrix<NumericT, F> const & A, std::vector<std::size_t> const & permutations, batched_matrix<NumericT, F> & B)
+    {
+      assert( (A.batch_size() == B.batch_size()) && bool("Batch sizes differ in lu_substitute()!"));
+      assert( (A.size1() == A.size2()) && (A.size1() == B.size1()) && bool("Size check failed in lu_substitute()!"));
+      assert( (permutations.size() == A.batch_size() * A.size1()) && bool("Invalid size of permutation vector in lu_substitute()!"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::batched_solve(A, &permutations, B, true, true);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+    namespace detail
+    {
+      template <typename NumericT, typename F>
+      void batched_inplace_solve(batched_matrix<NumericT, F> const & A, batched_matrix<NumericT, F> & B, bool lower, bool unit)
+      {
+        assert( (A.batch_size() == B.batch_size()) && bool("Batch sizes differ in inplace_solve()!"));
+        assert( (A.size1() == A.size2()) && (A.size1() == B.size1()) && bool("Size check failed in inplace_solve()!"));
+
+        switch (viennacl::traits::handle(A).get_active_handle_id())
+        {
+          case viennacl::MAIN_MEMORY:
+            viennacl::linalg::host_based::batched_solve(A, static_cast<std::vector<std::size_t> const *>(NULL), B, lower, unit);
+            break;
+          default:
+            throw "not implemented";
+        }
+      }
+    }
+
+    /** @brief Solves the lower triangular systems A_b X_b = B_b in place for all matrices of a batch */
+    template <typename NumericT, typename F>
+    void inplace_solve(batched_matrix<NumericT, F> const & A, batched_matrix<NumericT, F> & B, viennacl::linalg::lower_tag)
+    {
+      detail::batched_inplace_solve(A, B, true, false);
+    }
+
+    /** @brief Solves the unit lower triangular systems A_b X_b = B_b in place for all matrices of a batch */
+    template <typename NumericT, typename F>
+    void inplace_solve(batched_matrix<NumericT, F> const & A, batched_matrix<NumericT, F> & B, viennacl::linalg::unit_lower_tag)
+    {
+      detail::batched_inplace_solve(A, B, true, true);
+    }
+
+    /** @brief Solves the upper triangular systems A_b X_b = B_b in place for all matrices of a batch */
+    template <typename NumericT, typename F>
+    void inplace_solve(batched_matrix<NumericT, F> const & A, batched_matrix<NumericT, F> & B, viennacl::linalg::upper_tag)
+    {
+      detail::batched_inplace_solve(A, B, false, false);
+    }
+
+    /** @brief Solves the unit upper triangular systems A_b X_b = B_b in place for all matrices of a batch */
+    template <typename NumericT, typename F>
+    void inplace_solve(batched_matrix<NumericT, F> const & A, batched_matrix<NumericT, F> & B, viennacl::linalg::unit_upper_tag)
+    {
+      detail::batched_inplace_solve(A, B, false, true);
+    }
+
+    /** @brief Computes the inverses of all matrices of a batch using LU factorizations with partial pivoting.
+    *
+    * @param A       The square matrices (unchanged)
+    * @param A_inv   The inverses. Must not share memory with A. Memory is allocated if A_inv is empty.
+    */
+    template <typename NumericT, typename F>
+    void inverse(batched_matrix<NumericT, F> const & A, batched_matrix<NumericT, F> & A_inv)
+    {
+      assert( (A.size1() == A.size2()) && bool("Only square matrices can be inverted!"));
+
+      if (A_inv.batch_size() == 0)
+        A_inv = batched_matrix<NumericT, F>(A.batch_size(), A.size1(), A.size2(), 0, viennacl::traits::handle(A).get_active_handle_id());
+
+      assert( (A.batch_size() == A_inv.batch_size()) && (A.size1() == A_inv.size1()) && (A.size2() == A_inv.size2()) && bool("Size check failed in inverse()!"));
+
+      if (A.batch_size() == 0)
+        return;
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::inverse(A, A_inv);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -29,6 +29,7 @@
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/inner_prod.hpp"
 #include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/iterative_operations.hpp"
 #include "viennacl/traits/clear.hpp"
 #include "viennacl/traits/size.hpp"
 #include "viennacl/meta/result_of.hpp"
@@ -79,94 +80,225 @@ namespace viennacl
     };
     
 
-    /** @brief Implementation of the stabilized Bi-conjugate gradient solver
-    *
-    * Following the description in "Iterative Methods for Sparse Linear Systems" by Y. Saad
-    *
-    * @param matrix     The system matrix
-    * @param rhs        The load vector
-    * @param tag        Solver configuration tag
-    * @return The result vector
-    */
-    template <typename MatrixType, typename VectorType>
-    VectorType solve(const MatrixType & matrix, VectorType const & rhs, bicgstab_tag const & tag)
+    namespace detail
     {
-      typedef typename viennacl::result_of::value_type<VectorType>::type        ScalarType;
-      typedef typename viennacl::result_of::cpu_value_type<ScalarType>::type    CPU_ScalarType;
-      unsigned int problem_size = viennacl::traits::size(rhs);
-      VectorType result(problem_size);
-      viennacl::traits::clear(result);
+      /** @brief Implementation of the stabilized Bi-conjugate gradient solver
+      *
+      * Following the description in "Iterative Methods for Sparse Linear Systems" by Y. Saad
+      *
+      * @param matrix     The system matrix
+      * @param rhs        The load vector
+      * @param tag        Solver configuration tag
+      * @return The result vector
+      */
+      template <typename MatrixType, typename VectorType>
+      VectorType solve_impl(const MatrixType & matrix, VectorType const & rhs, bicgstab_tag const & tag)
+      {
+        typedef typename viennacl::result_of::value_type<VectorType>::type        ScalarType;
+        typedef typename viennacl::result_of::cpu_value_type<ScalarType>::type    CPU_ScalarType;
+        unsigned int problem_size = viennacl::traits::size(rhs);
+        VectorType result(problem_size);
+        viennacl::traits::clear(result);
 
-      VectorType residual = rhs;
-      VectorType p = rhs;
-      VectorType r0star = rhs;
-      VectorType tmp0(problem_size);
-      VectorType tmp1(problem_size);
-      VectorType s(problem_size);
+        VectorType residual = rhs;
+        VectorType p = rhs;
+        VectorType r0star = rhs;
+        VectorType tmp0(problem_size);
+        VectorType tmp1(problem_size);
+        VectorType s(problem_size);
 
-      CPU_ScalarType norm_rhs_host = viennacl::linalg::norm_2(residual);
-      CPU_ScalarType ip_rr0star = norm_rhs_host * norm_rhs_host;
-      CPU_ScalarType beta;
-      CPU_ScalarType alpha;
-      CPU_ScalarType omega;
-      //ScalarType inner_prod_temp; //temporary variable for inner product computation
-      CPU_ScalarType new_ip_rr0star = 0;
-      CPU_ScalarType residual_norm = norm_rhs_host;
+        CPU_ScalarType norm_rhs_host = viennacl::linalg::norm_2(residual);
+        CPU_ScalarType ip_rr0star = norm_rhs_host * norm_rhs_host;
+        CPU_ScalarType beta;
+        CPU_ScalarType alpha;
+        CPU_ScalarType omega;
+        //ScalarType inner_prod_temp; //temporary variable for inner product computation
+        CPU_ScalarType new_ip_rr0star = 0;
+        CPU_ScalarType residual_norm = norm_rhs_host;
       
-      if (norm_rhs_host == 0) //solution is zero if RHS norm is zero
-        return result;
+        if (norm_rhs_host == 0) //solution is zero if RHS norm is zero
+          return result;
       
-      bool restart_flag = true;
-      std::size_t last_restart = 0;
-      for (std::size_t i = 0; i < tag.max_iterations(); ++i)
-      {
-        if (restart_flag)
+        bool restart_flag = true;
+        std::size_t last_restart = 0;
+        for (std::size_t i = 0; i < tag.max_iterations(); ++i)
         {
-          residual = rhs;
-          residual -= viennacl::linalg::prod(matrix, result);
-          p = residual;
-          r0star = residual;
-          ip_rr0star = viennacl::linalg::norm_2(residual);
-          ip_rr0star *= ip_rr0star;
-          restart_flag = false;
-          last_restart = i;
-        }
+          if (restart_flag)
+          {
+            residual = rhs;
+            residual -= viennacl::linalg::prod(matrix, result);
+            p = residual;
+            r0star = residual;
+            ip_rr0star = viennacl::linalg::norm_2(residual);
+            ip_rr0star *= ip_rr0star;
+            restart_flag = false;
+            last_restart = i;
+          }
         
-        tag.iters(i+1);
-        tmp0 = viennacl::linalg::prod(matrix, p);
-        alpha = ip_rr0star / viennacl::linalg::inner_prod(tmp0, r0star);
+          tag.iters(i+1);
+          tmp0 = viennacl::linalg::prod(matrix, p);
+          alpha = ip_rr0star / viennacl::linalg::inner_prod(tmp0, r0star);
 
-        s = residual - alpha*tmp0;
+          s = residual - alpha*tmp0;
         
-        tmp1 = viennacl::linalg::prod(matrix, s);
-        CPU_ScalarType norm_tmp1 = viennacl::linalg::norm_2(tmp1);
-        omega = viennacl::linalg::inner_prod(tmp1, s) / (norm_tmp1 * norm_tmp1);
+          tmp1 = viennacl::linalg::prod(matrix, s);
+          CPU_ScalarType norm_tmp1 = viennacl::linalg::norm_2(tmp1);
+          omega = viennacl::linalg::inner_prod(tmp1, s) / (norm_tmp1 * norm_tmp1);
         
-        result += alpha * p + omega * s;
-        residual = s - omega * tmp1;
+          result += alpha * p + omega * s;
+          residual = s - omega * tmp1;
         
-        new_ip_rr0star = viennacl::linalg::inner_prod(residual, r0star);
-        residual_norm = viennacl::linalg::norm_2(residual);
-        if (std::fabs(residual_norm / norm_rhs_host) < tag.tolerance())
-          break;
+          new_ip_rr0star = viennacl::linalg::inner_prod(residual, r0star);
+          residual_norm = viennacl::linalg::norm_2(residual);
+          if (std::fabs(residual_norm / norm_rhs_host) < tag.tolerance())
+            break;
         
-        beta = new_ip_rr0star / ip_rr0star * alpha/omega;
-        ip_rr0star = new_ip_rr0star;
+          beta = new_ip_rr0star / ip_rr0star * alpha/omega;
+          ip_rr0star = new_ip_rr0star;
 
-        if (ip_rr0star == 0 || omega == 0 || i - last_restart > tag.max_iterations_before_restart()) //search direction degenerate. A restart might help
-          restart_flag = true;
+          if (ip_rr0star == 0 || omega == 0 || i - last_restart > tag.max_iterations_before_restart()) //search direction degenerate. A restart might help
+            restart_flag = true;
         
-        // Execution of
-        //  p = residual + beta * (p - omega*tmp0);
-        // without introducing temporary vectors:
-        p -= omega * tmp0;
-        p = residual + beta * p;
-      }
+          // Execution of
+          //  p = residual + beta * (p - omega*tmp0);
+          // without introducing temporary vectors:
+          p -= omega * tmp0;
+          p = residual + beta * p;
+        }
       
-      //store last error estimate:
-      tag.error(residual_norm / norm_rhs_host);
+        //store last error estimate:
+        tag.error(residual_norm / norm_rhs_host);
       
-      return result;
+        return result;
+      }
+
+
+      /** @brief Implementation of a pipelined stabilized Bi-conjugate gradient solver without preconditioner for a compressed_matrix on the host
+      *
+      * All inner products are computed within the passes which produce their operands. Thus, each iteration consists of only four passes over the data:
+      *   1. Ap = prod(A, p) together with <Ap, r0star>
+      *   2. s = r - alpha * Ap together with <s, s> and <s, r0star>
+      *   3. As = prod(A, s) together with <As, As>, <s, As> and <As, r0star>, so that beta is known from <r_new, r0star> = <s, r0star> - omega * <As, r0star>
+      *   4. The updates of result, residual and search direction together with <r, r> for the convergence check and <r, r0star> for the next iteration
+      *
+      * @param A          The system matrix
+      * @param rhs        The load vector
+      * @param tag        Solver configuration tag
+      * @return The result vector
+      */
+      template <typename ScalarType, unsigned int MAT_ALIGNMENT, unsigned int VEC_ALIGNMENT>
+      viennacl::vector<ScalarType, VEC_ALIGNMENT> pipelined_solve(compressed_matrix<ScalarType, MAT_ALIGNMENT> const & A,
+                                                                  viennacl::vector<ScalarType, VEC_ALIGNMENT> const & rhs,
+                                                                  bicgstab_tag const & tag)
+      {
+        typedef viennacl::vector<ScalarType, VEC_ALIGNMENT>   VectorType;
+
+        VectorType result(rhs.size());
+        viennacl::switch_memory_domain(result, viennacl::MAIN_MEMORY);
+        viennacl::traits::clear(result);
+
+        VectorType residual = rhs;
+        VectorType p = rhs;
+        VectorType r0star = rhs;
+        VectorType Ap(rhs.size());
+        VectorType s(rhs.size());
+        VectorType As(rhs.size());
+        viennacl::switch_memory_domain(Ap, viennacl::MAIN_MEMORY);
+        viennacl::switch_memory_domain(s,  viennacl::MAIN_MEMORY);
+        viennacl::switch_memory_domain(As, viennacl::MAIN_MEMORY);
+
+        ScalarType norm_rhs_host = viennacl::linalg::norm_2(residual);
+        ScalarType ip_rr0star = norm_rhs_host * norm_rhs_host;
+        ScalarType residual_norm = norm_rhs_host;
+        ScalarType inner_prod_ApAp = 0, inner_prod_pAp = 0, inner_prod_Ap_r0star = 0;
+        ScalarType inner_prod_ss = 0, inner_prod_s_r0star = 0;
+        ScalarType inner_prod_AsAs = 0, inner_prod_sAs = 0, inner_prod_As_r0star = 0;
+
+        if (norm_rhs_host == 0) //solution is zero if RHS norm is zero
+          return result;
+
+        bool restart_flag = false;
+        std::size_t last_restart = 0;
+        for (std::size_t i = 0; i < tag.max_iterations(); ++i)
+        {
+          if (restart_flag)
+          {
+            residual = rhs;
+            residual -= viennacl::linalg::prod(A, result);
+            p = residual;
+            r0star = residual;
+            ip_rr0star = viennacl::linalg::norm_2(residual);
+            ip_rr0star *= ip_rr0star;
+            restart_flag = false;
+            last_restart = i;
+          }
+
+          tag.iters(i+1);
+          viennacl::linalg::pipelined_bicgstab_prod(A, p, Ap, r0star, inner_prod_ApAp, inner_prod_pAp, inner_prod_Ap_r0star);
+          ScalarType alpha = ip_rr0star / inner_prod_Ap_r0star;
+
+          viennacl::linalg::pipelined_bicgstab_update_s(s, residual, alpha, Ap, r0star, inner_prod_ss, inner_prod_s_r0star);
+          if (std::sqrt(inner_prod_ss) / norm_rhs_host < tag.tolerance()) //s is already small enough, no need for the stabilization step
+          {
+            result += alpha * p;
+            residual_norm = std::sqrt(inner_prod_ss);
+            break;
+          }
+
+          viennacl::linalg::pipelined_bicgstab_prod(A, s, As, r0star, inner_prod_AsAs, inner_prod_sAs, inner_prod_As_r0star);
+          ScalarType omega = inner_prod_sAs / inner_prod_AsAs;
+
+          ScalarType new_ip_rr0star = inner_prod_s_r0star - omega * inner_prod_As_r0star;
+          ScalarType beta = new_ip_rr0star / ip_rr0star * alpha/omega;
+
+          residual_norm = std::sqrt(viennacl::linalg::pipelined_bicgstab_vector_update(result, alpha, p, omega, s, residual, As, beta, Ap, r0star, ip_rr0star));
+          if (residual_norm / norm_rhs_host < tag.tolerance())
+            break;
+
+          if (ip_rr0star == 0 || omega == 0 || i - last_restart > tag.max_iterations_before_restart()) //search direction degenerate. A restart might help
+            restart_flag = true;
+        }
+
+        //store last error estimate:
+        tag.error(residual_norm / norm_rhs_host);
+
+        return result;
+      }
+    }
+
+    /** @brief Implementation of the stabilized Bi-conjugate gradient solver
+    *
+    * Following the description in "Iterative Methods for Sparse Linear Systems" by Y. Saad
+    *
+    * @param matrix     The system matrix
+    * @param rhs        The load vector
+    * @param tag        Solver configuration tag
+    * @return The result vector
+    */
+    template <typename MatrixType, typename VectorType>
+    VectorType solve(const MatrixType & matrix, VectorType const & rhs, bicgstab_tag const & tag)
+    {
+      return detail::solve_impl(matrix, rhs, tag);
+    }
+
+    /** @brief Implementation of the stabilized Bi-conjugate gradient solver without preconditioner for a compressed_matrix
+    *
+    * If both the matrix and the load vector reside in main memory, the pipelined variant with fused vector operations is used.
+    *
+    * @param matrix     The system matrix
+    * @param rhs        The load vector
+    * @param tag        Solver configuration tag
+    * @return The result vector
+    */
+    template <typename ScalarType, unsigned int MAT_ALIGNMENT, unsigned int VEC_ALIGNMENT>
+    viennacl::vector<ScalarType, VEC_ALIGNMENT> solve(compressed_matrix<ScalarType, MAT_ALIGNMENT> const & matrix,
+                                                      viennacl::vector<ScalarType, VEC_ALIGNMENT> const & rhs,
+                                                      bicgstab_tag const & tag)
+    {
+      if (matrix.handle().get_active_handle_id() == viennacl::MAIN_MEMORY && rhs.handle().get_active_handle_id() == viennacl::MAIN_MEMORY)
+        return detail::pipelined_solve(matrix, rhs, tag);
+
+      return detail::solve_impl(matrix, rhs, tag);
     }
 
     template <typename MatrixType, typename VectorType>
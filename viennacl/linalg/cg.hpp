@@ -31,6 +31,7 @@
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/inner_prod.hpp"
 #include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/iterative_operations.hpp"
 #include "viennacl/traits/clear.hpp"
 #include "viennacl/traits/size.hpp"
 #include "viennacl/meta/result_of.hpp"
@@ -77,6 +78,128 @@ namespace viennacl
     };
     
 
+    namespace detail
+    {
+      /** @brief Implementation of the conjugate gradient solver without preconditioner
+      *
+      * Following the algorithm in the book by Y. Saad "Iterative Methods for sparse linear systems"
+      *
+      * @param matrix     The system matrix
+      * @param rhs        The load vector
+      * @param tag        Solver configuration tag
+      * @return The result vector
+      */
+      template <typename MatrixType, typename VectorType>
+      VectorType solve_impl(const MatrixType & matrix, VectorType const & rhs, cg_tag const & tag)
+      {
+        //typedef typename VectorType::value_type      ScalarType;
+        typedef typename viennacl::result_of::value_type<VectorType>::type        ScalarType;
+        typedef typename viennacl::result_of::cpu_value_type<ScalarType>::type    CPU_ScalarType;
+        //std::cout << "Starting CG" << std::endl;
+        std::size_t problem_size = viennacl::traits::size(rhs);
+        VectorType result(problem_size);
+        viennacl::traits::clear(result);
+
+        VectorType residual = rhs;
+        VectorType p = rhs;
+        VectorType tmp(problem_size);
+
+        CPU_ScalarType ip_rr = viennacl::linalg::inner_prod(rhs,rhs);
+        CPU_ScalarType alpha;
+        CPU_ScalarType new_ip_rr = 0;
+        CPU_ScalarType beta;
+        CPU_ScalarType norm_rhs = std::sqrt(ip_rr);
+      
+        //std::cout << "Starting CG solver iterations... " << std::endl;
+        if (norm_rhs == 0) //solution is zero if RHS norm is zero
+          return result;
+      
+        for (unsigned int i = 0; i < tag.max_iterations(); ++i)
+        {
+          tag.iters(i+1);
+          tmp = viennacl::linalg::prod(matrix, p);
+
+          alpha = ip_rr / viennacl::linalg::inner_prod(tmp, p);
+          result += alpha * p;
+          residual -= alpha * tmp;
+        
+          new_ip_rr = viennacl::linalg::norm_2(residual);
+          if (new_ip_rr / norm_rhs < tag.tolerance())
+            break;
+          new_ip_rr *= new_ip_rr;
+        
+          beta = new_ip_rr / ip_rr;
+          ip_rr = new_ip_rr;
+
+          p = residual + beta * p;
+        } 
+      
+        //store last error estimate:
+        tag.error(std::sqrt(new_ip_rr) / norm_rhs);
+      
+        return result;
+      }
+
+
+      /** @brief Implementation of a pipelined conjugate gradient solver without preconditioner for a compressed_matrix on the host
+      *
+      * Following the variant of Chronopoulos and Gear, the recurrence <r_new, r_new> = alpha^2 <Ap, Ap> - <r, r> provides beta before the residual is updated.
+      * Thus, each iteration consists of only two passes over the data:
+      *   1. Ap = prod(A, p) together with the inner products <Ap, Ap> and <p, Ap>
+      *   2. The updates of result, residual and search direction together with the inner product <r, r> for the convergence check
+      *
+      * @param A          The system matrix
+      * @param rhs        The load vector
+      * @param tag        Solver configuration tag
+      * @return The result vector
+      */
+      template <typename ScalarType, unsigned int MAT_ALIGNMENT, unsigned int VEC_ALIGNMENT>
+      viennacl::vector<ScalarType, VEC_ALIGNMENT> pipelined_solve(compressed_matrix<ScalarType, MAT_ALIGNMENT> const & A,
+                                                                  viennacl::vector<ScalarType, VEC_ALIGNMENT> const & rhs,
+                                                                  cg_tag const & tag)
+      {
+        typedef viennacl::vector<ScalarType, VEC_ALIGNMENT>   VectorType;
+
+        VectorType result(rhs.size());
+        viennacl::switch_memory_domain(result, viennacl::MAIN_MEMORY);
+        viennacl::traits::clear(result);
+
+        VectorType residual = rhs;
+        VectorType p = rhs;
+        VectorType Ap(rhs.size());
+        viennacl::switch_memory_domain(Ap, viennacl::MAIN_MEMORY);
+
+        ScalarType ip_rr = viennacl::linalg::inner_prod(rhs, rhs);
+        ScalarType norm_rhs = std::sqrt(ip_rr);
+        ScalarType inner_prod_ApAp = 0;
+        ScalarType inner_prod_pAp = 0;
+
+        if (norm_rhs == 0) //solution is zero if RHS norm is zero
+          return result;
+
+        for (unsigned int i = 0; i < tag.max_iterations(); ++i)
+        {
+          tag.iters(i+1);
+          viennacl::linalg::pipelined_cg_prod(A, p, Ap, inner_prod_ApAp, inner_prod_pAp);
+
+          if (inner_prod_pAp == 0) //search direction degenerate
+            break;
+
+          ScalarType alpha = ip_rr / inner_prod_pAp;
+          ScalarType beta  = alpha * alpha * inner_prod_ApAp / ip_rr - ScalarType(1);
+
+          ip_rr = viennacl::linalg::pipelined_cg_vector_update(result, alpha, p, residual, Ap, beta);
+          if (std::sqrt(ip_rr) / norm_rhs < tag.tolerance())
+            break;
+        }
+
+        //store last error estimate:
+        tag.error(std::sqrt(ip_rr) / norm_rhs);
+
+        return result;
+      }
+    }
+
     /** @brief Implementation of the conjugate gradient solver without preconditioner
     *
     * Following the algorithm in the book by Y. Saad "Iterative Methods for sparse linear systems"
@@ -89,52 +212,27 @@ namespace viennacl
     template <typename MatrixType, typename VectorType>
     VectorType solve(const MatrixType & matrix, VectorType const & rhs, cg_tag const & tag)
     {
-      //typedef typename VectorType::value_type      ScalarType;
-      typedef typename viennacl::result_of::value_type<VectorType>::type        ScalarType;
-      typedef typename viennacl::result_of::cpu_value_type<ScalarType>::type    CPU_ScalarType;
-      //std::cout << "Starting CG" << std::endl;
-      std::size_t problem_size = viennacl::traits::size(rhs);
-      VectorType result(problem_size);
-      viennacl::traits::clear(result);
-
-      VectorType residual = rhs;
-      VectorType p = rhs;
-      VectorType tmp(problem_size);
-
-      CPU_ScalarType ip_rr = viennacl::linalg::inner_prod(rhs,rhs);
-      CPU_ScalarType alpha;
-      CPU_ScalarType new_ip_rr = 0;
-      CPU_ScalarType beta;
-      CPU_ScalarType norm_rhs = std::sqrt(ip_rr);
-      
-      //std::cout << "Starting CG solver iterations... " << std::endl;
-      if (norm_rhs == 0) //solution is zero if RHS norm is zero
-        return result;
-      
-      for (unsigned int i = 0; i < tag.max_iterations(); ++i)
-      {
-        tag.iters(i+1);
-        tmp = viennacl::linalg::prod(matrix, p);
+      return detail::solve_impl(matrix, rhs, tag);
+    }
 
-        alpha = ip_rr / viennacl::linalg::inner_prod(tmp, p);
-        result += alpha * p;
-        residual -= alpha * tmp;
-        
-        new_ip_rr = viennacl::linalg::norm_2(residual);
-        if (new_ip_rr / norm_rhs < tag.tolerance())
-          break;
-        new_ip_rr *= new_ip_rr;
-        
-        beta = new_ip_rr / ip_rr;
-        ip_rr = new_ip_rr;
+    /** @brief Implementation of the conjugate gradient solver without preconditioner for a compressed_matrix
+    *
+    * If both the matrix and the load vector reside in main memory, the pipelined variant with fused vector operations is used.
+    *
+    * @param matrix     The system matrix
+    * @param rhs        The load vector
+    * @param tag        Solver configuration tag
+    * @return The result vector
+    */
+    template <typename ScalarType, unsigned int MAT_ALIGNMENT, unsigned int VEC_ALIGNMENT>
+    viennacl::vector<ScalarType, VEC_ALIGNMENT> solve(compressed_matrix<ScalarType, MAT_ALIGNMENT> const & matrix,
+                                                      viennacl::vector<ScalarType, VEC_ALIGNMENT> const & rhs,
+                                                      cg_tag const & tag)
+    {
+      if (matrix.handle().get_active_handle_id() == viennacl::MAIN_MEMORY && rhs.handle().get_active_handle_id() == viennacl::MAIN_MEMORY)
+        return detail::pipelined_solve(matrix, rhs, tag);
 
-        p = residual + beta * p;
-      } 
-      
-      //store last error estimate:
-      tag.error(std::sqrt(new_ip_rr) / norm_rhs);
-      
-      return result;
+      return detail::solve_impl(matrix, rhs, tag);
     }
 
     template <typename MatrixType, typename VectorType>
@@ -0,0 +1,150 @@
+#ifndef VIENNACL_LINALG_CHOLESKY_HPP
+#define VIENNACL_LINALG_CHOLESKY_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/cholesky.hpp
+    @brief Implementation of the Cholesky factorization A = L L^T for dense symmetric positive definite matrices.
+*/
+
+#include <vector>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/direct_solve.hpp"
+#include "viennacl/linalg/host_based/cholesky.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace detail
+    {
+      /** @brief Returns the submatrix of A with the given offset and size. Works for matrices, ranges, and slices, and shares the memory with A. */
+      template <typename NumericT, typename F>
+      matrix_base<NumericT, F> cholesky_block(matrix_base<NumericT, F> & A, std::size_t row_start, std::size_t col_start, std::size_t num_rows, std::size_t num_cols)
+      {
+        return matrix_base<NumericT, F>(A.handle(),
+                                        num_rows, A.start1() + row_start * A.stride1(), A.stride1(), A.internal_size1(),
+                                        num_cols, A.start2() + col_start * A.stride2(), A.stride2(), A.internal_size2());
+      }
+
+      /** @brief Blocked right-looking Cholesky factorization built on prod() and inplace_solve(). The diagonal blocks are factored on the host.
+      *
+      * In contrast to the host-based implementation, the trailing update also writes to the strict upper triangle of A.
+      */
+      template <typename NumericT, typename F>
+      void cholesky_factorize_blocked(matrix_base<NumericT, F> & A)
+      {
+        std::size_t n = A.size1();
+        const std::size_t block_size = VIENNACL_CHOLESKY_BLOCK_SIZE;
+
+        for (std::size_t kb = 0; kb < n; kb += block_size)
+        {
+          std::size_t w = std::min(block_size, n - kb);
+          std::size_t remainder = n - kb - w;
+
+          // Factor the diagonal block on the host:
+          matrix_base<NumericT, F> A_11 = cholesky_block(A, kb, kb, w, w);
+          viennacl::matrix<NumericT, F> A_11_copy(w, w);
+          A_11_copy = A_11;
+
+          std::vector<NumericT> buffer(A_11_copy.internal_size());
+          viennacl::backend::memory_read(A_11_copy.handle(), 0, sizeof(NumericT) * buffer.size(), &(buffer[0]));
+          viennacl::linalg::host_based::detail::cholesky_factorize_unblocked(
+            viennacl::linalg::host_based::detail::strided_matrix_view<NumericT>(&(buffer[0]), w, w,
+                                                                                F::mem_index(1, 0, A_11_copy.internal_size1(), A_11_copy.internal_size2()),
+                                                                                F::mem_index(0, 1, A_11_copy.internal_size1(), A_11_copy.internal_size2())));
+          viennacl::backend::memory_write(A_11_copy.handle(), 0, sizeof(NumericT) * buffer.size(), &(buffer[0]));
+          A_11 = A_11_copy;
+
+          if (remainder > 0)
+          {
+            // L_21 = A_21 L_11^{-T}:
+            matrix_base<NumericT, F> A_21 = cholesky_block(A, kb + w, kb, remainder, w);
+            viennacl::linalg::inplace_solve(A_11, trans(A_21), lower_tag());
+
+            // A_22 -= L_21 L_21^T:
+            matrix_base<NumericT, F> A_22 = cholesky_block(A, kb + w, kb + w, remainder, remainder);
+            A_22 -= viennacl::linalg::prod(A_21, trans(A_21));
+          }
+        }
+      }
+    }
+
+    /** @brief Cholesky factorization A = L L^T of a dense symmetric positive definite matrix, range, or slice.
+    *
+    * Only the lower triangle of A is referenced on input. On output, the lower triangle of A holds L. The strict upper triangle is used as workspace by the OpenCL path.
+    * Throws if A is found to be not positive definite.
+    *
+    * @param A    The system matrix, where L is directly written to
+    */
+    template <typename NumericT, typename F>
+    void cholesky_factorize(matrix_base<NumericT, F> & A)
+    {
+      assert(A.size1() == A.size2() && bool("Matrix must be square"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::detail::cholesky_factorize(viennacl::linalg::host_based::detail::make_strided_view(A));
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          detail::cholesky_factorize_blocked(A);
+          break;
+#endif
+        default:
+          throw "not implemented";
+      }
+    }
+
+    /** @brief Solves L L^T X = B for the Cholesky factor L computed by cholesky_factorize().
+    *
+    * @param L    The Cholesky factor (lower triangle)
+    * @param B    The matrix of load vectors, where the solution is directly written to
+    */
+    template <typename NumericT, typename F1, typename F2>
+    void cholesky_substitute(matrix_base<NumericT, F1> const & L, matrix_base<NumericT, F2> & B)
+    {
+      assert(L.size1() == L.size2() && bool("Matrix must be square"));
+      assert(L.size1() == B.size1() && bool("Size of load vectors does not match"));
+      inplace_solve(L, B, lower_tag());
+      inplace_solve(trans(L), B, upper_tag());
+    }
+
+    /** @brief Solves L L^T x = b for the Cholesky factor L computed by cholesky_factorize().
+    *
+    * @param L      The Cholesky factor (lower triangle)
+    * @param vec    The load vector, where the solution is directly written to
+    */
+    template <typename NumericT, typename F>
+    void cholesky_substitute(matrix_base<NumericT, F> const & L, vector_base<NumericT> & vec)
+    {
+      assert(L.size1() == L.size2() && bool("Matrix must be square"));
+      assert(L.size1() == vec.size() && bool("Size of load vector does not match"));
+      inplace_solve(L, vec, lower_tag());
+      inplace_solve(trans(L), vec, upper_tag());
+    }
+
+  }
+}
+
+#endif
@@ -23,6 +23,7 @@
 */
 
 #include <vector>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <map>
@@ -35,6 +36,10 @@
 #include "viennacl/linalg/host_based/common.hpp"
 #include "viennacl/linalg/misc_operations.hpp"
 
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace viennacl
 {
   namespace linalg
@@ -213,6 +218,70 @@ namespace viennacl
       }
       
       
+      /** @brief Returns true if level-scheduled substitutions can run in parallel on the host, i.e. if OpenMP provides more than one thread. */
+      inline bool host_level_scheduling_available()
+      {
+#ifdef VIENNACL_WITH_OPENMP
+        return omp_get_max_threads() > 1;
+#else
+        return false;
+#endif
+      }
+
+      /** @brief Returns true if level-scheduled substitutions on the host are expected to be faster than a sequential substitution.
+      *
+      * This is the case if each level provides enough rows for all threads, so that the synchronization after each level is amortized.
+      *
+      * @param num_rows     Number of rows of the triangular factor
+      * @param num_levels   Number of levels of the level schedule
+      */
+      inline bool host_level_scheduling_pays_off(std::size_t num_rows, std::size_t num_levels)
+      {
+#ifdef VIENNACL_WITH_OPENMP
+        std::size_t num_threads = static_cast<std::size_t>(omp_get_max_threads());
+        return num_threads > 1 && num_rows >= num_levels * num_threads * 32;
+#else
+        (void)num_rows; (void)num_levels;
+        return false;
+#endif
+      }
+
+      /** @brief Keeps a level schedule which was set up automatically (i.e. not requested by the tag) only if host_level_scheduling_pays_off().
+      *
+      * Otherwise the schedules of both triangular factors are released, so that the preconditioner falls back to the sequential substitution.
+      *
+      * @return true if the level schedule is kept
+      */
+      inline bool host_level_scheduling_keep(std::size_t num_rows,
+                                             std::list< viennacl::backend::mem_handle > & L_row_index_arrays,
+                                             std::list< viennacl::backend::mem_handle > & L_row_buffers,
+                                             std::list< viennacl::backend::mem_handle > & L_col_buffers,
+                                             std::list< viennacl::backend::mem_handle > & L_element_buffers,
+                                             std::list< std::size_t > & L_row_elimination_num_list,
+                                             std::list< viennacl::backend::mem_handle > & U_row_index_arrays,
+                                             std::list< viennacl::backend::mem_handle > & U_row_buffers,
+                                             std::list< viennacl::backend::mem_handle > & U_col_buffers,
+                                             std::list< viennacl::backend::mem_handle > & U_element_buffers,
+                                             std::list< std::size_t > & U_row_elimination_num_list)
+      {
+        if (host_level_scheduling_pays_off(num_rows, std::max(L_row_elimination_num_list.size(), U_row_elimination_num_list.size())))
+          return true;
+
+        //too few rows per level, sequential substitution is faster
+        L_row_index_arrays.clear();
+        L_row_buffers.clear();
+        L_col_buffers.clear();
+        L_element_buffers.clear();
+        L_row_elimination_num_list.clear();
+
+        U_row_index_arrays.clear();
+        U_row_buffers.clear();
+        U_col_buffers.clear();
+        U_element_buffers.clear();
+        U_row_elimination_num_list.clear();
+        return false;
+      }
+
       //
       // Multifrontal substitution (both L and U). Will partly be moved to single_threaded/opencl/cuda implementations
       //
@@ -224,6 +293,12 @@ namespace viennacl
                                        std::list< viennacl::backend::mem_handle > const & element_buffers,
                                        std::list< std::size_t > const & row_elimination_num_list)
       {
+        if (viennacl::traits::handle(vec).get_active_handle_id() == viennacl::MAIN_MEMORY)
+        {
+          viennacl::linalg::host_based::detail::level_scheduling_substitute(vec, row_index_arrays, row_buffers, col_buffers, element_buffers, row_elimination_num_list);
+          return;
+        }
+
         typedef typename std::list< viennacl::backend::mem_handle >::const_iterator  ListIterator;
         ListIterator row_index_array_it = row_index_arrays.begin();
         ListIterator row_buffers_it = row_buffers.begin();
@@ -193,7 +193,7 @@ namespace viennacl
         typedef compressed_matrix<ScalarType, MAT_ALIGNMENT>   MatrixType;
 
       public:
-        ilu0_precond(MatrixType const & mat, ilu0_tag const & tag) : tag_(tag), LU(mat.size1(), mat.size2())
+        ilu0_precond(MatrixType const & mat, ilu0_tag const & tag) : tag_(tag), host_level_scheduling_(false), LU(mat.size1(), mat.size2())
         {
           //initialize preconditioner:
           //std::cout << "Start GPU precond" << std::endl;
@@ -235,7 +235,7 @@ namespace viennacl
           }
           else //apply ILU0 directly on CPU
           {
-            if (tag_.use_level_scheduling())
+            if (tag_.use_level_scheduling() || host_level_scheduling_)
             {
               //std::cout << "Using multifrontal..." << std::endl;
               detail::level_scheduling_substitute(vec,
@@ -271,7 +271,12 @@ namespace viennacl
           LU = mat;
           viennacl::linalg::precondition(LU, tag_);
           
-          if (!tag_.use_level_scheduling())
+          // level scheduling pays off on multi-core CPUs even if not requested explicitly:
+          bool auto_level_scheduling = !tag_.use_level_scheduling()
+                                       && viennacl::memory_domain(mat) == viennacl::MAIN_MEMORY
+                                       && detail::host_level_scheduling_available();
+
+          if (!tag_.use_level_scheduling() && !auto_level_scheduling)
             return;
           
           // multifrontal part:
@@ -295,6 +300,23 @@ namespace viennacl
                                            multifrontal_U_col_buffers_,
                                            multifrontal_U_element_buffers_,
                                            multifrontal_U_row_elimination_num_list_);
+
+          if (auto_level_scheduling)
+          {
+            host_level_scheduling_ = detail::host_level_scheduling_keep(LU.size1(),
+                                                                        multifrontal_L_row_index_arrays_,
+                                                                        multifrontal_L_row_buffers_,
+                                                                        multifrontal_L_col_buffers_,
+                                                                        multifrontal_L_element_buffers_,
+                                                                        multifrontal_L_row_elimination_num_list_,
+                                                                        multifrontal_U_row_index_arrays_,
+                                                                        multifrontal_U_row_buffers_,
+                                                                        multifrontal_U_col_buffers_,
+                                                                        multifrontal_U_element_buffers_,
+                                                                        multifrontal_U_row_elimination_num_list_);
+            if (!host_level_scheduling_)
+              return;
+          }
           
           //
           // Bring to device if necessary:
@@ -350,6 +372,7 @@ namespace viennacl
         }
 
         ilu0_tag const & tag_;
+        bool host_level_scheduling_;
         viennacl::compressed_matrix<ScalarType> LU;
         
         std::list< viennacl::backend::mem_handle > multifrontal_L_row_index_arrays_;
@@ -302,7 +302,7 @@ namespace viennacl
       typedef compressed_matrix<ScalarType, MAT_ALIGNMENT>   MatrixType;
       
       public:
-        ilut_precond(MatrixType const & mat, ilut_tag const & tag) : tag_(tag), LU(mat.size1(), mat.size2())
+        ilut_precond(MatrixType const & mat, ilut_tag const & tag) : tag_(tag), host_level_scheduling_(false), LU(mat.size1(), mat.size2())
         {
           //initialize preconditioner:
           //std::cout << "Start GPU precond" << std::endl;
@@ -344,11 +344,34 @@ namespace viennacl
           }
           else //apply ILUT directly:
           {
-            viennacl::linalg::inplace_solve(LU, vec, unit_lower_tag());
-            viennacl::linalg::inplace_solve(LU, vec, upper_tag());
+            if (tag_.use_level_scheduling() || host_level_scheduling_)
+            {
+              detail::level_scheduling_substitute(vec,
+                                                  multifrontal_L_row_index_arrays_,
+                                                  multifrontal_L_row_buffers_,
+                                                  multifrontal_L_col_buffers_,
+                                                  multifrontal_L_element_buffers_,
+                                                  multifrontal_L_row_elimination_num_list_);
+              
+              vec = viennacl::linalg::element_div(vec, multifrontal_U_diagonal_);
+              
+              detail::level_scheduling_substitute(vec,
+                                                  multifrontal_U_row_index_arrays_,
+                                                  multifrontal_U_row_buffers_,
+                                                  multifrontal_U_col_buffers_,
+                                                  multifrontal_U_element_buffers_,
+                                                  multifrontal_U_row_elimination_num_list_);
+            }
+            else
+            {
+              viennacl::linalg::inplace_solve(LU, vec, unit_lower_tag());
+              viennacl::linalg::inplace_solve(LU, vec, upper_tag());
+            }
           }
         }
         
+        vcl_size_t levels() const { return multifrontal_L_row_index_arrays_.size(); }
+
       private:
         void init(MatrixType const & mat)
         {
@@ -372,7 +395,12 @@ namespace viennacl
             
           viennacl::copy(LU_temp, LU);
           
-          if (!tag_.use_level_scheduling())
+          // level scheduling pays off on multi-core CPUs even if not requested explicitly:
+          bool auto_level_scheduling = !tag_.use_level_scheduling()
+                                       && viennacl::memory_domain(mat) == viennacl::MAIN_MEMORY
+                                       && detail::host_level_scheduling_available();
+
+          if (!tag_.use_level_scheduling() && !auto_level_scheduling)
             return;
           
           //
@@ -399,6 +427,23 @@ namespace viennacl
                                            multifrontal_U_col_buffers_,
                                            multifrontal_U_element_buffers_,
                                            multifrontal_U_row_elimination_num_list_);
+
+          if (auto_level_scheduling)
+          {
+            host_level_scheduling_ = detail::host_level_scheduling_keep(LU.size1(),
+                                                                        multifrontal_L_row_index_arrays_,
+                                                                        multifrontal_L_row_buffers_,
+                                                                        multifrontal_L_col_buffers_,
+                                                                        multifrontal_L_element_buffers_,
+                                                                        multifrontal_L_row_elimination_num_list_,
+                                                                        multifrontal_U_row_index_arrays_,
+                                                                        multifrontal_U_row_buffers_,
+                                                                        multifrontal_U_col_buffers_,
+                                                                        multifrontal_U_element_buffers_,
+                                                                        multifrontal_U_row_elimination_num_list_);
+            if (!host_level_scheduling_)
+              return;
+          }
           
           //
           // Bring to device if necessary:
@@ -455,6 +500,7 @@ namespace viennacl
         }
         
         ilut_tag const & tag_;
+        bool host_level_scheduling_;
         viennacl::compressed_matrix<ScalarType> LU;
 
         std::list< viennacl::backend::mem_handle > multifrontal_L_row_index_arrays_;
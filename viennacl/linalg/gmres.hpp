@@ -30,6 +30,9 @@
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/inner_prod.hpp"
+#include "viennacl/linalg/vector_operations.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/vector_proxy.hpp"
 #include "viennacl/traits/clear.hpp"
 #include "viennacl/traits/size.hpp"
 #include "viennacl/meta/result_of.hpp"
@@ -150,8 +153,6 @@ namespace viennacl
         x -= (beta * hT_in_x) * h;
       }
 
-    }
-
     /** @brief Implementation of the GMRES solver.
     *
     * Following the algorithm proposed by Walker in "A Simpler GMRES"
@@ -163,7 +164,7 @@ namespace viennacl
     * @return The result vector
     */
     template <typename MatrixType, typename VectorType, typename PreconditionerType>
-    VectorType solve(const MatrixType & matrix, VectorType const & rhs, gmres_tag const & tag, PreconditionerType const & precond)
+    VectorType solve_impl(const MatrixType & matrix, VectorType const & rhs, gmres_tag const & tag, PreconditionerType const & precond)
     {
       typedef typename viennacl::result_of::value_type<VectorType>::type        ScalarType;
       typedef typename viennacl::result_of::cpu_value_type<ScalarType>::type    CPU_ScalarType;
@@ -335,6 +336,212 @@ namespace viennacl
       return result;
     }
 
+      /** @brief Implementation of restarted GMRES for viennacl::vector, where the Arnoldi basis is orthogonalized by classical Gram-Schmidt with one reorthogonalization pass.
+      *
+      * All inner products of the new basis vector with the previous basis vectors are computed in a single pass by inner_prod(w, tuple),
+      * and the projections are subtracted in a single pass by multi_axpy(). The small Hessenberg system is reduced by Givens rotations on the host.
+      *
+      * @param matrix     The system matrix
+      * @param rhs        The load vector
+      * @param tag        Solver configuration tag
+      * @param precond    A preconditioner. Precondition operation is done via member function apply()
+      * @return The result vector
+      */
+      template <typename MatrixType, typename ScalarType, unsigned int ALIGNMENT, typename PreconditionerType>
+      viennacl::vector<ScalarType, ALIGNMENT> pipelined_solve(MatrixType const & matrix,
+                                                              viennacl::vector<ScalarType, ALIGNMENT> const & rhs,
+                                                              gmres_tag const & tag,
+                                                              PreconditionerType const & precond)
+      {
+        typedef viennacl::vector<ScalarType, ALIGNMENT>    VectorType;
+
+        unsigned int problem_size = viennacl::traits::size(rhs);
+        VectorType result(problem_size);
+        viennacl::traits::clear(result);
+
+        unsigned int krylov_dim = tag.krylov_dim();
+        if (problem_size < tag.krylov_dim())
+          krylov_dim = problem_size; //A Krylov space larger than the matrix would lead to seg-faults (mathematically, error is certain to be zero already)
+
+        VectorType res(problem_size);
+        VectorType w(problem_size);
+        std::vector<VectorType> krylov_basis(krylov_dim + 1, VectorType(problem_size));
+
+        viennacl::vector<ScalarType> projection_coeffs(krylov_dim + 1);   //projection coefficients of the current Gram-Schmidt pass
+
+        std::vector< std::vector<ScalarType> > H(krylov_dim, std::vector<ScalarType>(krylov_dim + 1));  //H[k] holds the k-th column of the Hessenberg matrix
+        std::vector<ScalarType> projection_rhs(krylov_dim + 1);
+        std::vector<ScalarType> givens_c(krylov_dim);
+        std::vector<ScalarType> givens_s(krylov_dim);
+        std::vector<ScalarType> host_coeffs(krylov_dim + 1);
+
+        ScalarType norm_rhs = viennacl::linalg::norm_2(rhs);
+
+        if (norm_rhs == 0) //solution is zero if RHS norm is zero
+          return result;
+
+        tag.iters(0);
+
+        for (unsigned int it = 0; it <= tag.max_restarts(); ++it)
+        {
+          //
+          // (Re-)Initialize residual: r = b - A*x
+          //
+          res = rhs;
+          res -= viennacl::linalg::prod(matrix, result);
+          precond.apply(res);
+
+          ScalarType rho_0 = viennacl::linalg::norm_2(res);
+          ScalarType rho = rho_0;
+
+          if (rho_0 / norm_rhs < tag.tolerance())
+          {
+            tag.error(rho_0 / norm_rhs);
+            return result;
+          }
+
+          krylov_basis[0] = res;
+          krylov_basis[0] /= rho_0;
+          std::fill(projection_rhs.begin(), projection_rhs.end(), ScalarType(0));
+          projection_rhs[0] = rho_0;
+
+          std::vector<viennacl::vector_base<ScalarType> const *> basis_ptrs(1, &(krylov_basis[0]));
+
+          unsigned int k = 0;
+          for (k = 0; k < krylov_dim; ++k)
+          {
+            tag.iters( tag.iters() + 1 ); //increase iteration counter
+
+            w = viennacl::linalg::prod(matrix, krylov_basis[k]);
+            precond.apply(w);
+
+            //
+            // Classical Gram-Schmidt with reorthogonalization: two passes of h = V^T w; w -= V h;
+            //
+            viennacl::vector_tuple<ScalarType> basis_tuple(basis_ptrs);
+            viennacl::vector_range<viennacl::vector<ScalarType> > coeffs(projection_coeffs, viennacl::range(0, k+1));
+            std::fill(H[k].begin(), H[k].end(), ScalarType(0));
+            for (unsigned int pass = 0; pass < 2; ++pass)
+            {
+              coeffs = viennacl::linalg::inner_prod(w, basis_tuple);
+              viennacl::linalg::multi_axpy(w, ScalarType(-1), coeffs, basis_tuple);
+
+              viennacl::copy(coeffs, host_coeffs);
+              for (unsigned int i = 0; i <= k; ++i)
+                H[k][i] += host_coeffs[i];
+            }
+            H[k][k+1] = viennacl::linalg::norm_2(w);
+
+            if (H[k][k+1] > 0)
+            {
+              krylov_basis[k+1] = w;
+              krylov_basis[k+1] /= H[k][k+1];
+            }
+            basis_ptrs.push_back(&(krylov_basis[k+1]));
+
+            //
+            // Apply previous Givens rotations to the new column, then eliminate H[k][k+1]:
+            //
+            for (unsigned int i = 0; i < k; ++i)
+            {
+              ScalarType h_i  = H[k][i];
+              ScalarType h_i1 = H[k][i+1];
+              H[k][i]   =  givens_c[i] * h_i + givens_s[i] * h_i1;
+              H[k][i+1] = -givens_s[i] * h_i + givens_c[i] * h_i1;
+            }
+
+            ScalarType denominator = std::sqrt(H[k][k] * H[k][k] + H[k][k+1] * H[k][k+1]);
+            givens_c[k] = (denominator > 0) ? H[k][k]   / denominator : ScalarType(1);
+            givens_s[k] = (denominator > 0) ? H[k][k+1] / denominator : ScalarType(0);
+            H[k][k]   = denominator;
+            H[k][k+1] = 0;
+
+            projection_rhs[k+1] = -givens_s[k] * projection_rhs[k];
+            projection_rhs[k]   =  givens_c[k] * projection_rhs[k];
+            rho = std::fabs(projection_rhs[k+1]);
+
+            if (rho / norm_rhs < tag.tolerance())  // Residual is sufficiently reduced, stop here
+            {
+              ++k;
+              break;
+            }
+          } // for k
+
+          //
+          // Triangular solver stage:
+          //
+          for (int i = static_cast<int>(k) - 1; i > -1; --i)
+          {
+            for (unsigned int j = i+1; j < k; ++j)
+              projection_rhs[i] -= H[j][i] * projection_rhs[j];
+
+            projection_rhs[i] /= H[i][i];
+          }
+
+          //
+          // Update result: x += V y in a single pass
+          //
+          if (k > 0)
+          {
+            basis_ptrs.resize(k);
+            viennacl::vector_range<viennacl::vector<ScalarType> > coeffs(projection_coeffs, viennacl::range(0, k));
+            std::vector<ScalarType> y(projection_rhs.begin(), projection_rhs.begin() + k);
+            viennacl::copy(y, coeffs);
+            viennacl::linalg::multi_axpy(result, ScalarType(1), coeffs, viennacl::vector_tuple<ScalarType>(basis_ptrs));
+          }
+
+          //
+          // Check for convergence:
+          //
+          tag.error(rho / norm_rhs);
+          if ( tag.error() < tag.tolerance() )
+            return result;
+        }
+
+        return result;
+      }
+
+    }
+
+    /** @brief Implementation of the GMRES solver.
+    *
+    * For viennacl::vector in main memory or OpenCL memory, the Arnoldi basis is orthogonalized by classical Gram-Schmidt with reorthogonalization,
+    * using the batched operations inner_prod(x, tuple) and multi_axpy(). This requires only a few passes over the basis vectors per iteration.
+    * Otherwise, Householder reflections following "A Simpler GMRES" by Walker are used.
+    *
+    * @param matrix     The system matrix
+    * @param rhs        The load vector
+    * @param tag        Solver configuration tag
+    * @param precond    A preconditioner. Precondition operation is done via member function apply()
+    * @return The result vector
+    */
+    template <typename MatrixType, typename VectorType, typename PreconditionerType>
+    VectorType solve(const MatrixType & matrix, VectorType const & rhs, gmres_tag const & tag, PreconditionerType const & precond)
+    {
+      return detail::solve_impl(matrix, rhs, tag, precond);
+    }
+
+    /** @brief Implementation of the GMRES solver for viennacl::vector. Uses the Gram-Schmidt based variant if the load vector resides in main memory or OpenCL memory.
+    *
+    * @param matrix     The system matrix
+    * @param rhs        The load vector
+    * @param tag        Solver configuration tag
+    * @param precond    A preconditioner. Precondition operation is done via member function apply()
+    * @return The result vector
+    */
+    template <typename MatrixType, typename ScalarType, unsigned int ALIGNMENT, typename PreconditionerType>
+    viennacl::vector<ScalarType, ALIGNMENT> solve(const MatrixType & matrix, viennacl::vector<ScalarType, ALIGNMENT> const & rhs, gmres_tag const & tag, PreconditionerType const & precond)
+    {
+      switch (rhs.handle().get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+        case viennacl::OPENCL_MEMORY:
+          return detail::pipelined_solve(matrix, rhs, tag, precond);
+        default:
+          return detail::solve_impl(matrix, rhs, tag, precond);
+      }
+    }
+
     /** @brief Convenience overload of the solve() function using GMRES. Per default, no preconditioner is used
     */ 
     template <typename MatrixType, typename VectorType>
@@ -0,0 +1,448 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_BATCHED_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_BATCHED_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/batched_operations.hpp
+    @brief Implementations of operations on batches of small dense matrices (viennacl::batched_matrix) in host memory.
+
+    Each matrix of the batch is processed by a simple unblocked kernel. The matrices of a batch are distributed among the OpenMP threads.
+    For the common sizes 2, 3, 4, 6, 8, and 16, the kernels are instantiated with the size as a compile-time constant, so that the compiler can unroll and vectorize the loops.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "viennacl/forwards.h"
+#include "viennacl/linalg/host_based/common.hpp"
+
+/** @brief Batches with fewer than this number of floating point operations (estimated) are processed by a single thread */
+#ifndef VIENNACL_BATCHED_OPENMP_MIN_WORK
+  #define VIENNACL_BATCHED_OPENMP_MIN_WORK 10000
+#endif
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief A matrix dimension known at run time */
+        struct batched_dynamic_size
+        {
+          explicit batched_dynamic_size(std::size_t n) : value(n) {}
+          operator std::size_t() const { return value; }
+
+          std::size_t value;
+        };
+
+        /** @brief A matrix dimension known at compile time */
+        template <std::size_t N>
+        struct batched_static_size
+        {
+          operator std::size_t() const { return N; }
+        };
+
+        /** @brief Calls op(size) with a batched_static_size for the sizes 2, 3, 4, 6, 8, and 16, and with a batched_dynamic_size otherwise */
+        template <typename OperationT>
+        void batched_dispatch_size(std::size_t n, OperationT const & op)
+        {
+          switch (n)
+          {
+            case 2:  op(batched_static_size<2>());  break;
+            case 3:  op(batched_static_size<3>());  break;
+            case 4:  op(batched_static_size<4>());  break;
+            case 6:  op(batched_static_size<6>());  break;
+            case 8:  op(batched_static_size<8>());  break;
+            case 16: op(batched_static_size<16>()); break;
+            default: op(batched_dynamic_size(n));
+          }
+        }
+
+
+        //
+        // Kernels for a single small matrix
+        //
+
+        /** @brief C = A * B for row-major matrices A (M x K), B (K x N), and C (M x N). C must not alias A or B. */
+        template <typename NumericT, typename SizeM, typename SizeN, typename SizeK>
+        void small_gemm(NumericT const * A, NumericT const * B, NumericT * C, SizeM M_, SizeN N_, SizeK K_, viennacl::row_major)
+        {
+          const std::size_t M = M_;
+          const std::size_t N = N_;
+          const std::size_t K = K_;
+
+          for (std::size_t i = 0; i < M; ++i)
+          {
+            NumericT * C_row = C + i * N;
+            for (std::size_t j = 0; j < N; ++j)
+              C_row[j] = 0;
+
+            for (std::size_t k = 0; k < K; ++k)
+            {
+              NumericT a_ik = A[i * K + k];
+              NumericT const * B_row = B + k * N;
+              for (std::size_t j = 0; j < N; ++j)
+                C_row[j] += a_ik * B_row[j];
+            }
+          }
+        }
+
+        /** @brief C = A * B for column-major matrices. The buffer of a column-major matrix holds its transpose in row-major layout, hence C^T = B^T A^T is computed. */
+        template <typename NumericT, typename SizeM, typename SizeN, typename SizeK>
+        void small_gemm(NumericT const * A, NumericT const * B, NumericT * C, SizeM M, SizeN N, SizeK K, viennacl::column_major)
+        {
+          small_gemm(B, A, C, N, M, K, viennacl::row_major());
+        }
+
+        /** @brief LU factorization with partial pivoting P A = L U of a small n x n matrix. Row i of P A is row permutation[i] of A.
+        *
+        * As for the host-based LU factorization of large matrices, a zero pivot leaves the column untouched, so that the substitution reports inf/nan.
+        */
+        template <typename NumericT, typename F, typename SizeT>
+        void small_lu_factorize(NumericT * A, std::size_t * permutation, SizeT n_)
+        {
+          const std::size_t n = n_;
+
+          for (std::size_t i = 0; i < n; ++i)
+            permutation[i] = i;
+
+          for (std::size_t k = 0; k < n; ++k)
+          {
+            std::size_t pivot_row = k;
+            NumericT pivot_value = std::fabs(A[F::mem_index(k, k, n, n)]);
+            for (std::size_t i = k + 1; i < n; ++i)
+            {
+              if (std::fabs(A[F::mem_index(i, k, n, n)]) > pivot_value)
+              {
+                pivot_value = std::fabs(A[F::mem_index(i, k, n, n)]);
+                pivot_row = i;
+              }
+            }
+
+            if (pivot_row != k)
+            {
+              for (std::size_t j = 0; j < n; ++j)
+                std::swap(A[F::mem_index(k, j, n, n)], A[F::mem_index(pivot_row, j, n, n)]);
+              std::swap(permutation[k], permutation[pivot_row]);
+            }
+
+            NumericT a_kk = A[F::mem_index(k, k, n, n)];
+            if (a_kk == NumericT(0))
+              continue;
+
+            for (std::size_t i = k + 1; i < n; ++i)
+            {
+              NumericT l_ik = A[F::mem_index(i, k, n, n)] / a_kk;
+              A[F::mem_index(i, k, n, n)] = l_ik;
+              for (std::size_t j = k + 1; j < n; ++j)
+                A[F::mem_index(i, j, n, n)] -= l_ik * A[F::mem_index(k, j, n, n)];
+            }
+          }
+        }
+
+        /** @brief Solves the triangular system A X = B in place for a small n x n matrix A and n x num_rhs load vectors B, both in layout F.
+        *
+        * @param lower   Whether the lower (or else the upper) triangle of A is used
+        * @param unit    Whether A has an implicit unit diagonal
+        */
+        template <typename NumericT, typename F, typename SizeT>
+        void small_trsm(NumericT const * A, NumericT * B, SizeT n_, std::size_t num_rhs, bool lower, bool unit)
+        {
+          const std::size_t n = n_;
+
+          for (std::size_t l = 0; l < n; ++l)
+          {
+            std::size_t i = lower ? l : n - l - 1;
+
+            // B(i,:) -= A(i, k) B(k,:) for all rows k solved before:
+            for (std::size_t m = 0; m < l; ++m)
+            {
+              std::size_t k = lower ? m : n - m - 1;
+              NumericT a_ik = A[F::mem_index(i, k, n, n)];
+              for (std::size_t j = 0; j < num_rhs; ++j)
+                B[F::mem_index(i, j, n, num_rhs)] -= a_ik * B[F::mem_index(k, j, n, num_rhs)];
+            }
+
+            if (!unit)
+            {
+              NumericT a_ii = A[F::mem_index(i, i, n, n)];
+              for (std::size_t j = 0; j < num_rhs; ++j)
+                B[F::mem_index(i, j, n, num_rhs)] /= a_ii;
+            }
+          }
+        }
+
+        /** @brief Solves L U X = P B in place for the factors computed by small_lu_factorize(). 'buffer' provides space for n * num_rhs entries. */
+        template <typename NumericT, typename F, typename SizeT>
+        void small_lu_substitute(NumericT const * LU, std::size_t const * permutation, NumericT * B, SizeT n, std::size_t num_rhs, NumericT * buffer)
+        {
+          for (std::size_t i = 0; i < std::size_t(n); ++i)
+            for (std::size_t j = 0; j < num_rhs; ++j)
+              buffer[F::mem_index(i, j, n, num_rhs)] = B[F::mem_index(permutation[i], j, n, num_rhs)];
+          for (std::size_t i = 0; i < std::size_t(n) * num_rhs; ++i)
+            B[i] = buffer[i];
+
+          small_trsm<NumericT, F>(LU, B, n, num_rhs, true,  true);
+          small_trsm<NumericT, F>(LU, B, n, num_rhs, false, false);
+        }
+
+
+        //
+        // Operations on the whole batch. The size of the matrices is passed to operator() by batched_dispatch_size().
+        //
+
+        /** @brief C_b = A_b * B_b for all matrices of the batch */
+        template <typename NumericT, typename F>
+        struct batched_prod_operation
+        {
+          batched_prod_operation(NumericT const * A, std::size_t stride_A,
+                                 NumericT const * B, std::size_t stride_B,
+                                 NumericT * C, std::size_t stride_C, std::size_t batch_size)
+            : A_(A), B_(B), C_(C), stride_A_(stride_A), stride_B_(stride_B), stride_C_(stride_C), batch_size_(batch_size) {}
+
+          template <typename SizeT>
+          void operator()(SizeT n) const { (*this)(n, n, n); }
+
+          template <typename SizeM, typename SizeN, typename SizeK>
+          void operator()(SizeM M, SizeN N, SizeK K) const
+          {
+            long batch_size = static_cast<long>(batch_size_);
+            std::size_t work = batch_size_ * std::size_t(M) * std::size_t(N) * std::size_t(K);
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for if (work > VIENNACL_BATCHED_OPENMP_MIN_WORK)
+#endif
+            for (long b = 0; b < batch_size; ++b)
+              small_gemm(A_ + b * stride_A_, B_ + b * stride_B_, C_ + b * stride_C_, M, N, K, F());
+
+            (void)work;
+          }
+
+          NumericT const * A_;
+          NumericT const * B_;
+          NumericT * C_;
+          std::size_t stride_A_, stride_B_, stride_C_, batch_size_;
+        };
+
+        /** @brief In-place LU factorization with partial pivoting of all matrices of the batch */
+        template <typename NumericT, typename F>
+        struct batched_lu_factorize_operation
+        {
+          batched_lu_factorize_operation(NumericT * A, std::size_t stride_A, std::size_t * permutations, std::size_t batch_size)
+            : A_(A), permutations_(permutations), stride_A_(stride_A), batch_size_(batch_size) {}
+
+          template <typename SizeT>
+          void operator()(SizeT n) const
+          {
+            long batch_size = static_cast<long>(batch_size_);
+            std::size_t work = batch_size_ * std::size_t(n) * std::size_t(n) * std::size_t(n);
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for if (work > VIENNACL_BATCHED_OPENMP_MIN_WORK)
+#endif
+            for (long b = 0; b < batch_size; ++b)
+              small_lu_factorize<NumericT, F>(A_ + b * stride_A_, permutations_ + b * std::size_t(n), n);
+
+            (void)work;
+          }
+
+          NumericT * A_;
+          std::size_t * permutations_;
+          std::size_t stride_A_, batch_size_;
+        };
+
+        /** @brief Triangular solves (permuted for LU substitution if permutations is not NULL) with all matrices of the batch */
+        template <typename NumericT, typename F>
+        struct batched_solve_operation
+        {
+          batched_solve_operation(NumericT const * A, std::size_t stride_A, std::size_t const * permutations,
+                                  NumericT * B, std::size_t stride_B, std::size_t num_rhs, std::size_t batch_size,
+                                  bool lower, bool unit)
+            : A_(A), permutations_(permutations), B_(B), stride_A_(stride_A), stride_B_(stride_B), num_rhs_(num_rhs), batch_size_(batch_size),
+              lower_(lower), unit_(unit) {}
+
+          template <typename SizeT>
+          void operator()(SizeT n) const
+          {
+            long batch_size = static_cast<long>(batch_size_);
+            std::size_t work = batch_size_ * std::size_t(n) * std::size_t(n) * num_rhs_;
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel if (work > VIENNACL_BATCHED_OPENMP_MIN_WORK)
+#endif
+            {
+              std::vector<NumericT> buffer(permutations_ ? std::size_t(n) * num_rhs_ : 0);
+
+#ifdef VIENNACL_WITH_OPENMP
+              #pragma omp for
+#endif
+              for (long b = 0; b < batch_size; ++b)
+              {
+                if (permutations_)
+                  small_lu_substitute<NumericT, F>(A_ + b * stride_A_, permutations_ + b * std::size_t(n), B_ + b * stride_B_, n, num_rhs_, &(buffer[0]));
+                else
+                  small_trsm<NumericT, F>(A_ + b * stride_A_, B_ + b * stride_B_, n, num_rhs_, lower_, unit_);
+              }
+            }
+
+            (void)work;
+          }
+
+          NumericT const * A_;
+          std::size_t const * permutations_;
+          NumericT * B_;
+          std::size_t stride_A_, stride_B_, num_rhs_, batch_size_;
+          bool lower_, unit_;
+        };
+
+        /** @brief A_inv_b = A_b^{-1} for all matrices of the batch, computed from an LU factorization with partial pivoting in a private buffer */
+        template <typename NumericT, typename F>
+        struct batched_inverse_operation
+        {
+          batched_inverse_operation(NumericT const * A, std::size_t stride_A, NumericT * A_inv, std::size_t stride_A_inv, std::size_t batch_size)
+            : A_(A), A_inv_(A_inv), stride_A_(stride_A), stride_A_inv_(stride_A_inv), batch_size_(batch_size) {}
+
+          template <typename SizeT>
+          void operator()(SizeT n_) const
+          {
+            const std::size_t n = n_;
+            long batch_size = static_cast<long>(batch_size_);
+            std::size_t work = batch_size_ * n * n * n;
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel if (work > VIENNACL_BATCHED_OPENMP_MIN_WORK)
+#endif
+            {
+              std::vector<NumericT> LU(n * n);
+              std::vector<std::size_t> permutation(n);
+
+#ifdef VIENNACL_WITH_OPENMP
+              #pragma omp for
+#endif
+              for (long b = 0; b < batch_size; ++b)
+              {
+                NumericT const * A = A_ + b * stride_A_;
+                NumericT * A_inv = A_inv_ + b * stride_A_inv_;
+
+                for (std::size_t i = 0; i < n * n; ++i)
+                  LU[i] = A[i];
+                small_lu_factorize<NumericT, F>(&(LU[0]), &(permutation[0]), n_);
+
+                // A^{-1} = U^{-1} L^{-1} P:
+                for (std::size_t i = 0; i < n; ++i)
+                  for (std::size_t j = 0; j < n; ++j)
+                    A_inv[F::mem_index(i, j, n, n)] = (permutation[i] == j) ? NumericT(1) : NumericT(0);
+                small_trsm<NumericT, F>(&(LU[0]), A_inv, n_, n, true,  true);
+                small_trsm<NumericT, F>(&(LU[0]), A_inv, n_, n, false, false);
+              }
+            }
+
+            (void)work;
+          }
+
+          NumericT const * A_;
+          NumericT * A_inv_;
+          std::size_t stride_A_, stride_A_inv_, batch_size_;
+        };
+
+      } //namespace detail
+
+
+      /** @brief Computes C_b = A_b * B_b for all matrices of the batch. Dispatches to a compile-time size if all matrices are square of a common size.
+      *
+      * @param A   The first factors
+      * @param B   The second factors
+      * @param C   The results. Must not share memory with A or B.
+      */
+      template <typename NumericT, typename F>
+      void prod_impl(viennacl::batched_matrix<NumericT, F> const & A,
+                     viennacl::batched_matrix<NumericT, F> const & B,
+                     viennacl::batched_matrix<NumericT, F> & C)
+      {
+        detail::batched_prod_operation<NumericT, F> op(detail::extract_raw_pointer<NumericT>(A), A.stride(),
+                                                       detail::extract_raw_pointer<NumericT>(B), B.stride(),
+                                                       detail::extract_raw_pointer<NumericT>(C), C.stride(), C.batch_size());
+
+        if (A.size1() == A.size2() && B.size1() == B.size2())
+          detail::batched_dispatch_size(A.size1(), op);
+        else
+          op(detail::batched_dynamic_size(C.size1()), detail::batched_dynamic_size(C.size2()), detail::batched_dynamic_size(A.size2()));
+      }
+
+      /** @brief LU factorization with partial pivoting of all matrices of the batch.
+      *
+      * @param A             The matrices, where the LU factors are written to
+      * @param permutations  The row permutations: Entries [b * n, (b+1) * n) hold the permutation of matrix b (as for viennacl::linalg::lu_factorize())
+      */
+      template <typename NumericT, typename F>
+      void lu_factorize(viennacl::batched_matrix<NumericT, F> & A, std::vector<std::size_t> & permutations)
+      {
+        permutations.resize(A.batch_size() * A.size1());
+        if (permutations.empty())
+          return;
+
+        detail::batched_dispatch_size(A.size1(),
+                                      detail::batched_lu_factorize_operation<NumericT, F>(detail::extract_raw_pointer<NumericT>(A), A.stride(),
+                                                                                          &(permutations[0]), A.batch_size()));
+      }
+
+      /** @brief Solves the triangular systems A_b X_b = B_b in place, or the systems P_b^{-1} L_b U_b X_b = B_b if permutations is not NULL.
+      *
+      * @param A             The system matrices (or LU factors)
+      * @param permutations  The row permutations from lu_factorize(), or NULL for triangular solves
+      * @param B             The load vectors, where the solutions are written to
+      * @param lower         Whether the lower (or else the upper) triangle of A is used. Ignored for LU substitution.
+      * @param unit          Whether A has an implicit unit diagonal. Ignored for LU substitution.
+      */
+      template <typename NumericT, typename F>
+      void batched_solve(viennacl::batched_matrix<NumericT, F> const & A, std::vector<std::size_t> const * permutations,
+                         viennacl::batched_matrix<NumericT, F> & B, bool lower, bool unit)
+      {
+        if (B.size2() == 0)
+          return;
+
+        detail::batched_dispatch_size(A.size1(),
+                                      detail::batched_solve_operation<NumericT, F>(detail::extract_raw_pointer<NumericT>(A), A.stride(),
+                                                                                   (permutations && !permutations->empty()) ? &((*permutations)[0]) : NULL,
+                                                                                   detail::extract_raw_pointer<NumericT>(B), B.stride(), B.size2(), B.batch_size(),
+                                                                                   lower, unit));
+      }
+
+      /** @brief Computes the inverses of all matrices of the batch.
+      *
+      * @param A       The matrices (unchanged)
+      * @param A_inv   The inverses. Must not share memory with A.
+      */
+      template <typename NumericT, typename F>
+      void inverse(viennacl::batched_matrix<NumericT, F> const & A, viennacl::batched_matrix<NumericT, F> & A_inv)
+      {
+        detail::batched_dispatch_size(A.size1(),
+                                      detail::batched_inverse_operation<NumericT, F>(detail::extract_raw_pointer<NumericT>(A), A.stride(),
+                                                                                     detail::extract_raw_pointer<NumericT>(A_inv), A_inv.stride(), A.batch_size()));
+      }
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_CHOLESKY_HPP
+#define VIENNACL_LINALG_HOST_BASED_CHOLESKY_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/cholesky.hpp
+    @brief Implementation of a blocked Cholesky factorization for dense symmetric positive definite matrices in host memory.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "viennacl/forwards.h"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
+#include "viennacl/linalg/host_based/direct_solve.hpp"
+
+/** @brief Width of the block columns in the blocked Cholesky factorization */
+#ifndef VIENNACL_CHOLESKY_BLOCK_SIZE
+  #define VIENNACL_CHOLESKY_BLOCK_SIZE 128
+#endif
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief Unblocked Cholesky factorization A = L L^T of a small matrix. Only the lower triangle of A is referenced and overwritten with L. */
+        template <typename NumericT>
+        void cholesky_factorize_unblocked(strided_matrix_view<NumericT> const & A)
+        {
+          std::size_t n = A.size1;
+
+          for (std::size_t j = 0; j < n; ++j)
+          {
+            NumericT a_jj = A(j, j);
+            for (std::size_t k = 0; k < j; ++k)
+              a_jj -= A(j, k) * A(j, k);
+
+            if (!(a_jj > NumericT(0)))  // also rejects NaN
+              throw "ViennaCL: Matrix is not positive definite in Cholesky factorization!";
+
+            a_jj = std::sqrt(a_jj);
+            A(j, j) = a_jj;
+
+            for (std::size_t i = j + 1; i < n; ++i)
+            {
+              NumericT a_ij = A(i, j);
+              for (std::size_t k = 0; k < j; ++k)
+                a_ij -= A(i, k) * A(j, k);
+              A(i, j) = a_ij / a_jj;
+            }
+          }
+        }
+
+        /** @brief Symmetric rank-k update C -= L L^T of the lower triangle of C.
+        *
+        * C is split into block columns. Each diagonal block and the block below it are updated by the packed matrix-matrix product.
+        * Block columns are distributed among the threads. The strict upper triangle of C is not referenced.
+        */
+        template <typename NumericT>
+        void syrk_lower_update(strided_matrix_view<NumericT const> const & L, strided_matrix_view<NumericT> const & C)
+        {
+          std::size_t n = C.size1;
+          std::size_t k = L.size2;
+          const std::size_t block_size = VIENNACL_CHOLESKY_BLOCK_SIZE;
+
+          if (n == 0 || k == 0)
+            return;
+
+          long num_blocks = static_cast<long>((n - 1) / block_size + 1);
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for schedule(dynamic) if (num_blocks > 1)
+#endif
+          for (long block = 0; block < num_blocks; ++block)
+          {
+            std::size_t jb = static_cast<std::size_t>(block) * block_size;
+            std::size_t w  = std::min(block_size, n - jb);
+
+            // diagonal block (computed in full, only the lower triangle is written):
+            std::vector<NumericT> diag_block(w * w);
+            strided_matrix_view<NumericT> D(&(diag_block[0]), w, w, w, 1);
+            gemm(L.sub(jb, 0, w, k), L.sub(jb, 0, w, k).trans(), D, NumericT(1), NumericT(0));
+            for (std::size_t i = 0; i < w; ++i)
+              for (std::size_t j = 0; j <= i; ++j)
+                C(jb + i, jb + j) -= D(i, j);
+
+            // block below the diagonal:
+            if (jb + w < n)
+              gemm(L.sub(jb + w, 0, n - jb - w, k), L.sub(jb, 0, w, k).trans(), C.sub(jb + w, jb, n - jb - w, w), NumericT(-1), NumericT(1));
+          }
+        }
+
+        /** @brief Blocked right-looking Cholesky factorization A = L L^T in host memory.
+        *
+        * For each block column: The diagonal block is factored, the block below is obtained from a triangular solve, and the trailing matrix receives a symmetric rank-k update.
+        * Only the lower triangle of A is referenced and overwritten with L.
+        */
+        template <typename NumericT>
+        void cholesky_factorize(strided_matrix_view<NumericT> const & A)
+        {
+          std::size_t n = A.size1;
+          const std::size_t block_size = VIENNACL_CHOLESKY_BLOCK_SIZE;
+
+          for (std::size_t kb = 0; kb < n; kb += block_size)
+          {
+            std::size_t w = std::min(block_size, n - kb);
+            std::size_t remainder = n - kb - w;
+
+            cholesky_factorize_unblocked(A.sub(kb, kb, w, w));
+
+            if (remainder > 0)
+            {
+              // L_21 = A_21 L_11^{-T}, i.e. L_11 L_21^T = A_21^T:
+              trsm_left(const_view(A.sub(kb, kb, w, w)), A.sub(kb + w, kb, remainder, w).trans(), true, false);
+
+              // A_22 -= L_21 L_21^T:
+              syrk_lower_update(const_view(A.sub(kb + w, kb, remainder, w)), A.sub(kb + w, kb + w, remainder, remainder));
+            }
+          }
+        }
+
+      } //namespace detail
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -26,6 +26,12 @@
 #include "viennacl/matrix.hpp"
 
 #include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
+
+/** @brief Size of the diagonal blocks in the blocked triangular solvers. The off-diagonal blocks are updated by matrix-matrix products. */
+#ifndef VIENNACL_TRSM_BLOCK_SIZE
+  #define VIENNACL_TRSM_BLOCK_SIZE 64
+#endif
 
 namespace viennacl
 {
@@ -36,86 +42,138 @@ namespace viennacl
       
       namespace detail
       {
+        /** @brief Maps the solver tags to the triangular structure of the system matrix */
+        template <typename SolverTagT>
+        struct solver_tag_traits;
+
+        template <> struct solver_tag_traits<viennacl::linalg::upper_tag>      { static const bool is_lower = false; static const bool is_unit_diagonal = false; };
+        template <> struct solver_tag_traits<viennacl::linalg::unit_upper_tag> { static const bool is_lower = false; static const bool is_unit_diagonal = true;  };
+        template <> struct solver_tag_traits<viennacl::linalg::lower_tag>      { static const bool is_lower = true;  static const bool is_unit_diagonal = false; };
+        template <> struct solver_tag_traits<viennacl::linalg::unit_lower_tag> { static const bool is_lower = true;  static const bool is_unit_diagonal = true;  };
+
         //
-        // Upper solve:
+        // Blocked solve on strided views:
         //
-        template <typename MatrixType1, typename MatrixType2>
-        void upper_inplace_solve_matrix(MatrixType1 & A, MatrixType2 & B, std::size_t A_size, std::size_t B_size, bool unit_diagonal)
+
+        /** @brief Solves A X = B for a small triangular matrix A by substitution. X overwrites B.
+        *
+        * If the columns of B are contiguous in memory, each column is solved separately. Otherwise, rows of B are updated as a whole.
+        */
+        template <typename NumericT>
+        void trsm_left_unblocked(strided_matrix_view<NumericT const> const & A, strided_matrix_view<NumericT> const & B, bool lower, bool unit_diagonal)
         {
-          typedef typename MatrixType2::value_type   value_type;
-          
-          for (std::size_t i = 0; i < A_size; ++i)
+          std::size_t n = A.size1;
+          std::size_t num_rhs = B.size2;
+
+          if (B.row_inc < B.col_inc)
           {
-            std::size_t current_row = A_size - i - 1;
-            
-            for (std::size_t j = current_row + 1; j < A_size; ++j)
+            for (std::size_t k = 0; k < num_rhs; ++k)
             {
-              value_type A_element = A(current_row, j);
-              for (std::size_t k=0; k < B_size; ++k)
-                B(current_row, k) -= A_element * B(j, k);
-            }
-            
-            if (!unit_diagonal)
-            {
-              value_type A_diag = A(current_row, current_row);
-              for (std::size_t k=0; k < B_size; ++k)
-                B(current_row, k) /= A_diag;
+              for (std::size_t ii = 0; ii < n; ++ii)
+              {
+                std::size_t i = lower ? ii : n - ii - 1;
+                std::size_t j_begin = lower ? 0 : i + 1;
+                std::size_t j_end   = lower ? i : n;
+
+                NumericT temp = B(i, k);
+                for (std::size_t j = j_begin; j < j_end; ++j)
+                  temp -= A(i, j) * B(j, k);
+                B(i, k) = unit_diagonal ? temp : temp / A(i, i);
+              }
             }
+            return;
           }
-        }
-          
-        template <typename MatrixType1, typename MatrixType2>
-        void inplace_solve_matrix(MatrixType1 & A, MatrixType2 & B, std::size_t A_size, std::size_t B_size, viennacl::linalg::unit_upper_tag)
-        {
-          upper_inplace_solve_matrix(A, B, A_size, B_size, true);
-        }
-          
-        template <typename MatrixType1, typename MatrixType2>
-        void inplace_solve_matrix(MatrixType1 & A, MatrixType2 & B, std::size_t A_size, std::size_t B_size, viennacl::linalg::upper_tag)
-        {
-          upper_inplace_solve_matrix(A, B, A_size, B_size, false);
-        }
-          
-        //
-        // Lower solve:
-        //
-        template <typename MatrixType1, typename MatrixType2>
-        void lower_inplace_solve_matrix(MatrixType1 & A, MatrixType2 & B, std::size_t A_size, std::size_t B_size, bool unit_diagonal)
-        {
-          typedef typename MatrixType2::value_type   value_type;
-          
-          for (std::size_t i = 0; i < A_size; ++i)
+
+          for (std::size_t ii = 0; ii < n; ++ii)
           {
-            for (std::size_t j = 0; j < i; ++j)
+            std::size_t i = lower ? ii : n - ii - 1;
+            std::size_t j_begin = lower ? 0 : i + 1;
+            std::size_t j_end   = lower ? i : n;
+
+            for (std::size_t j = j_begin; j < j_end; ++j)
             {
-              value_type A_element = A(i, j);
-              for (std::size_t k=0; k < B_size; ++k)
+              NumericT A_element = A(i, j);
+              for (std::size_t k = 0; k < num_rhs; ++k)
                 B(i, k) -= A_element * B(j, k);
             }
-            
+
             if (!unit_diagonal)
             {
-              value_type A_diag = A(i, i);
-              for (std::size_t k=0; k < B_size; ++k)
+              NumericT A_diag = A(i, i);
+              for (std::size_t k = 0; k < num_rhs; ++k)
                 B(i, k) /= A_diag;
             }
           }
         }
-          
-        template <typename MatrixType1, typename MatrixType2>
-        void inplace_solve_matrix(MatrixType1 & A, MatrixType2 & B, std::size_t A_size, std::size_t B_size, viennacl::linalg::unit_lower_tag)
+
+        /** @brief Blocked solve of A X = B on all columns of B. Parallelism (if any) is within the matrix-matrix products. */
+        template <typename NumericT>
+        void trsm_left_blocked(strided_matrix_view<NumericT const> const & A, strided_matrix_view<NumericT> const & B, bool lower, bool unit_diagonal)
         {
-          lower_inplace_solve_matrix(A, B, A_size, B_size, true);
+          std::size_t n = A.size1;
+          std::size_t num_rhs = B.size2;
+          const std::size_t block_size = VIENNACL_TRSM_BLOCK_SIZE;
+
+          if (lower)
+          {
+            for (std::size_t kb = 0; kb < n; kb += block_size)
+            {
+              std::size_t w = std::min(block_size, n - kb);
+              trsm_left_unblocked(A.sub(kb, kb, w, w), B.sub(kb, 0, w, num_rhs), true, unit_diagonal);
+              if (kb + w < n)
+                gemm(A.sub(kb + w, kb, n - kb - w, w), const_view(B.sub(kb, 0, w, num_rhs)), B.sub(kb + w, 0, n - kb - w, num_rhs), NumericT(-1), NumericT(1));
+            }
+          }
+          else
+          {
+            for (std::size_t kb_end = n; kb_end > 0; )
+            {
+              std::size_t w  = std::min(block_size, kb_end);
+              std::size_t kb = kb_end - w;
+              trsm_left_unblocked(A.sub(kb, kb, w, w), B.sub(kb, 0, w, num_rhs), false, unit_diagonal);
+              if (kb > 0)
+                gemm(A.sub(0, kb, kb, w), const_view(B.sub(kb, 0, w, num_rhs)), B.sub(0, 0, kb, num_rhs), NumericT(-1), NumericT(1));
+              kb_end = kb;
+            }
+          }
         }
-          
-        template <typename MatrixType1, typename MatrixType2>
-        void inplace_solve_matrix(MatrixType1 & A, MatrixType2 & B, std::size_t A_size, std::size_t B_size, viennacl::linalg::lower_tag)
+
+        /** @brief Blocked solution of A X = B for a triangular matrix A. X overwrites B.
+        *
+        * Diagonal blocks of size VIENNACL_TRSM_BLOCK_SIZE are solved by substitution, the remaining rows of B are updated by the packed matrix-matrix product.
+        * The columns of B are independent, so with enough right hand sides each thread solves for its own block of columns.
+        * Transposed systems are handled by passing the transposed view of A (and swapping 'lower').
+        */
+        template <typename NumericT>
+        void trsm_left(strided_matrix_view<NumericT const> const & A, strided_matrix_view<NumericT> const & B, bool lower, bool unit_diagonal)
         {
-          lower_inplace_solve_matrix(A, B, A_size, B_size, false);
+          std::size_t n = A.size1;
+          std::size_t num_rhs = B.size2;
+
+          if (n == 0 || num_rhs == 0)
+            return;
+
+#ifdef VIENNACL_WITH_OPENMP
+          const std::size_t min_columns_per_thread = 16;
+          std::size_t num_column_blocks = std::min<std::size_t>(static_cast<std::size_t>(omp_get_max_threads()), num_rhs / min_columns_per_thread);
+          if (num_column_blocks > 1 && !omp_in_parallel() && n * n * num_rhs > 32 * 32 * 32)
+          {
+            std::size_t columns_per_block = (num_rhs - 1) / num_column_blocks + 1;
+
+            #pragma omp parallel for
+            for (long block = 0; block < static_cast<long>(num_column_blocks); ++block)
+            {
+              std::size_t col_begin = static_cast<std::size_t>(block) * columns_per_block;
+              if (col_begin < num_rhs)
+                trsm_left_blocked(A, B.sub(0, col_begin, n, std::min(columns_per_block, num_rhs - col_begin)), lower, unit_diagonal);
+            }
+            return;
+          }
+#endif
+          trsm_left_blocked(A, B, lower, unit_diagonal);
         }
-          
       }
-      
+
       //
       // Note: By convention, all size checks are performed in the calling frontend. No need to double-check here.
       //
@@ -129,32 +187,10 @@ namespace viennacl
       template <typename NumericT, typename F1, typename F2, typename SOLVERTAG>
       void inplace_solve(const matrix_base<NumericT, F1> & A, matrix_base<NumericT, F2> & B, SOLVERTAG)
       {
-        typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(A);
-        value_type       * data_B = detail::extract_raw_pointer<value_type>(B);
-        
-        std::size_t A_start1 = viennacl::traits::start1(A);
-        std::size_t A_start2 = viennacl::traits::start2(A);
-        std::size_t A_inc1   = viennacl::traits::stride1(A);
-        std::size_t A_inc2   = viennacl::traits::stride2(A);
-        std::size_t A_size2  = viennacl::traits::size2(A);
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(A);
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(A);
-        
-        std::size_t B_start1 = viennacl::traits::start1(B);
-        std::size_t B_start2 = viennacl::traits::start2(B);
-        std::size_t B_inc1   = viennacl::traits::stride1(B);
-        std::size_t B_inc2   = viennacl::traits::stride2(B);
-        std::size_t B_size2  = viennacl::traits::size2(B);
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(B);
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(B);
-        
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F2::orientation_category, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        
-        detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SOLVERTAG());
+        detail::trsm_left(detail::make_strided_view(A),
+                          detail::make_strided_view(B),
+                          detail::solver_tag_traits<SOLVERTAG>::is_lower,
+                          detail::solver_tag_traits<SOLVERTAG>::is_unit_diagonal);
       }
       
       /** @brief Direct inplace solver for triangular systems with multiple transposed right hand sides, i.e. A \ B^T   (MATLAB notation)
@@ -167,32 +203,10 @@ namespace viennacl
                          matrix_expression< const matrix_base<NumericT, F2>, const matrix_base<NumericT, F2>, op_trans> proxy_B,
                          SOLVERTAG)
       {
-        typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(A);
-        value_type       * data_B = const_cast<value_type *>(detail::extract_raw_pointer<value_type>(proxy_B.lhs()));
-        
-        std::size_t A_start1 = viennacl::traits::start1(A);
-        std::size_t A_start2 = viennacl::traits::start2(A);
-        std::size_t A_inc1   = viennacl::traits::stride1(A);
-        std::size_t A_inc2   = viennacl::traits::stride2(A);
-        std::size_t A_size2  = viennacl::traits::size2(A);
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(A);
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(A);
-        
-        std::size_t B_start1 = viennacl::traits::start1(proxy_B.lhs());
-        std::size_t B_start2 = viennacl::traits::start2(proxy_B.lhs());
-        std::size_t B_inc1   = viennacl::traits::stride1(proxy_B.lhs());
-        std::size_t B_inc2   = viennacl::traits::stride2(proxy_B.lhs());
-        std::size_t B_size1  = viennacl::traits::size1(proxy_B.lhs());
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(proxy_B.lhs());
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(proxy_B.lhs());
-        
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F2::orientation_category, true>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        
-        detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size1, SOLVERTAG());
+        detail::trsm_left(detail::make_strided_view(A),
+                          detail::make_strided_view(const_cast<matrix_base<NumericT, F2> &>(proxy_B.lhs()), true),
+                          detail::solver_tag_traits<SOLVERTAG>::is_lower,
+                          detail::solver_tag_traits<SOLVERTAG>::is_unit_diagonal);
       }
       
       //upper triangular solver for transposed lower triangular matrices
@@ -206,32 +220,10 @@ namespace viennacl
                          matrix_base<NumericT, F2> & B,
                          SOLVERTAG)
       {
-        typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(proxy_A.lhs());
-        value_type       * data_B = const_cast<value_type *>(detail::extract_raw_pointer<value_type>(B));
-        
-        std::size_t A_start1 = viennacl::traits::start1(proxy_A.lhs());
-        std::size_t A_start2 = viennacl::traits::start2(proxy_A.lhs());
-        std::size_t A_inc1   = viennacl::traits::stride1(proxy_A.lhs());
-        std::size_t A_inc2   = viennacl::traits::stride2(proxy_A.lhs());
-        std::size_t A_size2  = viennacl::traits::size2(proxy_A.lhs());
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(proxy_A.lhs());
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(proxy_A.lhs());
-        
-        std::size_t B_start1 = viennacl::traits::start1(B);
-        std::size_t B_start2 = viennacl::traits::start2(B);
-        std::size_t B_inc1   = viennacl::traits::stride1(B);
-        std::size_t B_inc2   = viennacl::traits::stride2(B);
-        std::size_t B_size2  = viennacl::traits::size2(B);
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(B);
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(B);
-        
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, true>    wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F2::orientation_category, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        
-        detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SOLVERTAG());
+        detail::trsm_left(detail::make_strided_view(proxy_A.lhs(), true),
+                          detail::make_strided_view(B),
+                          detail::solver_tag_traits<SOLVERTAG>::is_lower,
+                          detail::solver_tag_traits<SOLVERTAG>::is_unit_diagonal);
       }
 
       /** @brief Direct inplace solver for transposed triangular systems with multiple transposed right hand sides, i.e. A^T \ B^T   (MATLAB notation)
@@ -244,32 +236,10 @@ namespace viennacl
                                matrix_expression< const matrix_base<NumericT, F2>, const matrix_base<NumericT, F2>, op_trans>   proxy_B,
                          SOLVERTAG)
       {
-        typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(proxy_A.lhs());
-        value_type       * data_B = const_cast<value_type *>(detail::extract_raw_pointer<value_type>(proxy_B.lhs()));
-        
-        std::size_t A_start1 = viennacl::traits::start1(proxy_A.lhs());
-        std::size_t A_start2 = viennacl::traits::start2(proxy_A.lhs());
-        std::size_t A_inc1   = viennacl::traits::stride1(proxy_A.lhs());
-        std::size_t A_inc2   = viennacl::traits::stride2(proxy_A.lhs());
-        std::size_t A_size2  = viennacl::traits::size2(proxy_A.lhs());
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(proxy_A.lhs());
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(proxy_A.lhs());
-        
-        std::size_t B_start1 = viennacl::traits::start1(proxy_B.lhs());
-        std::size_t B_start2 = viennacl::traits::start2(proxy_B.lhs());
-        std::size_t B_inc1   = viennacl::traits::stride1(proxy_B.lhs());
-        std::size_t B_inc2   = viennacl::traits::stride2(proxy_B.lhs());
-        std::size_t B_size1  = viennacl::traits::size1(proxy_B.lhs());
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(proxy_B.lhs());
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(proxy_B.lhs());
-        
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, true>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F2::orientation_category, true>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        
-        detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size1, SOLVERTAG());
+        detail::trsm_left(detail::make_strided_view(proxy_A.lhs(), true),
+                          detail::make_strided_view(const_cast<matrix_base<NumericT, F2> &>(proxy_B.lhs()), true),
+                          detail::solver_tag_traits<SOLVERTAG>::is_lower,
+                          detail::solver_tag_traits<SOLVERTAG>::is_unit_diagonal);
       }
       
       //
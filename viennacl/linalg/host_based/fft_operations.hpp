@@ -0,0 +1,1146 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_FFT_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_FFT_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/fft_operations.hpp
+    @brief Implementations of fast Fourier transforms on the CPU using a single thread or OpenMP.
+
+    Complex numbers are stored interleaved (real part followed by imaginary part), as for the OpenCL implementation.
+    Power-of-two sizes are transformed by an iterative radix-4 algorithm (with one radix-2 stage for odd exponents),
+    small sizes by the direct algorithm, and all other sizes by Bluestein's algorithm.
+*/
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/tools/mutex.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+/** @brief Maximum number of bytes of precomputed tables kept in each process-wide FFT plan cache (one for complex and one for real transforms per precision). Plans whose tables do not fit compute their own tables. */
+#ifndef VIENNACL_FFT_PLAN_CACHE_MAX_BYTES
+  #define VIENNACL_FFT_PLAN_CACHE_MAX_BYTES  (std::size_t(64) * 1024 * 1024)
+#endif
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      /** @brief Fast Fourier transforms on the CPU */
+      namespace fft
+      {
+        namespace detail
+        {
+          /** @brief Sizes up to this value which are not a power of two are transformed with the direct algorithm instead of Bluestein's algorithm */
+          const std::size_t DIRECT_MAX_SIZE = 32;
+
+          /** @brief Number of columns gathered at once when transforming along the columns of a row-major matrix */
+          const std::size_t COLUMN_BLOCK_SIZE = 16;
+
+          /** @brief Transforms of a batch are computed in parallel if the total number of complex entries exceeds this value */
+          const std::size_t OPENMP_MIN_ENTRIES = 4096;
+
+          /** @brief Complex multiplication without the special treatment of infinities and NaNs of std::complex, which prevents vectorization */
+          template <typename T>
+          std::complex<T> mul(std::complex<T> const & a, std::complex<T> const & b)
+          {
+            return std::complex<T>(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+          }
+
+          inline bool is_power_of_two(std::size_t n)
+          {
+            return (n & (n - 1)) == 0;
+          }
+
+          inline std::size_t next_power_of_two(std::size_t n)
+          {
+            std::size_t result = 1;
+            while (result < n)
+              result <<= 1;
+            return result;
+          }
+
+          /** @brief Returns exp(sign * 2 * pi * i * k / n), evaluated in double precision */
+          template <typename T>
+          std::complex<T> unit_root(std::size_t k, std::size_t n, T sign)
+          {
+            double angle = static_cast<double>(sign) * 2.0 * 3.14159265358979323846 * static_cast<double>(k) / static_cast<double>(n);
+            return std::complex<T>(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+          }
+
+          /** @brief Fills 'twiddles' with the first 'count' powers of the n-th unit root exp(sign * 2 * pi * i / n) */
+          template <typename T>
+          void compute_twiddles(std::size_t n, std::size_t count, T sign, std::vector<std::complex<T> > & twiddles)
+          {
+            twiddles.resize(count);
+            for (std::size_t k = 0; k < count; ++k)
+              twiddles[k] = unit_root(k, n, sign);
+          }
+
+          /** @brief Computes the pairs of indices (i, j), i < j, which are swapped when reordering a power-of-two sized array in bit-reversed order */
+          inline void compute_bit_reversal(std::size_t size, std::vector<std::size_t> & swaps)
+          {
+            swaps.clear();
+            for (std::size_t i = 1, j = 0; i < size; ++i)
+            {
+              std::size_t bit = size >> 1;
+              for (; j & bit; bit >>= 1)
+                j ^= bit;
+              j ^= bit;
+
+              if (i < j)
+              {
+                swaps.push_back(i);
+                swaps.push_back(j);
+              }
+            }
+          }
+
+          /** @brief In-place radix-4 FFT of a contiguous power-of-two sized array.
+          *
+          * Two consecutive radix-2 stages are fused into one pass over the data, which halves the number of passes compared to a plain radix-2 algorithm.
+          *
+          * @param data       The data, overwritten with the transform
+          * @param size       Number of complex entries (power of two)
+          * @param twiddles   Powers of exp(sign * 2 * pi * i / size), at least size/2 entries
+          * @param swaps      Bit-reversal permutation as obtained from compute_bit_reversal()
+          * @param sign       Sign of the exponent
+          */
+          template <typename T>
+          void radix4_inplace(std::complex<T> * data, std::size_t size, std::complex<T> const * twiddles, std::vector<std::size_t> const & swaps, T sign)
+          {
+            if (size < 2)
+              return;
+
+            for (std::size_t k = 0; k < swaps.size(); k += 2)
+              std::swap(data[swaps[k]], data[swaps[k + 1]]);
+
+            std::size_t stages = 0;
+            while ((std::size_t(1) << stages) < size)
+              ++stages;
+
+            std::size_t m = 1;  //half length of the butterflies of the current stage
+            if (stages % 2 == 1)
+            {
+              for (std::size_t i = 0; i < size; i += 2)
+              {
+                std::complex<T> x0 = data[i];
+                std::complex<T> x1 = data[i + 1];
+                data[i]     = x0 + x1;
+                data[i + 1] = x0 - x1;
+              }
+              m = 2;
+            }
+
+            for (; m < size; m *= 4)
+            {
+              std::size_t twiddle_step = size / (4 * m);
+              for (std::size_t block = 0; block < size; block += 4 * m)
+              {
+                std::complex<T> * x = data + block;
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                  std::complex<T> w1 = twiddles[2 * j * twiddle_step];   //exp(sign * 2 * pi * i * j / (2m))
+                  std::complex<T> w2 = twiddles[j * twiddle_step];       //exp(sign * 2 * pi * i * j / (4m))
+
+                  // first stage: butterflies of half length m
+                  std::complex<T> t1 = mul(w1, x[j + m]);
+                  std::complex<T> t3 = mul(w1, x[j + 3 * m]);
+                  std::complex<T> a0 = x[j] + t1;
+                  std::complex<T> a1 = x[j] - t1;
+                  std::complex<T> a2 = x[j + 2 * m] + t3;
+                  std::complex<T> a3 = x[j + 2 * m] - t3;
+
+                  // second stage: butterflies of half length 2m. The twiddle for a3 is w2 multiplied by exp(sign * pi * i / 2) = sign * i
+                  std::complex<T> b2 = mul(w2, a2);
+                  std::complex<T> b3 = mul(w2, a3);
+                  b3 = std::complex<T>(-sign * b3.imag(), sign * b3.real());
+
+                  x[j]         = a0 + b2;
+                  x[j + 2 * m] = a0 - b2;
+                  x[j + m]     = a1 + b3;
+                  x[j + 3 * m] = a1 - b3;
+                }
+              }
+            }
+          }
+
+          /** @brief Direct evaluation of the discrete Fourier transform with quadratic complexity.
+          *
+          * @param in         Input data
+          * @param out        Output data, must not overlap with the input
+          * @param size       Number of complex entries
+          * @param unit_roots Powers of exp(sign * 2 * pi * i / size), 'size' entries
+          */
+          template <typename T>
+          void direct_transform(std::complex<T> const * in, std::complex<T> * out, std::size_t size, std::complex<T> const * unit_roots)
+          {
+            for (std::size_t k = 0; k < size; ++k)
+            {
+              std::complex<T> sum = 0;
+              std::size_t index = 0;   // (k * n) mod size
+              for (std::size_t n = 0; n < size; ++n)
+              {
+                sum += mul(in[n], unit_roots[index]);
+                index += k;
+                if (index >= size)
+                  index -= size;
+              }
+              out[k] = sum;
+            }
+          }
+
+          /** @brief Selects the algorithm used for a transform */
+          enum transform_algorithm
+          {
+            ALGORITHM_AUTO,       //fastest algorithm for the size
+            ALGORITHM_DIRECT,     //direct evaluation with quadratic complexity
+            ALGORITHM_RADIX,      //radix algorithm, power-of-two sizes only
+            ALGORITHM_BLUESTEIN   //Bluestein's algorithm, any size
+          };
+
+          /** @brief A pool of complex scratch buffers, which are reused across transforms instead of being allocated for each call.
+          *
+          * The pool is protected by a mutex, so buffers can be acquired by several threads at the same time (OpenMP threads or others).
+          */
+          template <typename T>
+          class workspace_pool
+          {
+            public:
+              typedef std::vector<std::complex<T> >   workspace_type;
+
+              workspace_pool() {}
+
+              ~workspace_pool()
+              {
+                for (std::size_t i = 0; i < free_workspaces_.size(); ++i)
+                  delete free_workspaces_[i];
+              }
+
+              /** @brief Takes a scratch buffer with at least 'min_size' entries from the pool. Must be returned with release_workspace(). */
+              workspace_type * acquire_workspace(std::size_t min_size) const
+              {
+                workspace_type * result = NULL;
+                {
+                  viennacl::tools::lock_guard guard(mutex_);
+                  if (free_workspaces_.size() > 0)
+                  {
+                    result = free_workspaces_.back();
+                    free_workspaces_.pop_back();
+                  }
+                }
+
+                if (!result)
+                  result = new workspace_type();
+                if (result->size() < min_size)
+                  result->resize(min_size);
+                return result;
+              }
+
+              /** @brief Returns a scratch buffer obtained from acquire_workspace() to the pool */
+              void release_workspace(workspace_type * workspace) const
+              {
+                viennacl::tools::lock_guard guard(mutex_);
+                free_workspaces_.push_back(workspace);
+              }
+
+            private:
+              workspace_pool(workspace_pool const &);
+              workspace_pool & operator=(workspace_pool const &);
+
+              mutable std::vector<workspace_type *> free_workspaces_;
+              mutable viennacl::tools::mutex mutex_;
+          };
+
+          /** @brief Precomputed tables for transforming arrays of a given size and direction.
+          *
+          * The tables are immutable after construction, so that a single instance can be used by any number of threads at the same time.
+          * In addition, the tables keep a pool of scratch buffers.
+          *
+          * For Bluestein's algorithm, the transform of size n is computed by a cyclic convolution of size ext_size (the next power of two of 2n-1):
+          *   X_k = c_k * sum_j (x_j c_j) conj(c_{k-j}),   c_k = exp(sign * pi * i * k^2 / n)
+          */
+          template <typename T>
+          class transform_tables : public workspace_pool<T>
+          {
+            public:
+              typedef T   value_type;
+
+              transform_tables(std::size_t size, T sign, transform_algorithm algorithm)
+                : size_(size), sign_(sign), ext_size_(0), use_direct_(false)
+              {
+                if (algorithm == ALGORITHM_DIRECT || (algorithm == ALGORITHM_AUTO && !is_power_of_two(size) && size <= DIRECT_MAX_SIZE))
+                {
+                  use_direct_ = true;
+                  compute_twiddles(size, size, sign, twiddles_);
+                }
+                else if (is_power_of_two(size) && algorithm != ALGORITHM_BLUESTEIN)
+                {
+                  compute_twiddles(size, size / 2, sign, twiddles_);
+                  compute_bit_reversal(size, swaps_);
+                }
+                else if (size > 1)
+                {
+                  // Bluestein: convolution is carried out with forward transforms only
+                  ext_size_ = next_power_of_two(2 * size - 1);
+                  compute_twiddles(ext_size_, ext_size_ / 2, T(-1), twiddles_);
+                  compute_bit_reversal(ext_size_, swaps_);
+
+                  chirp_.resize(size);
+                  for (std::size_t k = 0; k < size; ++k)
+                    chirp_[k] = unit_root((k * k) % (2 * size), 2 * size, sign);
+
+                  chirp_spectrum_.assign(ext_size_, std::complex<T>(0));
+                  chirp_spectrum_[0] = std::conj(chirp_[0]);
+                  for (std::size_t k = 1; k < size; ++k)
+                  {
+                    chirp_spectrum_[k]             = std::conj(chirp_[k]);
+                    chirp_spectrum_[ext_size_ - k] = std::conj(chirp_[k]);
+                  }
+                  radix4_inplace(&(chirp_spectrum_[0]), ext_size_, &(twiddles_[0]), swaps_, T(-1));
+                }
+              }
+
+              std::size_t size() const { return size_; }
+
+              /** @brief Returns the number of bytes occupied by the tables */
+              std::size_t memory_size() const
+              {
+                return sizeof(std::complex<T>) * (twiddles_.size() + chirp_.size() + chirp_spectrum_.size()) + sizeof(std::size_t) * swaps_.size();
+              }
+
+              /** @brief Returns the number of complex entries needed as workspace per transform */
+              std::size_t workspace_size() const { return use_direct_ ? size_ : ext_size_; }
+
+              /** @brief Transforms a contiguous array in place. 'workspace' must hold at least workspace_size() entries. */
+              void apply(std::complex<T> * data, std::complex<T> * workspace) const
+              {
+                if (size_ < 2)
+                  return;
+
+                if (use_direct_)
+                {
+                  std::copy(data, data + size_, workspace);
+                  direct_transform(workspace, data, size_, &(twiddles_[0]));
+                }
+                else if (ext_size_ == 0)
+                  radix4_inplace(data, size_, &(twiddles_[0]), swaps_, sign_);
+                else
+                  apply_bluestein(data, workspace);
+              }
+
+            private:
+              transform_tables(transform_tables const &);
+              transform_tables & operator=(transform_tables const &);
+
+              void apply_bluestein(std::complex<T> * data, std::complex<T> * a) const
+              {
+                for (std::size_t k = 0; k < size_; ++k)
+                  a[k] = mul(data[k], chirp_[k]);
+                std::fill(a + size_, a + ext_size_, std::complex<T>(0));
+
+                radix4_inplace(a, ext_size_, &(twiddles_[0]), swaps_, T(-1));
+
+                // inverse transform of the product via conj(FFT(conj(.))):
+                for (std::size_t k = 0; k < ext_size_; ++k)
+                  a[k] = std::conj(mul(a[k], chirp_spectrum_[k]));
+
+                radix4_inplace(a, ext_size_, &(twiddles_[0]), swaps_, T(-1));
+
+                T scale = T(1) / static_cast<T>(ext_size_);
+                for (std::size_t k = 0; k < size_; ++k)
+                  data[k] = mul(std::conj(a[k]), chirp_[k]) * scale;
+              }
+
+              std::size_t size_;
+              T sign_;
+              std::size_t ext_size_;   //size of the convolution in Bluestein's algorithm, zero if not used
+              bool use_direct_;
+              std::vector<std::complex<T> > twiddles_;
+              std::vector<std::size_t> swaps_;
+              std::vector<std::complex<T> > chirp_;
+              std::vector<std::complex<T> > chirp_spectrum_;
+          };
+
+          /** @brief The process-wide cache for tables of one type (complex or real transforms in single or double precision).
+          *
+          * Tables are shared by all plans of the same size, direction and algorithm. The cache counts the plans using each tables.
+          * Tables without users are kept for later plans until trim() is called or room is needed for new tables.
+          * At most VIENNACL_FFT_PLAN_CACHE_MAX_BYTES bytes of tables are cached, larger tables are private to their plan.
+          * All accesses are protected by a mutex, so plans may be created and destroyed by several threads at the same time.
+          */
+          template <typename TablesType>
+          class tables_cache
+          {
+              typedef typename TablesType::value_type                 value_type;
+
+            public:
+              typedef std::pair<std::pair<std::size_t, bool>, int>    key_type;
+
+              /** @brief Returns the cache. It is never destroyed, so that plans may still release their tables during static destruction. */
+              static tables_cache & instance()
+              {
+                static tables_cache * cache = new tables_cache();
+                return *cache;
+              }
+
+              static key_type make_key(std::size_t size, value_type sign, transform_algorithm algorithm)
+              {
+                return key_type(std::make_pair(size, sign > 0), static_cast<int>(algorithm));
+              }
+
+              /** @brief Returns the tables for the given size, direction and algorithm.
+              *
+              * If 'cached' is set to true, the tables belong to the cache and must be returned by release(). Otherwise the caller takes ownership.
+              * The tables are computed outside of the lock, so that their construction may use other caches.
+              */
+              TablesType const * acquire(std::size_t size, value_type sign, transform_algorithm algorithm, bool & cached)
+              {
+                key_type key = make_key(size, sign, algorithm);
+                cached = true;
+                {
+                  viennacl::tools::lock_guard guard(mutex_);
+                  typename entries_type::iterator it = entries_.find(key);
+                  if (it != entries_.end())
+                  {
+                    ++(it->second.users);
+                    return it->second.tables;
+                  }
+                }
+
+                TablesType const * new_tables = new TablesType(size, sign, algorithm);
+                std::size_t new_bytes = new_tables->memory_size();
+                TablesType const * result = new_tables;
+                std::vector<TablesType const *> unused;
+                {
+                  viennacl::tools::lock_guard guard(mutex_);
+                  typename entries_type::iterator it = entries_.find(key);
+                  if (it != entries_.end())      //inserted by another thread in the meantime
+                  {
+                    ++(it->second.users);
+                    result = it->second.tables;
+                    unused.push_back(new_tables);
+                  }
+                  else
+                  {
+                    if (bytes_ + new_bytes > VIENNACL_FFT_PLAN_CACHE_MAX_BYTES)
+                      remove_unused(unused);
+
+                    if (bytes_ + new_bytes <= VIENNACL_FFT_PLAN_CACHE_MAX_BYTES)
+                    {
+                      entries_[key] = entry(new_tables, new_bytes);
+                      bytes_ += new_bytes;
+                    }
+                    else
+                      cached = false;
+                  }
+                }
+
+                destroy(unused);
+                return result;
+              }
+
+              /** @brief Registers an additional user of cached tables */
+              void add_user(key_type const & key)
+              {
+                viennacl::tools::lock_guard guard(mutex_);
+                ++(entries_[key].users);
+              }
+
+              /** @brief Releases cached tables obtained from acquire() or registered by add_user(). The tables stay in the cache. */
+              void release(key_type const & key)
+              {
+                viennacl::tools::lock_guard guard(mutex_);
+                --(entries_[key].users);
+              }
+
+              /** @brief Destroys all cached tables which are not used by a plan */
+              void trim()
+              {
+                std::vector<TablesType const *> unused;
+                {
+                  viennacl::tools::lock_guard guard(mutex_);
+                  remove_unused(unused);
+                }
+                destroy(unused);
+              }
+
+              /** @brief Returns the number of bytes of all cached tables */
+              std::size_t bytes()
+              {
+                viennacl::tools::lock_guard guard(mutex_);
+                return bytes_;
+              }
+
+            private:
+              struct entry
+              {
+                entry() : tables(NULL), bytes(0), users(0) {}
+                entry(TablesType const * t, std::size_t b) : tables(t), bytes(b), users(1) {}
+
+                TablesType const * tables;
+                std::size_t bytes;
+                std::size_t users;
+              };
+
+              typedef std::map<key_type, entry>   entries_type;
+
+              tables_cache() : bytes_(0) {}
+
+              /** @brief Removes all tables without users from the cache. Must be called with the mutex locked, the tables are destroyed later by destroy(). */
+              void remove_unused(std::vector<TablesType const *> & unused)
+              {
+                for (typename entries_type::iterator it = entries_.begin(); it != entries_.end(); )
+                {
+                  if (it->second.users == 0)
+                  {
+                    unused.push_back(it->second.tables);
+                    bytes_ -= it->second.bytes;
+                    entries_.erase(it++);
+                  }
+                  else
+                    ++it;
+                }
+              }
+
+              /** @brief Destroys tables outside of the lock, as real tables release their complex tables to another cache */
+              static void destroy(std::vector<TablesType const *> const & unused)
+              {
+                for (std::size_t i = 0; i < unused.size(); ++i)
+                  delete unused[i];
+              }
+
+              entries_type entries_;
+              std::size_t bytes_;
+              viennacl::tools::mutex mutex_;
+          };
+
+          /** @brief Refers to the tables for a given size, direction and algorithm, which are taken from the process-wide cache if they fit. Copies refer to the same cached tables. */
+          template <typename TablesType>
+          class tables_reference
+          {
+              typedef tables_cache<TablesType>                 cache_type;
+              typedef typename TablesType::value_type          value_type;
+
+            public:
+              tables_reference(std::size_t size, value_type sign, transform_algorithm algorithm)
+                : key_(cache_type::make_key(size, sign, algorithm)), cached_(false), tables_(cache_type::instance().acquire(size, sign, algorithm, cached_)) {}
+
+              tables_reference(tables_reference const & other) : key_(other.key_), cached_(other.cached_), tables_(other.tables_)
+              {
+                if (cached_)
+                  cache_type::instance().add_user(key_);
+                else  //private tables are not shared, so that copies can be used and destroyed independently
+                  tables_ = new TablesType(key_.first.first, key_.first.second ? value_type(1) : value_type(-1), static_cast<transform_algorithm>(key_.second));
+              }
+
+              ~tables_reference()
+              {
+                if (cached_)
+                  cache_type::instance().release(key_);
+                else
+                  delete tables_;
+              }
+
+              tables_reference & operator=(tables_reference const & other)
+              {
+                tables_reference temp(other);
+                std::swap(key_, temp.key_);
+                std::swap(cached_, temp.cached_);
+                std::swap(tables_, temp.tables_);
+                return *this;
+              }
+
+              TablesType const & operator*() const { return *tables_; }
+              TablesType const * operator->() const { return tables_; }
+
+            private:
+              typename cache_type::key_type key_;
+              bool cached_;
+              TablesType const * tables_;
+          };
+
+          /** @brief Precomputed tables for transforms of real data of a given size.
+          *
+          * For even sizes n = 2m, the real input x is packed into the complex array z_k = x_{2k} + i x_{2k+1} of length m.
+          * The spectrum X of x is recovered from the spectrum Z of z by
+          *   X_k = E_k + w^k O_k,   E_k = (Z_k + conj(Z_{m-k})) / 2,   O_k = (Z_k - conj(Z_{m-k})) / (2i),   w = exp(sign * 2 * pi * i / n),
+          * so only a complex transform of half the length is required. The inverse transform reverses these steps.
+          * Odd sizes are transformed by a complex transform of full length.
+          */
+          template <typename T>
+          class real_transform_tables : public workspace_pool<T>
+          {
+            public:
+              typedef T   value_type;
+
+              real_transform_tables(std::size_t size, T sign, transform_algorithm algorithm)
+                : size_(size), half_size_((size % 2 == 0) ? size / 2 : size), complex_tables_(half_size_, sign, algorithm)
+              {
+                if (size % 2 == 0)
+                  compute_twiddles(size, half_size_ + 1, sign, twiddles_);
+              }
+
+              std::size_t size() const { return size_; }
+
+              /** @brief Returns the number of bytes occupied by the tables, excluding the shared tables of the complex transform */
+              std::size_t memory_size() const { return sizeof(std::complex<T>) * twiddles_.size(); }
+
+              /** @brief Returns the number of complex entries of the spectrum, i.e. size/2 + 1 */
+              std::size_t spectrum_size() const { return size_ / 2 + 1; }
+
+              /** @brief Returns the number of complex entries needed as workspace per transform */
+              std::size_t workspace_size() const { return half_size_ + std::max<std::size_t>(complex_tables_->workspace_size(), 1); }
+
+              /** @brief Computes the first size/2+1 entries of the spectrum of the real array 'x'. The remaining entries follow from conjugate symmetry. */
+              void forward(T const * x, std::complex<T> * X, std::complex<T> * workspace) const
+              {
+                std::complex<T> * z = workspace;
+                std::complex<T> * complex_workspace = workspace + half_size_;
+
+                if (size_ % 2 == 1)
+                {
+                  for (std::size_t k = 0; k < size_; ++k)
+                    z[k] = std::complex<T>(x[k], 0);
+                  complex_tables_->apply(z, complex_workspace);
+                  std::copy(z, z + spectrum_size(), X);
+                  return;
+                }
+
+                std::size_t m = half_size_;
+                for (std::size_t k = 0; k < m; ++k)
+                  z[k] = std::complex<T>(x[2 * k], x[2 * k + 1]);
+                complex_tables_->apply(z, complex_workspace);
+
+                for (std::size_t k = 0; k <= m; ++k)
+                {
+                  std::complex<T> zk  = z[(k == m) ? 0 : k];
+                  std::complex<T> zmk = std::conj(z[(k == 0) ? 0 : m - k]);
+                  std::complex<T> e = (zk + zmk) * T(0.5);
+                  std::complex<T> o = (zk - zmk) * T(0.5);
+                  o = std::complex<T>(o.imag(), -o.real());   // divide by i
+                  X[k] = e + mul(twiddles_[k], o);
+                }
+              }
+
+              /** @brief Computes the real array 'x' from the first size/2+1 entries of its spectrum. The result is normalized, so that inverse(forward(x)) = x.
+              *
+              * The tables must have been created with the sign opposite to that of the forward transform.
+              */
+              void inverse(std::complex<T> const * X, T * x, std::complex<T> * workspace) const
+              {
+                std::complex<T> * z = workspace;
+                std::complex<T> * complex_workspace = workspace + half_size_;
+
+                if (size_ % 2 == 1)
+                {
+                  std::size_t half = spectrum_size();
+                  std::copy(X, X + half, z);
+                  for (std::size_t k = half; k < size_; ++k)
+                    z[k] = std::conj(X[size_ - k]);
+                  complex_tables_->apply(z, complex_workspace);
+
+                  T scale = T(1) / static_cast<T>(size_);
+                  for (std::size_t k = 0; k < size_; ++k)
+                    x[k] = z[k].real() * scale;
+                  return;
+                }
+
+                std::size_t m = half_size_;
+                for (std::size_t k = 0; k < m; ++k)
+                {
+                  std::complex<T> xk  = X[k];
+                  std::complex<T> xmk = std::conj(X[m - k]);
+                  std::complex<T> e = (xk + xmk) * T(0.5);
+                  std::complex<T> o = mul((xk - xmk) * T(0.5), twiddles_[k]);
+                  z[k] = e + std::complex<T>(-o.imag(), o.real());   // e + i * o
+                }
+                complex_tables_->apply(z, complex_workspace);
+
+                T scale = T(1) / static_cast<T>(m);
+                for (std::size_t k = 0; k < m; ++k)
+                {
+                  x[2 * k]     = z[k].real() * scale;
+                  x[2 * k + 1] = z[k].imag() * scale;
+                }
+              }
+
+            private:
+              std::size_t size_;
+              std::size_t half_size_;   //length of the complex transform
+              tables_reference<transform_tables<T> > complex_tables_;
+              std::vector<std::complex<T> > twiddles_;
+          };
+
+          /** @brief Computes a batch of transforms stored in a strided array.
+          *
+          * For ROW_MAJOR, entry n of transform b is located at b * stride + n, for COL_MAJOR at n * stride + b.
+          * Transforms along columns are computed by gathering blocks of columns into contiguous buffers, so that the matrix is accessed row-wise.
+          *
+          * @param tables      Tables for the size and direction of the transforms
+          * @param in          Input data. May be identical to 'out'.
+          * @param out         Output data
+          * @param stride      Stride between transforms (ROW_MAJOR) or between the entries of a transform (COL_MAJOR), in complex entries
+          * @param batch_num   Number of transforms
+          * @param data_order  Layout of the batch
+          */
+          template <typename T>
+          void batched_transform(transform_tables<T> const & tables,
+                                 std::complex<T> const * in, std::complex<T> * out,
+                                 std::size_t stride, std::size_t batch_num,
+                                 viennacl::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order)
+          {
+            std::size_t size = tables.size();
+            if (size == 0 || batch_num == 0)
+              return;
+
+            if (data_order == viennacl::detail::fft::FFT_DATA_ORDER::ROW_MAJOR)
+            {
+              long num_transforms = static_cast<long>(batch_num);
+#ifdef VIENNACL_WITH_OPENMP
+              #pragma omp parallel if (batch_num > 1 && size * batch_num > OPENMP_MIN_ENTRIES)
+#endif
+              {
+                typename transform_tables<T>::workspace_type * workspace = tables.acquire_workspace(std::max<std::size_t>(tables.workspace_size(), 1));
+
+#ifdef VIENNACL_WITH_OPENMP
+                #pragma omp for
+#endif
+                for (long b = 0; b < num_transforms; ++b)
+                {
+                  std::complex<T> * data = out + static_cast<std::size_t>(b) * stride;
+                  if (in != out)
+                    std::copy(in + static_cast<std::size_t>(b) * stride, in + static_cast<std::size_t>(b) * stride + size, data);
+                  tables.apply(data, &((*workspace)[0]));
+                }
+
+                tables.release_workspace(workspace);
+              }
+            }
+            else
+            {
+              long num_blocks = static_cast<long>((batch_num - 1) / COLUMN_BLOCK_SIZE + 1);
+#ifdef VIENNACL_WITH_OPENMP
+              #pragma omp parallel if (num_blocks > 1 && size * batch_num > OPENMP_MIN_ENTRIES)
+#endif
+              {
+                // one scratch buffer holds the gathered columns, followed by the workspace of the transform:
+                typename transform_tables<T>::workspace_type * scratch = tables.acquire_workspace(size * COLUMN_BLOCK_SIZE + std::max<std::size_t>(tables.workspace_size(), 1));
+                std::complex<T> * columns   = &((*scratch)[0]);
+                std::complex<T> * workspace = columns + size * COLUMN_BLOCK_SIZE;
+
+#ifdef VIENNACL_WITH_OPENMP
+                #pragma omp for
+#endif
+                for (long block = 0; block < num_blocks; ++block)
+                {
+                  std::size_t col_begin = static_cast<std::size_t>(block) * COLUMN_BLOCK_SIZE;
+                  std::size_t num_cols  = std::min(COLUMN_BLOCK_SIZE, batch_num - col_begin);
+
+                  for (std::size_t n = 0; n < size; ++n)
+                    for (std::size_t c = 0; c < num_cols; ++c)
+                      columns[c * size + n] = in[n * stride + col_begin + c];
+
+                  for (std::size_t c = 0; c < num_cols; ++c)
+                    tables.apply(columns + c * size, workspace);
+
+                  for (std::size_t n = 0; n < size; ++n)
+                    for (std::size_t c = 0; c < num_cols; ++c)
+                      out[n * stride + col_begin + c] = columns[c * size + n];
+                }
+
+                tables.release_workspace(scratch);
+              }
+            }
+          }
+
+          template <typename SCALARTYPE>
+          std::complex<SCALARTYPE> * complex_pointer(viennacl::backend::mem_handle & handle)
+          {
+            return reinterpret_cast<std::complex<SCALARTYPE> *>(viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(handle));
+          }
+
+          template <typename SCALARTYPE>
+          std::complex<SCALARTYPE> const * complex_pointer(viennacl::backend::mem_handle const & handle)
+          {
+            return reinterpret_cast<std::complex<SCALARTYPE> const *>(viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(handle));
+          }
+
+          /** @brief Returns a pointer to the entries of a vector in main memory. Entries of a strided vector (e.g. a vector_slice) are copied to 'buffer' first. */
+          template <typename SCALARTYPE>
+          SCALARTYPE const * gather(viennacl::vector_base<SCALARTYPE> const & vec, std::size_t count, SCALARTYPE * buffer)
+          {
+            SCALARTYPE const * data = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(vec.handle()) + vec.start();
+            if (vec.stride() == 1)
+              return data;
+
+            for (std::size_t i = 0; i < count; ++i)
+              buffer[i] = data[i * vec.stride()];
+            return buffer;
+          }
+
+          /** @brief Returns the location the first 'count' entries of a vector in main memory are to be written to: Either the vector itself or, for strided vectors, 'buffer'. Complete with scatter(). */
+          template <typename SCALARTYPE>
+          SCALARTYPE * output_pointer(viennacl::vector_base<SCALARTYPE> & vec, SCALARTYPE * buffer)
+          {
+            if (vec.stride() == 1)
+              return viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(vec.handle()) + vec.start();
+            return buffer;
+          }
+
+          /** @brief Copies the first 'count' entries written to the location obtained from output_pointer() to a strided vector */
+          template <typename SCALARTYPE>
+          void scatter(SCALARTYPE const * buffer, std::size_t count, viennacl::vector_base<SCALARTYPE> & vec)
+          {
+            if (vec.stride() == 1)
+              return;
+
+            SCALARTYPE * data = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(vec.handle()) + vec.start();
+            for (std::size_t i = 0; i < count; ++i)
+              data[i * vec.stride()] = buffer[i];
+          }
+
+          /** @brief Blocked out-of-place transpose of a complex row-major matrix with 'rows' rows and 'cols' columns */
+          template <typename T>
+          void transpose(std::complex<T> const * in, std::complex<T> * out, std::size_t rows, std::size_t cols)
+          {
+            const std::size_t block_size = 32;
+            long num_row_blocks = static_cast<long>((rows + block_size - 1) / block_size);
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for if (rows * cols > OPENMP_MIN_ENTRIES)
+#endif
+            for (long row_block = 0; row_block < num_row_blocks; ++row_block)
+            {
+              std::size_t row_begin = static_cast<std::size_t>(row_block) * block_size;
+              std::size_t row_end   = std::min(row_begin + block_size, rows);
+              for (std::size_t col_begin = 0; col_begin < cols; col_begin += block_size)
+              {
+                std::size_t col_end = std::min(col_begin + block_size, cols);
+                for (std::size_t i = row_begin; i < row_end; ++i)
+                  for (std::size_t j = col_begin; j < col_end; ++j)
+                    out[j * rows + i] = in[i * cols + j];
+              }
+            }
+          }
+        } //namespace detail
+
+
+        /** @brief Destroys all cached FFT tables which are not used by a plan. Cf. viennacl::backend::cpu_ram::trim_pool(). */
+        inline void trim_plan_cache()
+        {
+          // real tables first, as they refer to tables of complex transforms:
+          detail::tables_cache<detail::real_transform_tables<float> >::instance().trim();
+          detail::tables_cache<detail::real_transform_tables<double> >::instance().trim();
+          detail::tables_cache<detail::transform_tables<float> >::instance().trim();
+          detail::tables_cache<detail::transform_tables<double> >::instance().trim();
+        }
+
+        /** @brief Returns the number of bytes of all tables held by the process-wide FFT plan caches */
+        inline std::size_t plan_cache_bytes()
+        {
+          return detail::tables_cache<detail::real_transform_tables<float> >::instance().bytes()
+               + detail::tables_cache<detail::real_transform_tables<double> >::instance().bytes()
+               + detail::tables_cache<detail::transform_tables<float> >::instance().bytes()
+               + detail::tables_cache<detail::transform_tables<double> >::instance().bytes();
+        }
+
+
+        /** @brief A reusable plan for transforms of a fixed size and direction.
+        *
+        * The twiddle factors, bit-reversal permutation and Bluestein chirp spectrum are computed once and shared by all plans of the same size, direction and precision.
+        * Scratch buffers are taken from a pool attached to the tables, so repeated transforms do not allocate.
+        * A plan may be used by several threads at the same time.
+        */
+        template <typename SCALARTYPE>
+        class plan
+        {
+          public:
+            plan(std::size_t size, SCALARTYPE sign, detail::transform_algorithm algorithm = detail::ALGORITHM_AUTO)
+              : tables_(size, sign, algorithm) {}
+
+            /** @brief Returns the number of complex entries per transform */
+            std::size_t size() const { return tables_->size(); }
+
+            /** @brief Computes a batch of transforms. 'in' and 'out' may refer to the same buffer.
+            *
+            * @param in          Input data (interleaved complex numbers)
+            * @param out         Output data (interleaved complex numbers)
+            * @param stride      Stride between transforms (ROW_MAJOR) or between the entries of a transform (COL_MAJOR), in complex entries
+            * @param batch_num   Number of transforms
+            * @param data_order  Layout of the batch
+            */
+            void execute(viennacl::backend::mem_handle const & in,
+                         viennacl::backend::mem_handle & out,
+                         std::size_t stride, std::size_t batch_num,
+                         viennacl::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order = viennacl::detail::fft::FFT_DATA_ORDER::ROW_MAJOR) const
+            {
+              detail::batched_transform(*tables_, detail::complex_pointer<SCALARTYPE>(in), detail::complex_pointer<SCALARTYPE>(out),
+                                        stride, batch_num, data_order);
+            }
+
+          private:
+            detail::tables_reference<detail::transform_tables<SCALARTYPE> > tables_;
+        };
+
+
+        /** @brief A reusable plan for Fourier transforms of real data of a fixed size.
+        *
+        * The spectrum of a real array of size n consists of n/2+1 complex entries (interleaved), the remaining entries follow from conjugate symmetry.
+        * For even sizes, the transforms require a complex transform of only half the length. Like plan, the tables are shared and a plan may be used by several threads at the same time.
+        */
+        template <typename SCALARTYPE>
+        class real_plan
+        {
+            typedef detail::real_transform_tables<SCALARTYPE>   tables_type;
+
+          public:
+            explicit real_plan(std::size_t size)
+              : forward_tables_(size, SCALARTYPE(-1), detail::ALGORITHM_AUTO),
+                inverse_tables_(size, SCALARTYPE(1), detail::ALGORITHM_AUTO) {}
+
+            /** @brief Returns the number of real entries per transform */
+            std::size_t size() const { return forward_tables_->size(); }
+
+            /** @brief Computes the spectrum (size/2+1 complex entries, interleaved) of the first size() entries of 'in'. Vector ranges and slices are supported. */
+            void forward(viennacl::vector_base<SCALARTYPE> const & in, viennacl::vector_base<SCALARTYPE> & out) const
+            {
+              std::size_t spectrum_size = forward_tables_->spectrum_size();
+              std::size_t workspace_size = forward_tables_->workspace_size();
+
+              // the workspace of the transform is followed by buffers for strided input and output:
+              typename tables_type::workspace_type * workspace = forward_tables_->acquire_workspace(workspace_size + (size() + 1) / 2 + spectrum_size);
+              std::complex<SCALARTYPE> * scratch = &((*workspace)[0]);
+              SCALARTYPE * in_buffer  = reinterpret_cast<SCALARTYPE *>(scratch + workspace_size);
+              SCALARTYPE * out_buffer = reinterpret_cast<SCALARTYPE *>(scratch + workspace_size + (size() + 1) / 2);
+
+              SCALARTYPE const * x = detail::gather(in, size(), in_buffer);
+              SCALARTYPE * X = detail::output_pointer(out, out_buffer);
+              forward_tables_->forward(x, reinterpret_cast<std::complex<SCALARTYPE> *>(X), scratch);
+              detail::scatter(X, 2 * spectrum_size, out);
+
+              forward_tables_->release_workspace(workspace);
+            }
+
+            /** @brief Computes the size() real entries of 'out' from their spectrum (size/2+1 complex entries, interleaved). The result is normalized. Vector ranges and slices are supported. */
+            void inverse(viennacl::vector_base<SCALARTYPE> const & in, viennacl::vector_base<SCALARTYPE> & out) const
+            {
+              std::size_t spectrum_size = inverse_tables_->spectrum_size();
+              std::size_t workspace_size = inverse_tables_->workspace_size();
+
+              typename tables_type::workspace_type * workspace = inverse_tables_->acquire_workspace(workspace_size + spectrum_size + (size() + 1) / 2);
+              std::complex<SCALARTYPE> * scratch = &((*workspace)[0]);
+              SCALARTYPE * in_buffer  = reinterpret_cast<SCALARTYPE *>(scratch + workspace_size);
+              SCALARTYPE * out_buffer = reinterpret_cast<SCALARTYPE *>(scratch + workspace_size + spectrum_size);
+
+              SCALARTYPE const * X = detail::gather(in, 2 * spectrum_size, in_buffer);
+              SCALARTYPE * x = detail::output_pointer(out, out_buffer);
+              inverse_tables_->inverse(reinterpret_cast<std::complex<SCALARTYPE> const *>(X), x, scratch);
+              detail::scatter(x, size(), out);
+
+              inverse_tables_->release_workspace(workspace);
+            }
+
+            /** @brief Computes the cyclic convolution of two real arrays of length size(). The output may coincide with any of the inputs. Vector ranges and slices are supported. */
+            void convolve(viennacl::vector_base<SCALARTYPE> const & in1,
+                          viennacl::vector_base<SCALARTYPE> const & in2,
+                          viennacl::vector_base<SCALARTYPE> & out) const
+            {
+              std::size_t spectrum_size = forward_tables_->spectrum_size();
+              std::size_t workspace_size = std::max(forward_tables_->workspace_size(), inverse_tables_->workspace_size());
+              std::size_t real_size = (size() + 1) / 2;   //complex entries holding size() real entries
+
+              typename tables_type::workspace_type * workspace = forward_tables_->acquire_workspace(2 * spectrum_size + workspace_size + real_size);
+              std::complex<SCALARTYPE> * X1 = &((*workspace)[0]);
+              std::complex<SCALARTYPE> * X2 = X1 + spectrum_size;
+              std::complex<SCALARTYPE> * scratch = X2 + spectrum_size;
+              SCALARTYPE * buffer = reinterpret_cast<SCALARTYPE *>(scratch + workspace_size);   //for strided inputs and output, used one after another
+
+              forward_tables_->forward(detail::gather(in1, size(), buffer), X1, scratch);
+              forward_tables_->forward(detail::gather(in2, size(), buffer), X2, scratch);
+              for (std::size_t k = 0; k < spectrum_size; ++k)
+                X1[k] = detail::mul(X1[k], X2[k]);
+
+              SCALARTYPE * x = detail::output_pointer(out, buffer);
+              inverse_tables_->inverse(X1, x, scratch);
+              detail::scatter(x, size(), out);
+
+              forward_tables_->release_workspace(workspace);
+            }
+
+          private:
+            detail::tables_reference<tables_type> forward_tables_;
+            detail::tables_reference<tables_type> inverse_tables_;
+        };
+
+
+        /** @brief Direct algorithm for computing the Fourier transformation with quadratic complexity. Works on any size of data. */
+        template <typename SCALARTYPE>
+        void direct(viennacl::backend::mem_handle const & in,
+                    viennacl::backend::mem_handle & out,
+                    std::size_t size, std::size_t stride, std::size_t batch_num, SCALARTYPE sign,
+                    viennacl::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order)
+        {
+          plan<SCALARTYPE>(size, sign, detail::ALGORITHM_DIRECT).execute(in, out, stride, batch_num, data_order);
+        }
+
+        /** @brief In-place radix algorithm for computing the Fourier transformation. Works only on power-of-two sizes of data. */
+        template <typename SCALARTYPE>
+        void radix2(viennacl::backend::mem_handle & in,
+                    std::size_t size, std::size_t stride, std::size_t batch_num, SCALARTYPE sign,
+                    viennacl::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order)
+        {
+          assert(detail::is_power_of_two(size) && bool("Radix algorithm requires a power-of-two size"));
+          plan<SCALARTYPE>(size, sign, detail::ALGORITHM_RADIX).execute(in, in, stride, batch_num, data_order);
+        }
+
+        /** @brief Computes the Fourier transformation with the fastest available algorithm for the given size. 'in' and 'out' may refer to the same buffer. */
+        template <typename SCALARTYPE>
+        void transform(viennacl::backend::mem_handle const & in,
+                       viennacl::backend::mem_handle & out,
+                       std::size_t size, std::size_t stride, std::size_t batch_num, SCALARTYPE sign,
+                       viennacl::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order)
+        {
+          plan<SCALARTYPE>(size, sign).execute(in, out, stride, batch_num, data_order);
+        }
+
+        /** @brief Bluestein's algorithm for computing the Fourier transformation of a single vector of any size. */
+        template <typename SCALARTYPE, unsigned int ALIGNMENT>
+        void bluestein(viennacl::vector<SCALARTYPE, ALIGNMENT> const & in,
+                       viennacl::vector<SCALARTYPE, ALIGNMENT> & out)
+        {
+          std::size_t size = in.size() >> 1;
+          plan<SCALARTYPE>(size, SCALARTYPE(-1), detail::ALGORITHM_BLUESTEIN).execute(in.handle(), out.handle(), size, 1);
+        }
+
+        /** @brief Elementwise product of two complex vectors */
+        template <typename SCALARTYPE, unsigned int ALIGNMENT>
+        void multiply(viennacl::vector<SCALARTYPE, ALIGNMENT> const & input1,
+                      viennacl::vector<SCALARTYPE, ALIGNMENT> const & input2,
+                      viennacl::vector<SCALARTYPE, ALIGNMENT> & output)
+        {
+          std::complex<SCALARTYPE> const * x = detail::complex_pointer<SCALARTYPE>(input1.handle());
+          std::complex<SCALARTYPE> const * y = detail::complex_pointer<SCALARTYPE>(input2.handle());
+          std::complex<SCALARTYPE>       * z = detail::complex_pointer<SCALARTYPE>(output.handle());
+          long size = static_cast<long>(input1.size() >> 1);
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for if (size > static_cast<long>(detail::OPENMP_MIN_ENTRIES))
+#endif
+          for (long i = 0; i < size; ++i)
+            z[i] = detail::mul(x[i], y[i]);
+        }
+
+        /** @brief Divides a complex vector by its number of entries */
+        template <typename SCALARTYPE, unsigned int ALIGNMENT>
+        void normalize(viennacl::vector<SCALARTYPE, ALIGNMENT> & input)
+        {
+          SCALARTYPE * data = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(input.handle());
+          std::size_t size = input.size() >> 1;
+          SCALARTYPE factor = SCALARTYPE(1) / static_cast<SCALARTYPE>(size);
+          long num_entries = static_cast<long>(2 * size);
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for if (num_entries > static_cast<long>(detail::OPENMP_MIN_ENTRIES))
+#endif
+          for (long i = 0; i < num_entries; ++i)
+            data[i] *= factor;
+        }
+
+        /** @brief In-place transpose of a complex matrix. Each row of the matrix holds internal_size2()/2 complex entries. */
+        template <typename SCALARTYPE, unsigned int ALIGNMENT>
+        void transpose(viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> & input)
+        {
+          std::size_t rows = input.internal_size1();
+          std::size_t cols = input.internal_size2() >> 1;
+          std::complex<SCALARTYPE> * data = detail::complex_pointer<SCALARTYPE>(input.handle());
+
+          std::vector<std::complex<SCALARTYPE> > temp(data, data + rows * cols);
+          detail::transpose(&(temp[0]), data, rows, cols);
+        }
+
+        /** @brief Transpose of a complex matrix. Each row of the input matrix holds internal_size2()/2 complex entries. */
+        template <typename SCALARTYPE, unsigned int ALIGNMENT>
+        void transpose(viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> const & input,
+                       viennacl::matrix<SCALARTYPE, viennacl::row_major, ALIGNMENT> & output)
+        {
+          detail::transpose(detail::complex_pointer<SCALARTYPE>(input.handle()), detail::complex_pointer<SCALARTYPE>(output.handle()),
+                            input.internal_size1(), input.internal_size2() >> 1);
+        }
+
+        /** @brief Embeds the first 'size' entries of a real vector into a complex vector. Vector ranges and slices are supported, where the complex vector is treated as a real vector of twice the length. */
+        template <typename SCALARTYPE>
+        void real_to_complex(viennacl::vector_base<SCALARTYPE> const & in,
+                             viennacl::vector_base<SCALARTYPE> & out,
+                             std::size_t size)
+        {
+          SCALARTYPE const * x = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(in.handle()) + in.start();
+          SCALARTYPE * z = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(out.handle()) + out.start();
+          std::size_t inc_x = in.stride();
+          std::size_t inc_z = out.stride();
+          for (std::size_t i = 0; i < size; ++i)
+          {
+            z[2 * i * inc_z]       = x[i * inc_x];
+            z[(2 * i + 1) * inc_z] = 0;
+          }
+        }
+
+        /** @brief Extracts the real parts of the first 'size' entries of a complex vector. Vector ranges and slices are supported, where the complex vector is treated as a real vector of twice the length. */
+        template <typename SCALARTYPE>
+        void complex_to_real(viennacl::vector_base<SCALARTYPE> const & in,
+                             viennacl::vector_base<SCALARTYPE> & out,
+                             std::size_t size)
+        {
+          SCALARTYPE const * z = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(in.handle()) + in.start();
+          SCALARTYPE * x = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(out.handle()) + out.start();
+          std::size_t inc_z = in.stride();
+          std::size_t inc_x = out.stride();
+          for (std::size_t i = 0; i < size; ++i)
+            x[i * inc_x] = z[2 * i * inc_z];
+        }
+
+        /** @brief Reverses the entries of a real vector. Vector ranges and slices are supported. */
+        template <typename SCALARTYPE>
+        void reverse(viennacl::vector_base<SCALARTYPE> & in)
+        {
+          SCALARTYPE * x = viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(in.handle()) + in.start();
+          std::size_t inc = in.stride();
+          std::size_t size = in.size();
+          for (std::size_t i = 0; i < size / 2; ++i)
+            std::swap(x[i * inc], x[(size - 1 - i) * inc]);
+        }
+
+      } //namespace fft
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+#endif
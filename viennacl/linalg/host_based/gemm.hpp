@@ -0,0 +1,762 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_GEMM_HPP_
+#define VIENNACL_LINALG_HOST_BASED_GEMM_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/gemm.hpp
+*   @brief A cache-blocked, packed matrix-matrix multiplication engine for the CPU.
+*
+*   The engine follows the well-known GotoBLAS/BLIS layering: Panels of A and B are packed into contiguous, cache-sized buffers,
+*   which are then consumed by a small register-blocked micro-kernel. Parallelization with OpenMP is over the macro-tiles of C.
+*
+*   Vectorized micro-kernels are selected at compile time:
+*     - VIENNACL_WITH_AVX512 enables AVX-512F kernels (compile with e.g. -mavx512f)
+*     - VIENNACL_WITH_AVX2 enables AVX2/FMA kernels (compile with e.g. -mavx2 -mfma)
+*     - VIENNACL_WITH_SSE2 enables SSE2 kernels
+*   Otherwise a portable kernel is used, which is usually auto-vectorized by the compiler.
+*
+*   The matrix-vector product gemv() used by prod() and by the blocked factorizations is also implemented here.
+*/
+
+#include <vector>
+#include <algorithm>
+
+#if defined VIENNACL_WITH_AVX512 || defined VIENNACL_WITH_AVX2
+#include <immintrin.h>
+#elif defined VIENNACL_WITH_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief A light-weight view on a dense matrix in host memory. Entry (i,j) is located at data[i * row_inc + j * col_inc].
+        *
+        * Row-major and column-major storage, transposition, ranges and slices all map to a particular choice of offset and increments.
+        */
+        template <typename NumericT>
+        struct strided_matrix_view
+        {
+          strided_matrix_view(NumericT * data_, std::size_t size1_, std::size_t size2_, std::size_t row_inc_, std::size_t col_inc_)
+            : data(data_), size1(size1_), size2(size2_), row_inc(row_inc_), col_inc(col_inc_) {}
+
+          NumericT & operator()(std::size_t i, std::size_t j) const { return data[i * row_inc + j * col_inc]; }
+
+          /** @brief Returns the view on the transposed matrix (no data is moved) */
+          strided_matrix_view trans() const { return strided_matrix_view(data, size2, size1, col_inc, row_inc); }
+
+          /** @brief Returns the view on the submatrix starting at (i,j) with size num_rows x num_cols */
+          strided_matrix_view sub(std::size_t i, std::size_t j, std::size_t num_rows, std::size_t num_cols) const
+          {
+            return strided_matrix_view(data + i * row_inc + j * col_inc, num_rows, num_cols, row_inc, col_inc);
+          }
+
+          NumericT * data;
+          std::size_t size1, size2;
+          std::size_t row_inc, col_inc;
+        };
+
+        /** @brief Returns a read-only view on the same data */
+        template <typename NumericT>
+        strided_matrix_view<NumericT const> const_view(strided_matrix_view<NumericT> const & view)
+        {
+          return strided_matrix_view<NumericT const>(view.data, view.size1, view.size2, view.row_inc, view.col_inc);
+        }
+
+        /** @brief Creates a strided view of a (possibly transposed) matrix, range, or slice. The memory layout is taken from F::mem_index(), which is linear in its indices. */
+        template <typename NumericT, typename F>
+        strided_matrix_view<NumericT> make_strided_view(matrix_base<NumericT, F> & mat, bool transposed = false)
+        {
+          std::size_t internal_size1 = viennacl::traits::internal_size1(mat);
+          std::size_t internal_size2 = viennacl::traits::internal_size2(mat);
+          strided_matrix_view<NumericT> view(extract_raw_pointer<NumericT>(mat)
+                                              + F::mem_index(viennacl::traits::start1(mat), viennacl::traits::start2(mat), internal_size1, internal_size2),
+                                             viennacl::traits::size1(mat),
+                                             viennacl::traits::size2(mat),
+                                             F::mem_index(viennacl::traits::stride1(mat), 0, internal_size1, internal_size2),
+                                             F::mem_index(0, viennacl::traits::stride2(mat), internal_size1, internal_size2));
+          return transposed ? view.trans() : view;
+        }
+
+        template <typename NumericT, typename F>
+        strided_matrix_view<NumericT const> make_strided_view(matrix_base<NumericT, F> const & mat, bool transposed = false)
+        {
+          std::size_t internal_size1 = viennacl::traits::internal_size1(mat);
+          std::size_t internal_size2 = viennacl::traits::internal_size2(mat);
+          strided_matrix_view<NumericT const> view(extract_raw_pointer<NumericT>(mat)
+                                                    + F::mem_index(viennacl::traits::start1(mat), viennacl::traits::start2(mat), internal_size1, internal_size2),
+                                                   viennacl::traits::size1(mat),
+                                                   viennacl::traits::size2(mat),
+                                                   F::mem_index(viennacl::traits::stride1(mat), 0, internal_size1, internal_size2),
+                                                   F::mem_index(0, viennacl::traits::stride2(mat), internal_size1, internal_size2));
+          return transposed ? view.trans() : view;
+        }
+
+
+        //
+        // Register blocking (MR x NR) of the micro-kernel and cache blocking (MC, KC, NC) of the packed panels
+        //
+
+        /** @brief Blocking parameters for the packed matrix-matrix multiplication. MC and NC are multiples of MR and NR respectively. */
+        template <typename NumericT>
+        struct gemm_blocking
+        {
+          static const std::size_t MR = 4;
+          static const std::size_t NR = 4;
+          static const std::size_t MC = 96;
+          static const std::size_t KC = 256;
+          static const std::size_t NC = 2048;
+        };
+
+#if defined VIENNACL_WITH_AVX512
+        template <> struct gemm_blocking<float>  { static const std::size_t MR = 8; static const std::size_t NR = 32; static const std::size_t MC = 96; static const std::size_t KC = 256; static const std::size_t NC = 2048; };
+        template <> struct gemm_blocking<double> { static const std::size_t MR = 8; static const std::size_t NR = 16; static const std::size_t MC = 96; static const std::size_t KC = 256; static const std::size_t NC = 2048; };
+#elif defined VIENNACL_WITH_AVX2
+        template <> struct gemm_blocking<float>  { static const std::size_t MR = 6; static const std::size_t NR = 16; static const std::size_t MC = 96; static const std::size_t KC = 256; static const std::size_t NC = 2048; };
+        template <> struct gemm_blocking<double> { static const std::size_t MR = 6; static const std::size_t NR =  8; static const std::size_t MC = 96; static const std::size_t KC = 256; static const std::size_t NC = 2048; };
+#else
+        template <> struct gemm_blocking<float>  { static const std::size_t MR = 4; static const std::size_t NR =  8; static const std::size_t MC = 96; static const std::size_t KC = 256; static const std::size_t NC = 2048; };
+        template <> struct gemm_blocking<double> { static const std::size_t MR = 4; static const std::size_t NR =  4; static const std::size_t MC = 96; static const std::size_t KC = 256; static const std::size_t NC = 2048; };
+#endif
+
+
+        //
+        // Micro-kernels: Compute the MR x NR block ab = sum_k a(:,k) * b(k,:) from packed panels.
+        // Packed A holds MR consecutive entries per k, packed B holds NR consecutive entries per k. Result ab is row-major with row length NR.
+        //
+
+        /** @brief Portable micro-kernel. The fixed trip counts allow the compiler to keep the accumulators in registers and to vectorize the inner loop. */
+        template <typename NumericT>
+        struct gemm_micro_kernel
+        {
+          static void apply(std::size_t kc, NumericT const * a, NumericT const * b, NumericT * ab)
+          {
+            static const std::size_t MR = gemm_blocking<NumericT>::MR;
+            static const std::size_t NR = gemm_blocking<NumericT>::NR;
+
+            NumericT acc[MR * NR];
+            for (std::size_t i = 0; i < MR * NR; ++i)
+              acc[i] = 0;
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+              for (std::size_t r = 0; r < MR; ++r)
+              {
+                NumericT a_r = a[r];
+                for (std::size_t c = 0; c < NR; ++c)
+                  acc[r * NR + c] += a_r * b[c];
+              }
+              a += MR;
+              b += NR;
+            }
+
+            for (std::size_t i = 0; i < MR * NR; ++i)
+              ab[i] = acc[i];
+          }
+        };
+
+#if defined VIENNACL_WITH_AVX512
+        template <>
+        struct gemm_micro_kernel<double>
+        {
+          static void apply(std::size_t kc, double const * a, double const * b, double * ab)
+          {
+            __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd(), c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+            __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd(), c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+            __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd(), c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+            __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd(), c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+              __m512d b0 = _mm512_loadu_pd(b);
+              __m512d b1 = _mm512_loadu_pd(b + 8);
+              __m512d a_r;
+              a_r = _mm512_set1_pd(a[0]); c00 = _mm512_fmadd_pd(a_r, b0, c00); c01 = _mm512_fmadd_pd(a_r, b1, c01);
+              a_r = _mm512_set1_pd(a[1]); c10 = _mm512_fmadd_pd(a_r, b0, c10); c11 = _mm512_fmadd_pd(a_r, b1, c11);
+              a_r = _mm512_set1_pd(a[2]); c20 = _mm512_fmadd_pd(a_r, b0, c20); c21 = _mm512_fmadd_pd(a_r, b1, c21);
+              a_r = _mm512_set1_pd(a[3]); c30 = _mm512_fmadd_pd(a_r, b0, c30); c31 = _mm512_fmadd_pd(a_r, b1, c31);
+              a_r = _mm512_set1_pd(a[4]); c40 = _mm512_fmadd_pd(a_r, b0, c40); c41 = _mm512_fmadd_pd(a_r, b1, c41);
+              a_r = _mm512_set1_pd(a[5]); c50 = _mm512_fmadd_pd(a_r, b0, c50); c51 = _mm512_fmadd_pd(a_r, b1, c51);
+              a_r = _mm512_set1_pd(a[6]); c60 = _mm512_fmadd_pd(a_r, b0, c60); c61 = _mm512_fmadd_pd(a_r, b1, c61);
+              a_r = _mm512_set1_pd(a[7]); c70 = _mm512_fmadd_pd(a_r, b0, c70); c71 = _mm512_fmadd_pd(a_r, b1, c71);
+              a += 8;
+              b += 16;
+            }
+
+            _mm512_storeu_pd(ab +   0, c00); _mm512_storeu_pd(ab +   8, c01);
+            _mm512_storeu_pd(ab +  16, c10); _mm512_storeu_pd(ab +  24, c11);
+            _mm512_storeu_pd(ab +  32, c20); _mm512_storeu_pd(ab +  40, c21);
+            _mm512_storeu_pd(ab +  48, c30); _mm512_storeu_pd(ab +  56, c31);
+            _mm512_storeu_pd(ab +  64, c40); _mm512_storeu_pd(ab +  72, c41);
+            _mm512_storeu_pd(ab +  80, c50); _mm512_storeu_pd(ab +  88, c51);
+            _mm512_storeu_pd(ab +  96, c60); _mm512_storeu_pd(ab + 104, c61);
+            _mm512_storeu_pd(ab + 112, c70); _mm512_storeu_pd(ab + 120, c71);
+          }
+        };
+
+        template <>
+        struct gemm_micro_kernel<float>
+        {
+          static void apply(std::size_t kc, float const * a, float const * b, float * ab)
+          {
+            __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps(), c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+            __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps(), c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+            __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps(), c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+            __m512 c60 = _mm512_setzero_ps(), c61 = _mm512_setzero_ps(), c70 = _mm512_setzero_ps(), c71 = _mm512_setzero_ps();
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+              __m512 b0 = _mm512_loadu_ps(b);
+              __m512 b1 = _mm512_loadu_ps(b + 16);
+              __m512 a_r;
+              a_r = _mm512_set1_ps(a[0]); c00 = _mm512_fmadd_ps(a_r, b0, c00); c01 = _mm512_fmadd_ps(a_r, b1, c01);
+              a_r = _mm512_set1_ps(a[1]); c10 = _mm512_fmadd_ps(a_r, b0, c10); c11 = _mm512_fmadd_ps(a_r, b1, c11);
+              a_r = _mm512_set1_ps(a[2]); c20 = _mm512_fmadd_ps(a_r, b0, c20); c21 = _mm512_fmadd_ps(a_r, b1, c21);
+              a_r = _mm512_set1_ps(a[3]); c30 = _mm512_fmadd_ps(a_r, b0, c30); c31 = _mm512_fmadd_ps(a_r, b1, c31);
+              a_r = _mm512_set1_ps(a[4]); c40 = _mm512_fmadd_ps(a_r, b0, c40); c41 = _mm512_fmadd_ps(a_r, b1, c41);
+              a_r = _mm512_set1_ps(a[5]); c50 = _mm512_fmadd_ps(a_r, b0, c50); c51 = _mm512_fmadd_ps(a_r, b1, c51);
+              a_r = _mm512_set1_ps(a[6]); c60 = _mm512_fmadd_ps(a_r, b0, c60); c61 = _mm512_fmadd_ps(a_r, b1, c61);
+              a_r = _mm512_set1_ps(a[7]); c70 = _mm512_fmadd_ps(a_r, b0, c70); c71 = _mm512_fmadd_ps(a_r, b1, c71);
+              a += 8;
+              b += 32;
+            }
+
+            _mm512_storeu_ps(ab +   0, c00); _mm512_storeu_ps(ab +  16, c01);
+            _mm512_storeu_ps(ab +  32, c10); _mm512_storeu_ps(ab +  48, c11);
+            _mm512_storeu_ps(ab +  64, c20); _mm512_storeu_ps(ab +  80, c21);
+            _mm512_storeu_ps(ab +  96, c30); _mm512_storeu_ps(ab + 112, c31);
+            _mm512_storeu_ps(ab + 128, c40); _mm512_storeu_ps(ab + 144, c41);
+            _mm512_storeu_ps(ab + 160, c50); _mm512_storeu_ps(ab + 176, c51);
+            _mm512_storeu_ps(ab + 192, c60); _mm512_storeu_ps(ab + 208, c61);
+            _mm512_storeu_ps(ab + 224, c70); _mm512_storeu_ps(ab + 240, c71);
+          }
+        };
+
+#elif defined VIENNACL_WITH_AVX2
+        template <>
+        struct gemm_micro_kernel<double>
+        {
+          static void apply(std::size_t kc, double const * a, double const * b, double * ab)
+          {
+            __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd(), c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+            __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd(), c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+            __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd(), c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+              __m256d b0 = _mm256_loadu_pd(b);
+              __m256d b1 = _mm256_loadu_pd(b + 4);
+              __m256d a_r;
+              a_r = _mm256_broadcast_sd(a + 0); c00 = _mm256_fmadd_pd(a_r, b0, c00); c01 = _mm256_fmadd_pd(a_r, b1, c01);
+              a_r = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(a_r, b0, c10); c11 = _mm256_fmadd_pd(a_r, b1, c11);
+              a_r = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(a_r, b0, c20); c21 = _mm256_fmadd_pd(a_r, b1, c21);
+              a_r = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(a_r, b0, c30); c31 = _mm256_fmadd_pd(a_r, b1, c31);
+              a_r = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(a_r, b0, c40); c41 = _mm256_fmadd_pd(a_r, b1, c41);
+              a_r = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(a_r, b0, c50); c51 = _mm256_fmadd_pd(a_r, b1, c51);
+              a += 6;
+              b += 8;
+            }
+
+            _mm256_storeu_pd(ab +  0, c00); _mm256_storeu_pd(ab +  4, c01);
+            _mm256_storeu_pd(ab +  8, c10); _mm256_storeu_pd(ab + 12, c11);
+            _mm256_storeu_pd(ab + 16, c20); _mm256_storeu_pd(ab + 20, c21);
+            _mm256_storeu_pd(ab + 24, c30); _mm256_storeu_pd(ab + 28, c31);
+            _mm256_storeu_pd(ab + 32, c40); _mm256_storeu_pd(ab + 36, c41);
+            _mm256_storeu_pd(ab + 40, c50); _mm256_storeu_pd(ab + 44, c51);
+          }
+        };
+
+        template <>
+        struct gemm_micro_kernel<float>
+        {
+          static void apply(std::size_t kc, float const * a, float const * b, float * ab)
+          {
+            __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps(), c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+            __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps(), c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+            __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps(), c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+              __m256 b0 = _mm256_loadu_ps(b);
+              __m256 b1 = _mm256_loadu_ps(b + 8);
+              __m256 a_r;
+              a_r = _mm256_broadcast_ss(a + 0); c00 = _mm256_fmadd_ps(a_r, b0, c00); c01 = _mm256_fmadd_ps(a_r, b1, c01);
+              a_r = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(a_r, b0, c10); c11 = _mm256_fmadd_ps(a_r, b1, c11);
+              a_r = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(a_r, b0, c20); c21 = _mm256_fmadd_ps(a_r, b1, c21);
+              a_r = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(a_r, b0, c30); c31 = _mm256_fmadd_ps(a_r, b1, c31);
+              a_r = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(a_r, b0, c40); c41 = _mm256_fmadd_ps(a_r, b1, c41);
+              a_r = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(a_r, b0, c50); c51 = _mm256_fmadd_ps(a_r, b1, c51);
+              a += 6;
+              b += 16;
+            }
+
+            _mm256_storeu_ps(ab +  0, c00); _mm256_storeu_ps(ab +  8, c01);
+            _mm256_storeu_ps(ab + 16, c10); _mm256_storeu_ps(ab + 24, c11);
+            _mm256_storeu_ps(ab + 32, c20); _mm256_storeu_ps(ab + 40, c21);
+            _mm256_storeu_ps(ab + 48, c30); _mm256_storeu_ps(ab + 56, c31);
+            _mm256_storeu_ps(ab + 64, c40); _mm256_storeu_ps(ab + 72, c41);
+            _mm256_storeu_ps(ab + 80, c50); _mm256_storeu_ps(ab + 88, c51);
+          }
+        };
+
+#elif defined VIENNACL_WITH_SSE2
+        template <>
+        struct gemm_micro_kernel<double>
+        {
+          static void apply(std::size_t kc, double const * a, double const * b, double * ab)
+          {
+            __m128d c00 = _mm_setzero_pd(), c01 = _mm_setzero_pd(), c10 = _mm_setzero_pd(), c11 = _mm_setzero_pd();
+            __m128d c20 = _mm_setzero_pd(), c21 = _mm_setzero_pd(), c30 = _mm_setzero_pd(), c31 = _mm_setzero_pd();
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+              __m128d b0 = _mm_loadu_pd(b);
+              __m128d b1 = _mm_loadu_pd(b + 2);
+              __m128d a_r;
+              a_r = _mm_set1_pd(a[0]); c00 = _mm_add_pd(c00, _mm_mul_pd(a_r, b0)); c01 = _mm_add_pd(c01, _mm_mul_pd(a_r, b1));
+              a_r = _mm_set1_pd(a[1]); c10 = _mm_add_pd(c10, _mm_mul_pd(a_r, b0)); c11 = _mm_add_pd(c11, _mm_mul_pd(a_r, b1));
+              a_r = _mm_set1_pd(a[2]); c20 = _mm_add_pd(c20, _mm_mul_pd(a_r, b0)); c21 = _mm_add_pd(c21, _mm_mul_pd(a_r, b1));
+              a_r = _mm_set1_pd(a[3]); c30 = _mm_add_pd(c30, _mm_mul_pd(a_r, b0)); c31 = _mm_add_pd(c31, _mm_mul_pd(a_r, b1));
+              a += 4;
+              b += 4;
+            }
+
+            _mm_storeu_pd(ab +  0, c00); _mm_storeu_pd(ab +  2, c01);
+            _mm_storeu_pd(ab +  4, c10); _mm_storeu_pd(ab +  6, c11);
+            _mm_storeu_pd(ab +  8, c20); _mm_storeu_pd(ab + 10, c21);
+            _mm_storeu_pd(ab + 12, c30); _mm_storeu_pd(ab + 14, c31);
+          }
+        };
+
+        template <>
+        struct gemm_micro_kernel<float>
+        {
+          static void apply(std::size_t kc, float const * a, float const * b, float * ab)
+          {
+            __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps(), c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+            __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps(), c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+
+            for (std::size_t k = 0; k < kc; ++k)
+            {
+              __m128 b0 = _mm_loadu_ps(b);
+              __m128 b1 = _mm_loadu_ps(b + 4);
+              __m128 a_r;
+              a_r = _mm_set1_ps(a[0]); c00 = _mm_add_ps(c00, _mm_mul_ps(a_r, b0)); c01 = _mm_add_ps(c01, _mm_mul_ps(a_r, b1));
+              a_r = _mm_set1_ps(a[1]); c10 = _mm_add_ps(c10, _mm_mul_ps(a_r, b0)); c11 = _mm_add_ps(c11, _mm_mul_ps(a_r, b1));
+              a_r = _mm_set1_ps(a[2]); c20 = _mm_add_ps(c20, _mm_mul_ps(a_r, b0)); c21 = _mm_add_ps(c21, _mm_mul_ps(a_r, b1));
+              a_r = _mm_set1_ps(a[3]); c30 = _mm_add_ps(c30, _mm_mul_ps(a_r, b0)); c31 = _mm_add_ps(c31, _mm_mul_ps(a_r, b1));
+              a += 4;
+              b += 8;
+            }
+
+            _mm_storeu_ps(ab +  0, c00); _mm_storeu_ps(ab +  4, c01);
+            _mm_storeu_ps(ab +  8, c10); _mm_storeu_ps(ab + 12, c11);
+            _mm_storeu_ps(ab + 16, c20); _mm_storeu_ps(ab + 20, c21);
+            _mm_storeu_ps(ab + 24, c30); _mm_storeu_ps(ab + 28, c31);
+          }
+        };
+#endif
+
+
+        //
+        // Packing routines
+        //
+
+        /** @brief Packs the mc x kc block of A into micro-panels of MR rows. Each micro-panel stores MR consecutive entries per column, rows beyond mc are zero-padded. */
+        template <typename NumericT>
+        void gemm_pack_A(strided_matrix_view<NumericT const> const & A, NumericT * buffer)
+        {
+          static const std::size_t MR = gemm_blocking<NumericT>::MR;
+
+          for (std::size_t panel_start = 0; panel_start < A.size1; panel_start += MR)
+          {
+            std::size_t mr = std::min(MR, A.size1 - panel_start);
+            for (std::size_t k = 0; k < A.size2; ++k)
+            {
+              for (std::size_t r = 0; r < mr; ++r)
+                buffer[r] = A(panel_start + r, k);
+              for (std::size_t r = mr; r < MR; ++r)
+                buffer[r] = 0;
+              buffer += MR;
+            }
+          }
+        }
+
+        /** @brief Packs columns [panel_begin*NR, panel_end*NR) of the kc x nc block of B into micro-panels of NR columns. Each micro-panel stores NR consecutive entries per row, columns beyond nc are zero-padded. */
+        template <typename NumericT>
+        void gemm_pack_B(strided_matrix_view<NumericT const> const & B, NumericT * buffer, std::size_t panel_begin, std::size_t panel_end)
+        {
+          static const std::size_t NR = gemm_blocking<NumericT>::NR;
+
+          for (std::size_t panel = panel_begin; panel < panel_end; ++panel)
+          {
+            std::size_t panel_start = panel * NR;
+            std::size_t nr = std::min(NR, B.size2 - panel_start);
+            NumericT * panel_buffer = buffer + panel * NR * B.size1;
+            for (std::size_t k = 0; k < B.size1; ++k)
+            {
+              for (std::size_t c = 0; c < nr; ++c)
+                panel_buffer[c] = B(k, panel_start + c);
+              for (std::size_t c = nr; c < NR; ++c)
+                panel_buffer[c] = 0;
+              panel_buffer += NR;
+            }
+          }
+        }
+
+        /** @brief Runs the micro-kernel over all micro-panels of a packed mc x kc block of A and a packed kc x nc block of B and accumulates alpha * A * B into C */
+        template <typename NumericT>
+        void gemm_macro_kernel(std::size_t kc,
+                               NumericT const * packed_A,
+                               NumericT const * packed_B,
+                               strided_matrix_view<NumericT> const & C,
+                               NumericT alpha)
+        {
+          static const std::size_t MR = gemm_blocking<NumericT>::MR;
+          static const std::size_t NR = gemm_blocking<NumericT>::NR;
+
+          NumericT ab[MR * NR];
+
+          for (std::size_t j = 0; j < C.size2; j += NR)
+          {
+            std::size_t nr = std::min(NR, C.size2 - j);
+            NumericT const * b = packed_B + (j / NR) * NR * kc;
+
+            for (std::size_t i = 0; i < C.size1; i += MR)
+            {
+              std::size_t mr = std::min(MR, C.size1 - i);
+              NumericT const * a = packed_A + (i / MR) * MR * kc;
+
+              gemm_micro_kernel<NumericT>::apply(kc, a, b, ab);
+
+              if (C.col_inc == 1)
+              {
+                for (std::size_t r = 0; r < mr; ++r)
+                {
+                  NumericT * c = &C(i + r, j);
+                  for (std::size_t s = 0; s < nr; ++s)
+                    c[s] += alpha * ab[r * NR + s];
+                }
+              }
+              else
+              {
+                for (std::size_t s = 0; s < nr; ++s)
+                  for (std::size_t r = 0; r < mr; ++r)
+                    C(i + r, j + s) += alpha * ab[r * NR + s];
+              }
+            }
+          }
+        }
+
+        /** @brief Scales C by beta. For beta == 0 the entries of C are overwritten with zeros, so that uninitialized memory (including NaNs) does not propagate. */
+        template <typename NumericT>
+        void gemm_scale_C(strided_matrix_view<NumericT> const & C, NumericT beta)
+        {
+          if (beta == NumericT(1))
+            return;
+
+          // run along the contiguous direction in the inner loop:
+          strided_matrix_view<NumericT> C2 = (C.row_inc < C.col_inc) ? C.trans() : C;
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for if (C2.size1 * C2.size2 > 10000)
+#endif
+          for (long i = 0; i < static_cast<long>(C2.size1); ++i)
+          {
+            NumericT * c = C2.data + static_cast<std::size_t>(i) * C2.row_inc;
+            if (beta == 0)
+              for (std::size_t j = 0; j < C2.size2; ++j)
+                c[j * C2.col_inc] = 0;
+            else
+              for (std::size_t j = 0; j < C2.size2; ++j)
+                c[j * C2.col_inc] *= beta;
+          }
+        }
+
+
+        /** @brief Computes C = alpha * A * B + beta * C for strided views of A, B, and C. The result must not alias A or B.
+        *
+        * Loop structure: For each block of NC columns of C and each block of KC entries in the summation index, the KC x NC block of B is packed once
+        * (shared among all threads). Each thread then packs MC x KC blocks of A into a private buffer and updates the respective MC x NC macro-tile of C.
+        */
+        template <typename NumericT>
+        void gemm(strided_matrix_view<NumericT const> const & A,
+                  strided_matrix_view<NumericT const> const & B,
+                  strided_matrix_view<NumericT> const & C,
+                  NumericT alpha, NumericT beta)
+        {
+          static const std::size_t MR = gemm_blocking<NumericT>::MR;
+          static const std::size_t NR = gemm_blocking<NumericT>::NR;
+          static const std::size_t KC = gemm_blocking<NumericT>::KC;
+          static const std::size_t NC = gemm_blocking<NumericT>::NC;
+
+          std::size_t M = C.size1;
+          std::size_t N = C.size2;
+          std::size_t K = A.size2;
+
+          if (M == 0 || N == 0)
+            return;
+
+          gemm_scale_C(C, beta);
+
+          if (K == 0 || alpha == NumericT(0))
+            return;
+
+          // Reduce the row block size if there are too few macro-tiles for all threads:
+          std::size_t MC = gemm_blocking<NumericT>::MC;
+#ifdef VIENNACL_WITH_OPENMP
+          std::size_t num_threads = static_cast<std::size_t>(omp_get_max_threads());
+          if ((M - 1) / MC + 1 < num_threads)
+            MC = std::max<std::size_t>(MR, ((M - 1) / (num_threads * MR) + 1) * MR);
+#endif
+          std::size_t num_blocks_M = (M - 1) / MC + 1;
+
+          std::vector<NumericT> buffer_B(std::min(KC, K) * ((std::min(NC, N) - 1) / NR + 1) * NR);
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel if (M * N * K > 32 * 32 * 32)
+#endif
+          {
+            std::vector<NumericT> buffer_A(std::min(KC, K) * ((std::min(MC, M) - 1) / MR + 1) * MR);
+
+            for (std::size_t jc = 0; jc < N; jc += NC)
+            {
+              std::size_t nc = std::min(NC, N - jc);
+              long num_panels_B = static_cast<long>((nc - 1) / NR + 1);
+
+              for (std::size_t pc = 0; pc < K; pc += KC)
+              {
+                std::size_t kc = std::min(KC, K - pc);
+
+                strided_matrix_view<NumericT const> B_block = B.sub(pc, jc, kc, nc);
+#ifdef VIENNACL_WITH_OPENMP
+                #pragma omp for
+#endif
+                for (long panel = 0; panel < num_panels_B; ++panel)
+                  gemm_pack_B(B_block, &(buffer_B[0]), static_cast<std::size_t>(panel), static_cast<std::size_t>(panel) + 1);
+                // implicit barrier: packed B is complete
+
+#ifdef VIENNACL_WITH_OPENMP
+                #pragma omp for
+#endif
+                for (long block_M = 0; block_M < static_cast<long>(num_blocks_M); ++block_M)
+                {
+                  std::size_t ic = static_cast<std::size_t>(block_M) * MC;
+                  std::size_t mc = std::min(MC, M - ic);
+
+                  gemm_pack_A(A.sub(ic, pc, mc, kc), &(buffer_A[0]));
+                  gemm_macro_kernel(kc, &(buffer_A[0]), &(buffer_B[0]), C.sub(ic, jc, mc, nc), alpha);
+                }
+                // implicit barrier: packed B is no longer in use
+              }
+            }
+          }
+        }
+
+        /** @brief Returns the inner product of a strided row of a matrix with a strided vector. Unit strides use an unrolled loop with independent partial sums. */
+        template <typename NumericT>
+        NumericT gemv_dot(std::size_t n, NumericT const * a, std::size_t inc_a, NumericT const * x, std::size_t inc_x)
+        {
+          if (inc_a == 1 && inc_x == 1)
+          {
+            NumericT temp0 = 0, temp1 = 0, temp2 = 0, temp3 = 0;
+            std::size_t j = 0;
+            for (; j + 4 <= n; j += 4)
+            {
+              temp0 += a[j    ] * x[j    ];
+              temp1 += a[j + 1] * x[j + 1];
+              temp2 += a[j + 2] * x[j + 2];
+              temp3 += a[j + 3] * x[j + 3];
+            }
+            for (; j < n; ++j)
+              temp0 += a[j] * x[j];
+            return (temp0 + temp1) + (temp2 + temp3);
+          }
+
+          NumericT temp = 0;
+          for (std::size_t j = 0; j < n; ++j)
+            temp += a[j * inc_a] * x[j * inc_x];
+          return temp;
+        }
+
+        /** @brief Computes y[0:num_rows] = alpha * A(:, col_begin:col_end) * x(col_begin:col_end) + beta * y[0:num_rows] by sweeping over the columns of A (axpy formulation).
+        *
+        * Four columns are processed at once, so that each entry of y is loaded and stored only once per four columns. y is not read if beta is zero.
+        */
+        template <typename NumericT>
+        void gemv_axpy(strided_matrix_view<NumericT const> const & A,
+                       std::size_t col_begin, std::size_t col_end,
+                       NumericT const * x, std::size_t inc_x,
+                       NumericT * y, std::size_t inc_y,
+                       NumericT alpha, NumericT beta)
+        {
+          for (std::size_t i = 0; i < A.size1; ++i)
+            y[i * inc_y] = (beta == 0) ? NumericT(0) : beta * y[i * inc_y];
+
+          if (A.row_inc == 1 && inc_y == 1)
+          {
+            std::size_t j = col_begin;
+            for (; j + 4 <= col_end; j += 4)
+            {
+              NumericT const * a0 = A.data + j * A.col_inc;
+              NumericT const * a1 = a0 + A.col_inc;
+              NumericT const * a2 = a1 + A.col_inc;
+              NumericT const * a3 = a2 + A.col_inc;
+              NumericT x0 = alpha * x[ j      * inc_x];
+              NumericT x1 = alpha * x[(j + 1) * inc_x];
+              NumericT x2 = alpha * x[(j + 2) * inc_x];
+              NumericT x3 = alpha * x[(j + 3) * inc_x];
+              for (std::size_t i = 0; i < A.size1; ++i)
+                y[i] += a0[i] * x0 + a1[i] * x1 + a2[i] * x2 + a3[i] * x3;
+            }
+            for (; j < col_end; ++j)
+            {
+              NumericT const * a0 = A.data + j * A.col_inc;
+              NumericT x0 = alpha * x[j * inc_x];
+              for (std::size_t i = 0; i < A.size1; ++i)
+                y[i] += a0[i] * x0;
+            }
+          }
+          else
+          {
+            for (std::size_t j = col_begin; j < col_end; ++j)
+            {
+              NumericT x_j = alpha * x[j * inc_x];
+              for (std::size_t i = 0; i < A.size1; ++i)
+                y[i * inc_y] += A(i, j) * x_j;
+            }
+          }
+        }
+
+        /** @brief Computes y = alpha * A * x + beta * y for a strided view of A. Used for A * x as well as for trans(A) * x with both storage layouts. y must not alias A or x, and is not read if beta is zero.
+        *
+        * If the entries of a row are contiguous, each row is reduced with an inner product (parallel over rows).
+        * Otherwise, the columns of A are swept in axpy fashion. Depending on the shape of A, the work is either split into blocks of rows,
+        * or (for short and wide matrices) into blocks of columns with per-thread partial results which are summed up at the end.
+        */
+        template <typename NumericT>
+        void gemv(strided_matrix_view<NumericT const> const & A,
+                  NumericT const * x, std::size_t inc_x,
+                  NumericT * y, std::size_t inc_y,
+                  NumericT alpha = NumericT(1), NumericT beta = NumericT(0))
+        {
+          static const std::size_t row_block_size = 256;
+
+          long size1 = static_cast<long>(A.size1);
+
+          if (A.size1 == 0)
+            return;
+
+          if (A.col_inc == 1 || A.row_inc != 1)
+          {
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for if (A.size1 * A.size2 > 5000)
+#endif
+            for (long row = 0; row < size1; ++row)
+            {
+              NumericT value = alpha * gemv_dot(A.size2, A.data + static_cast<std::size_t>(row) * A.row_inc, A.col_inc, x, inc_x);
+              NumericT & y_row = y[static_cast<std::size_t>(row) * inc_y];
+              y_row = (beta == 0) ? value : value + beta * y_row;
+            }
+            return;
+          }
+
+          std::size_t num_threads = 1;
+#ifdef VIENNACL_WITH_OPENMP
+          if (A.size1 * A.size2 > 5000)
+            num_threads = static_cast<std::size_t>(omp_get_max_threads());
+#endif
+
+          if (num_threads > 1 && A.size1 < num_threads * row_block_size && A.size2 > A.size1)
+          {
+            // short and wide matrix: column blocks with per-thread partial results:
+            std::vector<NumericT> partial_results(num_threads * A.size1);
+            std::size_t cols_per_thread = (A.size2 - 1) / num_threads + 1;
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for
+#endif
+            for (long tid = 0; tid < static_cast<long>(num_threads); ++tid)
+            {
+              std::size_t col_begin = std::min(A.size2, static_cast<std::size_t>(tid) * cols_per_thread);
+              std::size_t col_end   = std::min(A.size2, col_begin + cols_per_thread);
+              gemv_axpy(A, col_begin, col_end, x, inc_x, &(partial_results[static_cast<std::size_t>(tid) * A.size1]), std::size_t(1), alpha, NumericT(0));
+            }
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for
+#endif
+            for (long row = 0; row < size1; ++row)
+            {
+              NumericT temp = 0;
+              for (std::size_t tid = 0; tid < num_threads; ++tid)
+                temp += partial_results[tid * A.size1 + static_cast<std::size_t>(row)];
+              NumericT & y_row = y[static_cast<std::size_t>(row) * inc_y];
+              y_row = (beta == 0) ? temp : temp + beta * y_row;
+            }
+          }
+          else
+          {
+            // blocks of rows, each block of y stays in cache while the columns are swept:
+            long num_blocks = static_cast<long>((A.size1 - 1) / row_block_size + 1);
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for if (num_threads > 1)
+#endif
+            for (long block = 0; block < num_blocks; ++block)
+            {
+              std::size_t row_begin = static_cast<std::size_t>(block) * row_block_size;
+              std::size_t rows      = std::min(row_block_size, A.size1 - row_begin);
+              gemv_axpy(A.sub(row_begin, 0, rows, A.size2), 0, A.size2, x, inc_x, y + row_begin * inc_y, inc_y, alpha, beta);
+            }
+          }
+        }
+
+        /** @brief Computes y = alpha * A * x + beta * y for strided views, where x and y are views with a single column. y must not alias A or x. */
+        template <typename NumericT>
+        void gemv(strided_matrix_view<NumericT const> const & A,
+                  strided_matrix_view<NumericT const> const & x,
+                  strided_matrix_view<NumericT> const & y,
+                  NumericT alpha, NumericT beta)
+        {
+          gemv(A, x.data, x.row_inc, y.data, y.row_inc, alpha, beta);
+        }
+
+      } //namespace detail
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
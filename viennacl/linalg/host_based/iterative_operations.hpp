@@ -0,0 +1,329 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_ITERATIVE_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_ITERATIVE_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/iterative_operations.hpp
+    @brief Implementations of fused (pipelined) operations for iterative solvers on the CPU using a single thread or OpenMP.
+*/
+
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/vector_operations.hpp"
+#include "viennacl/linalg/host_based/sparse_matrix_operations.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+
+      //
+      // Introductory note: By convention, all dimensions are already checked in the dispatcher frontend. No need to double-check again in here!
+      //
+
+      /** @brief Performs the vector updates of a pipelined conjugate gradient iteration in a single pass and returns the new residual norm squared.
+      *
+      * Computes
+      *   result += alpha * p;
+      *   r      -= alpha * Ap;
+      *   p       = r + beta * p;
+      * and returns <r, r> for the updated residual r.
+      */
+      template <typename T>
+      T pipelined_cg_vector_update(vector_base<T> & result,
+                                   T alpha,
+                                   vector_base<T> & p,
+                                   vector_base<T> & r,
+                                   vector_base<T> const & Ap,
+                                   T beta)
+      {
+        typedef T        value_type;
+
+        value_type       * data_result = detail::extract_raw_pointer<value_type>(result);
+        value_type       * data_p      = detail::extract_raw_pointer<value_type>(p);
+        value_type       * data_r      = detail::extract_raw_pointer<value_type>(r);
+        value_type const * data_Ap     = detail::extract_raw_pointer<value_type>(Ap);
+
+        std::size_t start_result = viennacl::traits::start(result);
+        std::size_t inc_result   = viennacl::traits::stride(result);
+        std::size_t size         = viennacl::traits::size(result);
+
+        std::size_t start_p  = viennacl::traits::start(p);
+        std::size_t inc_p    = viennacl::traits::stride(p);
+        std::size_t start_r  = viennacl::traits::start(r);
+        std::size_t inc_r    = viennacl::traits::stride(r);
+        std::size_t start_Ap = viennacl::traits::start(Ap);
+        std::size_t inc_Ap   = viennacl::traits::stride(Ap);
+
+        value_type inner_prod_r = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for reduction(+: inner_prod_r) if (size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+        for (long i = 0; i < static_cast<long>(size); ++i)
+        {
+          std::size_t index = static_cast<std::size_t>(i);
+          value_type value_p = data_p[index*inc_p+start_p];
+          value_type value_r = data_r[index*inc_r+start_r] - alpha * data_Ap[index*inc_Ap+start_Ap];
+
+          data_result[index*inc_result+start_result] += alpha * value_p;
+          data_r[index*inc_r+start_r] = value_r;
+          data_p[index*inc_p+start_p] = value_r + beta * value_p;
+
+          inner_prod_r += value_r * value_r;
+        }
+
+        return inner_prod_r;
+      }
+
+
+      namespace detail
+      {
+        /** @brief Returns row 'row' of the CSR matrix times the vector x with entries x[0], x[inc_x], x[2*inc_x], ... */
+        template <typename T>
+        T csr_row_dot_strided(std::size_t row, T const * elements, unsigned int const * row_buffer, unsigned int const * col_buffer,
+                              T const * x, std::size_t inc_x)
+        {
+          if (inc_x == 1)
+            return csr_row_dot<T>(row_buffer[row], row_buffer[row+1], elements, col_buffer, x);
+
+          T sum = 0;
+          for (std::size_t k = row_buffer[row]; k < row_buffer[row+1]; ++k)
+            sum += elements[k] * x[col_buffer[k] * inc_x];
+          return sum;
+        }
+      }
+
+      /** @brief Computes Ap = prod(A, p) for a compressed_matrix and the inner products <Ap, Ap> and <p, Ap> in the same pass.
+      *
+      * Rows are distributed statically among the threads, since the reductions rule out the carry-outs of the merge-path kernel.
+      */
+      template <typename T, unsigned int ALIGNMENT>
+      void pipelined_cg_prod(compressed_matrix<T, ALIGNMENT> const & A,
+                             vector_base<T> const & p,
+                             vector_base<T> & Ap,
+                             T & inner_prod_ApAp,
+                             T & inner_prod_pAp)
+      {
+        typedef T        value_type;
+
+        value_type         * data_Ap    = detail::extract_raw_pointer<value_type>(Ap.handle()) + viennacl::traits::start(Ap);
+        value_type   const * data_p     = detail::extract_raw_pointer<value_type>(p.handle())  + viennacl::traits::start(p);
+        std::size_t          inc_Ap     = viennacl::traits::stride(Ap);
+        std::size_t          inc_p      = viennacl::traits::stride(p);
+        value_type   const * elements   = detail::extract_raw_pointer<value_type>(A.handle());
+        unsigned int const * row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+        unsigned int const * col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+
+        value_type ApAp = 0;
+        value_type pAp  = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for reduction(+: ApAp, pAp) if (A.size1() + A.nnz() > 10000)
+#endif
+        for (long row = 0; row < static_cast<long>(A.size1()); ++row)
+        {
+          value_type value_Ap = detail::csr_row_dot_strided<value_type>(static_cast<std::size_t>(row), elements, row_buffer, col_buffer, data_p, inc_p);
+          data_Ap[row * inc_Ap] = value_Ap;
+
+          ApAp += value_Ap * value_Ap;
+          pAp  += data_p[row * inc_p] * value_Ap;
+        }
+
+        inner_prod_ApAp = ApAp;
+        inner_prod_pAp  = pAp;
+      }
+
+
+      /** @brief Computes Ap = prod(A, p) for a compressed_matrix and the inner products <Ap, Ap>, <p, Ap> and <Ap, r0star> in the same pass.
+      *
+      * Used for both matrix-vector products of a pipelined BiCGStab iteration.
+      */
+      template <typename T, unsigned int ALIGNMENT>
+      void pipelined_bicgstab_prod(compressed_matrix<T, ALIGNMENT> const & A,
+                                   vector_base<T> const & p,
+                                   vector_base<T> & Ap,
+                                   vector_base<T> const & r0star,
+                                   T & inner_prod_ApAp,
+                                   T & inner_prod_pAp,
+                                   T & inner_prod_Ap_r0star)
+      {
+        typedef T        value_type;
+
+        value_type         * data_Ap     = detail::extract_raw_pointer<value_type>(Ap.handle())     + viennacl::traits::start(Ap);
+        value_type   const * data_p      = detail::extract_raw_pointer<value_type>(p.handle())      + viennacl::traits::start(p);
+        value_type   const * data_r0star = detail::extract_raw_pointer<value_type>(r0star.handle()) + viennacl::traits::start(r0star);
+        std::size_t          inc_Ap      = viennacl::traits::stride(Ap);
+        std::size_t          inc_p       = viennacl::traits::stride(p);
+        std::size_t          inc_r0star  = viennacl::traits::stride(r0star);
+        value_type   const * elements    = detail::extract_raw_pointer<value_type>(A.handle());
+        unsigned int const * row_buffer  = detail::extract_raw_pointer<unsigned int>(A.handle1());
+        unsigned int const * col_buffer  = detail::extract_raw_pointer<unsigned int>(A.handle2());
+
+        value_type ApAp      = 0;
+        value_type pAp       = 0;
+        value_type Ap_r0star = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for reduction(+: ApAp, pAp, Ap_r0star) if (A.size1() + A.nnz() > 10000)
+#endif
+        for (long row = 0; row < static_cast<long>(A.size1()); ++row)
+        {
+          value_type value_Ap = detail::csr_row_dot_strided<value_type>(static_cast<std::size_t>(row), elements, row_buffer, col_buffer, data_p, inc_p);
+          data_Ap[row * inc_Ap] = value_Ap;
+
+          ApAp      += value_Ap * value_Ap;
+          pAp       += data_p[row * inc_p] * value_Ap;
+          Ap_r0star += value_Ap * data_r0star[row * inc_r0star];
+        }
+
+        inner_prod_ApAp      = ApAp;
+        inner_prod_pAp       = pAp;
+        inner_prod_Ap_r0star = Ap_r0star;
+      }
+
+
+      /** @brief Computes s = r - alpha * Ap of a pipelined BiCGStab iteration together with the inner products <s, s> and <s, r0star>. */
+      template <typename T>
+      void pipelined_bicgstab_update_s(vector_base<T> & s,
+                                       vector_base<T> const & r,
+                                       T alpha,
+                                       vector_base<T> const & Ap,
+                                       vector_base<T> const & r0star,
+                                       T & inner_prod_ss,
+                                       T & inner_prod_s_r0star)
+      {
+        typedef T        value_type;
+
+        value_type       * data_s      = detail::extract_raw_pointer<value_type>(s);
+        value_type const * data_r      = detail::extract_raw_pointer<value_type>(r);
+        value_type const * data_Ap     = detail::extract_raw_pointer<value_type>(Ap);
+        value_type const * data_r0star = detail::extract_raw_pointer<value_type>(r0star);
+
+        std::size_t start_s      = viennacl::traits::start(s);
+        std::size_t inc_s        = viennacl::traits::stride(s);
+        std::size_t size         = viennacl::traits::size(s);
+        std::size_t start_r      = viennacl::traits::start(r);
+        std::size_t inc_r        = viennacl::traits::stride(r);
+        std::size_t start_Ap     = viennacl::traits::start(Ap);
+        std::size_t inc_Ap       = viennacl::traits::stride(Ap);
+        std::size_t start_r0star = viennacl::traits::start(r0star);
+        std::size_t inc_r0star   = viennacl::traits::stride(r0star);
+
+        value_type ss       = 0;
+        value_type s_r0star = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for reduction(+: ss, s_r0star) if (size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+        for (long i = 0; i < static_cast<long>(size); ++i)
+        {
+          std::size_t index = static_cast<std::size_t>(i);
+          value_type value_s = data_r[index*inc_r+start_r] - alpha * data_Ap[index*inc_Ap+start_Ap];
+          data_s[index*inc_s+start_s] = value_s;
+
+          ss       += value_s * value_s;
+          s_r0star += value_s * data_r0star[index*inc_r0star+start_r0star];
+        }
+
+        inner_prod_ss       = ss;
+        inner_prod_s_r0star = s_r0star;
+      }
+
+
+      /** @brief Performs the vector updates at the end of a pipelined BiCGStab iteration in a single pass and returns the new residual norm squared.
+      *
+      * Computes
+      *   result += alpha * p + omega * s;
+      *   r       = s - omega * As;
+      *   p       = r + beta * (p - omega * Ap);
+      * Returns <r, r> for the updated residual r and stores <r, r0star> in inner_prod_r_r0star.
+      */
+      template <typename T>
+      T pipelined_bicgstab_vector_update(vector_base<T> & result,
+                                         T alpha, vector_base<T> & p,
+                                         T omega, vector_base<T> const & s,
+                                         vector_base<T> & r, vector_base<T> const & As,
+                                         T beta,  vector_base<T> const & Ap,
+                                       vector_base<T> const & r0star,
+                                       T & inner_prod_r_r0star)
+      {
+        typedef T        value_type;
+
+        value_type       * data_result = detail::extract_raw_pointer<value_type>(result);
+        value_type       * data_p      = detail::extract_raw_pointer<value_type>(p);
+        value_type const * data_s      = detail::extract_raw_pointer<value_type>(s);
+        value_type       * data_r      = detail::extract_raw_pointer<value_type>(r);
+        value_type const * data_As     = detail::extract_raw_pointer<value_type>(As);
+        value_type const * data_Ap     = detail::extract_raw_pointer<value_type>(Ap);
+        value_type const * data_r0star = detail::extract_raw_pointer<value_type>(r0star);
+
+        std::size_t start_result = viennacl::traits::start(result);
+        std::size_t inc_result   = viennacl::traits::stride(result);
+        std::size_t size         = viennacl::traits::size(result);
+        std::size_t start_p      = viennacl::traits::start(p);
+        std::size_t inc_p        = viennacl::traits::stride(p);
+        std::size_t start_s      = viennacl::traits::start(s);
+        std::size_t inc_s        = viennacl::traits::stride(s);
+        std::size_t start_r      = viennacl::traits::start(r);
+        std::size_t inc_r        = viennacl::traits::stride(r);
+        std::size_t start_As     = viennacl::traits::start(As);
+        std::size_t inc_As       = viennacl::traits::stride(As);
+        std::size_t start_Ap     = viennacl::traits::start(Ap);
+        std::size_t inc_Ap       = viennacl::traits::stride(Ap);
+        std::size_t start_r0star = viennacl::traits::start(r0star);
+        std::size_t inc_r0star   = viennacl::traits::stride(r0star);
+
+        value_type inner_prod_r = 0;
+        value_type r_r0star     = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for reduction(+: inner_prod_r, r_r0star) if (size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+        for (long i = 0; i < static_cast<long>(size); ++i)
+        {
+          std::size_t index = static_cast<std::size_t>(i);
+          value_type value_p = data_p[index*inc_p+start_p];
+          value_type value_s = data_s[index*inc_s+start_s];
+          value_type value_r = value_s - omega * data_As[index*inc_As+start_As];
+
+          data_result[index*inc_result+start_result] += alpha * value_p + omega * value_s;
+          data_r[index*inc_r+start_r] = value_r;
+          data_p[index*inc_p+start_p] = value_r + beta * (value_p - omega * data_Ap[index*inc_Ap+start_Ap]);
+
+          inner_prod_r += value_r * value_r;
+          r_r0star     += value_r * data_r0star[index*inc_r0star+start_r0star];
+        }
+
+        inner_prod_r_r0star = r_r0star;
+        return inner_prod_r;
+      }
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -0,0 +1,286 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_LU_HPP
+#define VIENNACL_LINALG_HOST_BASED_LU_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/lu.hpp
+    @brief Implementation of a blocked LU factorization with partial pivoting for dense matrices in host memory.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "viennacl/forwards.h"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
+#include "viennacl/linalg/host_based/direct_solve.hpp"
+
+/** @brief Width of the block columns of the tiled LU factorization. Each block column is one task in the dependency graph. */
+#ifndef VIENNACL_LU_BLOCK_SIZE
+  #define VIENNACL_LU_BLOCK_SIZE 128
+#endif
+
+/** @brief Panels of at most this width are factored by the unblocked kernel, wider panels are split recursively. */
+#ifndef VIENNACL_LU_PANEL_MIN_WIDTH
+  #define VIENNACL_LU_PANEL_MIN_WIDTH 16
+#endif
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief Applies the row interchanges ipiv[0], ..., ipiv[num_pivots-1] (relative to the first row of A) to A */
+        template <typename NumericT>
+        void lu_apply_row_swaps(strided_matrix_view<NumericT> const & A, std::size_t const * ipiv, std::size_t num_pivots)
+        {
+          for (std::size_t k = 0; k < num_pivots; ++k)
+          {
+            if (ipiv[k] != k)
+            {
+              for (std::size_t j = 0; j < A.size2; ++j)
+                std::swap(A(k, j), A(ipiv[k], j));
+            }
+          }
+        }
+
+        /** @brief Unblocked right-looking LU factorization of a tall panel. Pivoting is skipped if ipiv is NULL. */
+        template <typename NumericT>
+        void lu_panel_unblocked(strided_matrix_view<NumericT> const & A, std::size_t * ipiv)
+        {
+          std::size_t m = A.size1;
+          std::size_t w = std::min(A.size1, A.size2);
+
+          for (std::size_t k = 0; k < w; ++k)
+          {
+            if (ipiv)
+            {
+              std::size_t pivot_row = k;
+              NumericT pivot_value = std::fabs(A(k, k));
+              for (std::size_t i = k + 1; i < m; ++i)
+              {
+                if (std::fabs(A(i, k)) > pivot_value)
+                {
+                  pivot_value = std::fabs(A(i, k));
+                  pivot_row = i;
+                }
+              }
+              ipiv[k] = pivot_row;
+              if (pivot_row != k)
+                for (std::size_t j = 0; j < A.size2; ++j)
+                  std::swap(A(k, j), A(pivot_row, j));
+            }
+
+            NumericT a_kk = A(k, k);
+            if (a_kk == NumericT(0))  // singular: leave the column untouched (as LAPACK does) and let the substitution report inf/nan
+              continue;
+
+            for (std::size_t i = k + 1; i < m; ++i)
+              A(i, k) /= a_kk;  // write l_ik
+
+            for (std::size_t i = k + 1; i < m; ++i)
+            {
+              NumericT l_ik = A(i, k);
+              for (std::size_t j = k + 1; j < A.size2; ++j)
+                A(i, j) -= l_ik * A(k, j);
+            }
+          }
+        }
+
+        /** @brief Recursive LU factorization of a tall panel: The left half is factored, the right half is updated with one triangular solve and one matrix-matrix product, then the lower right part is factored.
+        *
+        * Pivot indices are relative to the first row of the panel. Pivoting is skipped if ipiv is NULL.
+        */
+        template <typename NumericT>
+        void lu_panel_recursive(strided_matrix_view<NumericT> const & A, std::size_t * ipiv)
+        {
+          std::size_t m = A.size1;
+          std::size_t w = A.size2;
+
+          if (w <= VIENNACL_LU_PANEL_MIN_WIDTH)
+          {
+            lu_panel_unblocked(A, ipiv);
+            return;
+          }
+
+          std::size_t n1 = w / 2;
+          std::size_t n2 = w - n1;
+
+          lu_panel_recursive(A.sub(0, 0, m, n1), ipiv);
+
+          if (ipiv)
+            lu_apply_row_swaps(A.sub(0, n1, m, n2), ipiv, n1);
+
+          // U_12 = L_11^{-1} A_12, A_22 -= L_21 U_12:
+          trsm_left(const_view(A.sub(0, 0, n1, n1)), A.sub(0, n1, n1, n2), true, true);
+          gemm(const_view(A.sub(n1, 0, m - n1, n1)), const_view(A.sub(0, n1, n1, n2)), A.sub(n1, n1, m - n1, n2), NumericT(-1), NumericT(1));
+
+          lu_panel_recursive(A.sub(n1, n1, m - n1, n2), ipiv ? ipiv + n1 : NULL);
+
+          if (ipiv)
+          {
+            lu_apply_row_swaps(A.sub(n1, 0, m - n1, n1), ipiv + n1, n2);
+            for (std::size_t k = n1; k < w; ++k)
+              ipiv[k] += n1;
+          }
+        }
+
+        /** @brief Factors block column 'k' of the tiled LU factorization (rows k*block_size to the end) */
+        template <typename NumericT>
+        void lu_factor_block_column(strided_matrix_view<NumericT> const & A, std::size_t * ipiv, std::size_t k, std::size_t block_size)
+        {
+          std::size_t n  = A.size1;
+          std::size_t kb = k * block_size;
+          std::size_t wk = std::min(block_size, n - kb);
+
+          lu_panel_recursive(A.sub(kb, kb, n - kb, wk), ipiv ? ipiv + kb : NULL);
+        }
+
+        /** @brief Updates block column 'j' with the factored block column 'k' (k < j): row interchanges, triangular solve for U_kj, and update of the trailing rows */
+        template <typename NumericT>
+        void lu_update_block_column(strided_matrix_view<NumericT> const & A, std::size_t const * ipiv, std::size_t k, std::size_t j, std::size_t block_size)
+        {
+          std::size_t n  = A.size1;
+          std::size_t kb = k * block_size;
+          std::size_t jb = j * block_size;
+          std::size_t wk = std::min(block_size, n - kb);
+          std::size_t wj = std::min(block_size, n - jb);
+
+          if (ipiv)
+            lu_apply_row_swaps(A.sub(kb, jb, n - kb, wj), ipiv + kb, wk);
+
+          trsm_left(const_view(A.sub(kb, kb, wk, wk)), A.sub(kb, jb, wk, wj), true, true);
+          if (kb + wk < n)
+            gemm(const_view(A.sub(kb + wk, kb, n - kb - wk, wk)), const_view(A.sub(kb, jb, wk, wj)), A.sub(kb + wk, jb, n - kb - wk, wj), NumericT(-1), NumericT(1));
+        }
+
+        /** @brief In-place LU factorization P A = L U of a square matrix in host memory.
+        *
+        * The matrix is split into block columns of width VIENNACL_LU_BLOCK_SIZE. Factoring block column k and updating block column j with block column k
+        * are the tasks of a dependency graph, so that the factorization of block column k+1 overlaps with the remaining updates of step k (lookahead).
+        * Without OpenMP tasks, the same steps are carried out in order and the parallelism is only within the matrix-matrix products.
+        *
+        * @param A     View on the matrix. L (without its unit diagonal) and U are written to A.
+        * @param ipiv  Array of size A.size1. Row i was interchanged with row ipiv[i] in step i. If NULL, no pivoting is carried out.
+        */
+        template <typename NumericT>
+        void lu_factorize(strided_matrix_view<NumericT> const & A, std::size_t * ipiv)
+        {
+          std::size_t n = A.size1;
+          const std::size_t block_size = VIENNACL_LU_BLOCK_SIZE;
+
+          if (n == 0)
+            return;
+
+          std::size_t num_blocks = (n - 1) / block_size + 1;
+
+#if defined(VIENNACL_WITH_OPENMP) && (_OPENMP >= 201307)
+          std::vector<char> dependencies(num_blocks);
+          char * deps = &(dependencies[0]);
+
+          #pragma omp parallel if (num_blocks > 2)
+          {
+            #pragma omp single
+            {
+              for (std::size_t k = 0; k < num_blocks; ++k)
+              {
+                #pragma omp task depend(inout: deps[k])
+                lu_factor_block_column(A, ipiv, k, block_size);
+
+                for (std::size_t j = k + 1; j < num_blocks; ++j)
+                {
+                  #pragma omp task depend(in: deps[k]) depend(inout: deps[j])
+                  lu_update_block_column(A, ipiv, k, j, block_size);
+                }
+              }
+            }
+          } // implicit barrier: all tasks are complete
+#else
+          for (std::size_t k = 0; k < num_blocks; ++k)
+          {
+            lu_factor_block_column(A, ipiv, k, block_size);
+            for (std::size_t j = k + 1; j < num_blocks; ++j)
+              lu_update_block_column(A, ipiv, k, j, block_size);
+          }
+#endif
+
+          if (!ipiv)
+            return;
+
+          // Apply the row interchanges of each block column to the block columns left of it:
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for if (num_blocks > 2)
+#endif
+          for (long j = 0; j < static_cast<long>(num_blocks) - 1; ++j)
+          {
+            std::size_t jb = static_cast<std::size_t>(j) * block_size;
+            for (std::size_t kb = jb + block_size; kb < n; kb += block_size)
+              lu_apply_row_swaps(A.sub(kb, jb, n - kb, block_size), ipiv + kb, std::min(block_size, n - kb));
+          }
+
+          // Global row indices:
+          for (std::size_t kb = block_size; kb < n; kb += block_size)
+            for (std::size_t i = kb; i < std::min(kb + block_size, n); ++i)
+              ipiv[i] += kb;
+        }
+
+        /** @brief Converts the row interchanges ipiv into a permutation: Row i of P A is row permutation[i] of A. */
+        inline void lu_pivots_to_permutation(std::vector<std::size_t> const & ipiv, std::vector<std::size_t> & permutation)
+        {
+          permutation.resize(ipiv.size());
+          for (std::size_t i = 0; i < permutation.size(); ++i)
+            permutation[i] = i;
+          for (std::size_t i = 0; i < ipiv.size(); ++i)
+            std::swap(permutation[i], permutation[ipiv[i]]);
+        }
+
+        /** @brief Replaces row i of B by row permutation[i] of B */
+        template <typename NumericT>
+        void lu_permute_rows(strided_matrix_view<NumericT> const & B, std::vector<std::size_t> const & permutation)
+        {
+          std::vector<NumericT> temp(B.size1 * B.size2);
+          for (std::size_t i = 0; i < B.size1; ++i)
+            for (std::size_t j = 0; j < B.size2; ++j)
+              temp[i * B.size2 + j] = B(permutation[i], j);
+          for (std::size_t i = 0; i < B.size1; ++i)
+            for (std::size_t j = 0; j < B.size2; ++j)
+              B(i, j) = temp[i * B.size2 + j];
+        }
+
+        /** @brief Solves L U X = P B in place for an LU factorization computed by lu_factorize() */
+        template <typename NumericT>
+        void lu_substitute(strided_matrix_view<NumericT const> const & LU, std::vector<std::size_t> const * permutation, strided_matrix_view<NumericT> const & B)
+        {
+          if (permutation)
+            lu_permute_rows(B, *permutation);
+          trsm_left(LU, B, true,  true);
+          trsm_left(LU, B, false, false);
+        }
+
+      } //namespace detail
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
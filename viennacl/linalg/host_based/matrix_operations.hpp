@@ -35,6 +35,7 @@
 #include "viennacl/traits/handle.hpp"
 #include "viennacl/traits/stride.hpp"
 #include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
 
 namespace viennacl
 {
@@ -352,7 +353,7 @@ namespace viennacl
       //
 
       // A * x
-      
+
       /** @brief Carries out matrix-vector multiplication
       *
       * Implementation of the convenience expression result = prod(mat, vec);
@@ -368,53 +369,16 @@ namespace viennacl
       {
         typedef NumericT        value_type;
         
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(mat);
         value_type const * data_x = detail::extract_raw_pointer<value_type>(vec);
         value_type       * data_result = detail::extract_raw_pointer<value_type>(result);
         
-        std::size_t A_start1 = viennacl::traits::start1(mat);
-        std::size_t A_start2 = viennacl::traits::start2(mat);
-        std::size_t A_inc1   = viennacl::traits::stride1(mat);
-        std::size_t A_inc2   = viennacl::traits::stride2(mat);
-        std::size_t A_size1  = viennacl::traits::size1(mat);
-        std::size_t A_size2  = viennacl::traits::size2(mat);
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(mat);
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(mat);
-        
         std::size_t start1 = viennacl::traits::start(vec);
         std::size_t inc1   = viennacl::traits::stride(vec);
         
         std::size_t start2 = viennacl::traits::start(result);
         std::size_t inc2   = viennacl::traits::stride(result);
         
-        if (detail::is_row_major(typename F::orientation_category()))
-        {
-#ifdef VIENNACL_WITH_OPENMP
-          #pragma omp parallel for
-#endif
-          for (std::size_t row = 0; row < A_size1; ++row)
-          {
-            value_type temp = 0;
-            for (std::size_t col = 0; col < A_size2; ++col)
-              temp += data_A[viennacl::row_major::mem_index(row * A_inc1 + A_start1, col * A_inc2 + A_start2, A_internal_size1, A_internal_size2)] * data_x[col * inc1 + start1];
-              
-            data_result[row * inc2 + start2] = temp;
-          }
-        }
-        else
-        {
-          {
-            value_type temp = data_x[start1];
-            for (std::size_t row = 0; row < A_size1; ++row)
-              data_result[row * inc2 + start2] = data_A[viennacl::column_major::mem_index(row * A_inc1 + A_start1, A_start2, A_internal_size1, A_internal_size2)] * temp;
-          }
-          for (std::size_t col = 1; col < A_size2; ++col)  //run through matrix sequentially
-          {
-            value_type temp = data_x[col * inc1 + start1];
-            for (std::size_t row = 0; row < A_size1; ++row)
-              data_result[row * inc2 + start2] += data_A[viennacl::column_major::mem_index(row * A_inc1 + A_start1, col * A_inc2 + A_start2, A_internal_size1, A_internal_size2)] * temp;
-          }
-        }
+        detail::gemv(detail::make_strided_view(mat), data_x + start1, inc1, data_result + start2, inc2);
       }
 
 
@@ -435,54 +399,16 @@ namespace viennacl
       {
         typedef NumericT        value_type;
         
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(mat_trans.lhs());
         value_type const * data_x = detail::extract_raw_pointer<value_type>(vec);
         value_type       * data_result = detail::extract_raw_pointer<value_type>(result);
         
-        std::size_t A_start1 = viennacl::traits::start1(mat_trans.lhs());
-        std::size_t A_start2 = viennacl::traits::start2(mat_trans.lhs());
-        std::size_t A_inc1   = viennacl::traits::stride1(mat_trans.lhs());
-        std::size_t A_inc2   = viennacl::traits::stride2(mat_trans.lhs());
-        std::size_t A_size1  = viennacl::traits::size1(mat_trans.lhs());
-        std::size_t A_size2  = viennacl::traits::size2(mat_trans.lhs());
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(mat_trans.lhs());
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(mat_trans.lhs());
-        
         std::size_t start1 = viennacl::traits::start(vec);
         std::size_t inc1   = viennacl::traits::stride(vec);
         
         std::size_t start2 = viennacl::traits::start(result);
         std::size_t inc2   = viennacl::traits::stride(result);
         
-        if (detail::is_row_major(typename F::orientation_category()))
-        {
-          {
-            value_type temp = data_x[start1];
-            for (std::size_t row = 0; row < A_size2; ++row)
-              data_result[row * inc2 + start2] = data_A[viennacl::row_major::mem_index(A_start2, row * A_inc1 + A_start1, A_internal_size1, A_internal_size2)] * temp;
-          }
-            
-          for (std::size_t col = 1; col < A_size1; ++col)  //run through matrix sequentially
-          {
-            value_type temp = data_x[col * inc1 + start1];
-            for (std::size_t row = 0; row < A_size2; ++row)
-              data_result[row * inc2 + start2] += data_A[viennacl::row_major::mem_index(col * A_inc2 + A_start2, row * A_inc1 + A_start1, A_internal_size1, A_internal_size2)] * temp;
-          }
-        }
-        else
-        {
-#ifdef VIENNACL_WITH_OPENMP
-          #pragma omp parallel for
-#endif
-          for (std::size_t row = 0; row < A_size2; ++row)
-          {
-            value_type temp = 0;
-            for (std::size_t col = 0; col < A_size1; ++col)
-              temp += data_A[viennacl::column_major::mem_index(col * A_inc2 + A_start2, row * A_inc1 + A_start1, A_internal_size1, A_internal_size2)] * data_x[col * inc1 + start1];
-              
-            data_result[row * inc2 + start2] = temp;
-          }
-        }
+        detail::gemv(detail::make_strided_view(mat_trans.lhs(), true), data_x + start1, inc1, data_result + start2, inc2);
       }
 
 
@@ -490,31 +416,6 @@ namespace viennacl
       /////////////////////////   matrix-matrix products /////////////////////////////////
       //
 
-      namespace detail
-      {
-        template <typename A, typename B, typename C, typename NumericT>
-        void prod(A & a, B & b, C & c,
-                  std::size_t C_size1, std::size_t C_size2, std::size_t A_size2,
-                  NumericT alpha, NumericT beta)
-        {
-          for (std::size_t i=0; i<C_size1; ++i)
-          {
-            for (std::size_t j=0; j<C_size2; ++j)
-            {
-              NumericT temp = 0;
-              for (std::size_t k=0; k<A_size2; ++k)
-                temp += a(i, k) * b(k, j);
-                
-              temp *= alpha;
-              if (beta != 0)
-                temp += beta * c(i,j);
-              c(i,j) = temp;
-            }
-          }
-        }
-        
-      }
-      
       /** @brief Carries out matrix-matrix multiplication
       *
       * Implementation of C = prod(A, B);
@@ -528,40 +429,11 @@ namespace viennacl
                      ScalarType beta)
       {
         typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(A);
-        value_type const * data_B = detail::extract_raw_pointer<value_type>(B);
-        value_type       * data_C = detail::extract_raw_pointer<value_type>(C);
-        
-        std::size_t A_start1 = viennacl::traits::start1(A);
-        std::size_t A_start2 = viennacl::traits::start2(A);
-        std::size_t A_inc1   = viennacl::traits::stride1(A);
-        std::size_t A_inc2   = viennacl::traits::stride2(A);
-        std::size_t A_size2  = viennacl::traits::size2(A);
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(A);
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(A);
-        
-        std::size_t B_start1 = viennacl::traits::start1(B);
-        std::size_t B_start2 = viennacl::traits::start2(B);
-        std::size_t B_inc1   = viennacl::traits::stride1(B);
-        std::size_t B_inc2   = viennacl::traits::stride2(B);
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(B);
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(B);
-        
-        std::size_t C_start1 = viennacl::traits::start1(C);
-        std::size_t C_start2 = viennacl::traits::start2(C);
-        std::size_t C_inc1   = viennacl::traits::stride1(C);
-        std::size_t C_inc2   = viennacl::traits::stride2(C);
-        std::size_t C_size1  = viennacl::traits::size1(C);
-        std::size_t C_size2  = viennacl::traits::size2(C);
-        std::size_t C_internal_size1  = viennacl::traits::internal_size1(C);
-        std::size_t C_internal_size2  = viennacl::traits::internal_size2(C);
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type const, typename F2::orientation_category, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F3::orientation_category, false>   wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
-        
-        detail::prod(wrapper_A, wrapper_B, wrapper_C, C_size1, C_size2, A_size2, static_cast<value_type>(alpha), static_cast<value_type>(beta));
+
+        detail::gemm(detail::make_strided_view(A),
+                     detail::make_strided_view(B),
+                     detail::make_strided_view(C),
+                     static_cast<value_type>(alpha), static_cast<value_type>(beta));
       }
 
 
@@ -581,42 +453,12 @@ namespace viennacl
                      ScalarType beta)
       {
         typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(A.lhs());
-        value_type const * data_B = detail::extract_raw_pointer<value_type>(B);
-        value_type       * data_C = detail::extract_raw_pointer<value_type>(C);
-        
-        std::size_t A_start1 = viennacl::traits::start1(A.lhs());
-        std::size_t A_start2 = viennacl::traits::start2(A.lhs());
-        std::size_t A_inc1   = viennacl::traits::stride1(A.lhs());
-        std::size_t A_inc2   = viennacl::traits::stride2(A.lhs());
-        std::size_t A_size1  = viennacl::traits::size1(A.lhs());
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(A.lhs());
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(A.lhs());
-        
-        std::size_t B_start1 = viennacl::traits::start1(B);
-        std::size_t B_start2 = viennacl::traits::start2(B);
-        std::size_t B_inc1   = viennacl::traits::stride1(B);
-        std::size_t B_inc2   = viennacl::traits::stride2(B);
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(B);
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(B);
-        
-        std::size_t C_start1 = viennacl::traits::start1(C);
-        std::size_t C_start2 = viennacl::traits::start2(C);
-        std::size_t C_inc1   = viennacl::traits::stride1(C);
-        std::size_t C_inc2   = viennacl::traits::stride2(C);
-        std::size_t C_size1  = viennacl::traits::size1(C);
-        std::size_t C_size2  = viennacl::traits::size2(C);
-        std::size_t C_internal_size1  = viennacl::traits::internal_size1(C);
-        std::size_t C_internal_size2  = viennacl::traits::internal_size2(C);
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, true>    wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type const, typename F2::orientation_category, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F3::orientation_category, false>   wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
-        
-        detail::prod(wrapper_A, wrapper_B, wrapper_C, C_size1, C_size2, A_size1, static_cast<value_type>(alpha), static_cast<value_type>(beta));
-      }
 
+        detail::gemm(detail::make_strided_view(A.lhs(), true),
+                     detail::make_strided_view(B),
+                     detail::make_strided_view(C),
+                     static_cast<value_type>(alpha), static_cast<value_type>(beta));
+      }
 
 
 
@@ -633,40 +475,11 @@ namespace viennacl
                      ScalarType beta)
       {
         typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(A);
-        value_type const * data_B = detail::extract_raw_pointer<value_type>(B.lhs());
-        value_type       * data_C = detail::extract_raw_pointer<value_type>(C);
-        
-        std::size_t A_start1 = viennacl::traits::start1(A);
-        std::size_t A_start2 = viennacl::traits::start2(A);
-        std::size_t A_inc1   = viennacl::traits::stride1(A);
-        std::size_t A_inc2   = viennacl::traits::stride2(A);
-        std::size_t A_size2  = viennacl::traits::size2(A);
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(A);
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(A);
-        
-        std::size_t B_start1 = viennacl::traits::start1(B.lhs());
-        std::size_t B_start2 = viennacl::traits::start2(B.lhs());
-        std::size_t B_inc1   = viennacl::traits::stride1(B.lhs());
-        std::size_t B_inc2   = viennacl::traits::stride2(B.lhs());
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(B.lhs());
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(B.lhs());
-        
-        std::size_t C_start1 = viennacl::traits::start1(C);
-        std::size_t C_start2 = viennacl::traits::start2(C);
-        std::size_t C_inc1   = viennacl::traits::stride1(C);
-        std::size_t C_inc2   = viennacl::traits::stride2(C);
-        std::size_t C_size1  = viennacl::traits::size1(C);
-        std::size_t C_size2  = viennacl::traits::size2(C);
-        std::size_t C_internal_size1  = viennacl::traits::internal_size1(C);
-        std::size_t C_internal_size2  = viennacl::traits::internal_size2(C);
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type const, typename F2::orientation_category, true>    wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F3::orientation_category, false>   wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
-        
-        detail::prod(wrapper_A, wrapper_B, wrapper_C, C_size1, C_size2, A_size2, static_cast<value_type>(alpha), static_cast<value_type>(beta));
+
+        detail::gemm(detail::make_strided_view(A),
+                     detail::make_strided_view(B.lhs(), true),
+                     detail::make_strided_view(C),
+                     static_cast<value_type>(alpha), static_cast<value_type>(beta));
       }
 
 
@@ -679,45 +492,16 @@ namespace viennacl
       template <typename NumericT, typename F1, typename F2, typename F3, typename ScalarType >
       void prod_impl(const viennacl::matrix_expression< const matrix_base<NumericT, F1>, const matrix_base<NumericT, F1>, op_trans> & A,
                      const viennacl::matrix_expression< const matrix_base<NumericT, F2>, const matrix_base<NumericT, F2>, op_trans> & B,
-                     matrix_base<NumericT, F3> & C,
+                           matrix_base<NumericT, F3> & C,
                      ScalarType alpha,
                      ScalarType beta)
       {
         typedef NumericT        value_type;
-       
-        value_type const * data_A = detail::extract_raw_pointer<value_type>(A.lhs());
-        value_type const * data_B = detail::extract_raw_pointer<value_type>(B.lhs());
-        value_type       * data_C = detail::extract_raw_pointer<value_type>(C);
-        
-        std::size_t A_start1 = viennacl::traits::start1(A.lhs());
-        std::size_t A_start2 = viennacl::traits::start2(A.lhs());
-        std::size_t A_inc1   = viennacl::traits::stride1(A.lhs());
-        std::size_t A_inc2   = viennacl::traits::stride2(A.lhs());
-        std::size_t A_size1  = viennacl::traits::size1(A.lhs());
-        std::size_t A_internal_size1  = viennacl::traits::internal_size1(A.lhs());
-        std::size_t A_internal_size2  = viennacl::traits::internal_size2(A.lhs());
-        
-        std::size_t B_start1 = viennacl::traits::start1(B.lhs());
-        std::size_t B_start2 = viennacl::traits::start2(B.lhs());
-        std::size_t B_inc1   = viennacl::traits::stride1(B.lhs());
-        std::size_t B_inc2   = viennacl::traits::stride2(B.lhs());
-        std::size_t B_internal_size1  = viennacl::traits::internal_size1(B.lhs());
-        std::size_t B_internal_size2  = viennacl::traits::internal_size2(B.lhs());
-        
-        std::size_t C_start1 = viennacl::traits::start1(C);
-        std::size_t C_start2 = viennacl::traits::start2(C);
-        std::size_t C_inc1   = viennacl::traits::stride1(C);
-        std::size_t C_inc2   = viennacl::traits::stride2(C);
-        std::size_t C_size1  = viennacl::traits::size1(C);
-        std::size_t C_size2  = viennacl::traits::size2(C);
-        std::size_t C_internal_size1  = viennacl::traits::internal_size1(C);
-        std::size_t C_internal_size2  = viennacl::traits::internal_size2(C);
-        
-        detail::matrix_array_wrapper<value_type const, typename F1::orientation_category, true>    wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-        detail::matrix_array_wrapper<value_type const, typename F2::orientation_category, true>    wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-        detail::matrix_array_wrapper<value_type,       typename F3::orientation_category, false>   wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
-        
-        detail::prod(wrapper_A, wrapper_B, wrapper_C, C_size1, C_size2, A_size1, static_cast<value_type>(alpha), static_cast<value_type>(beta));
+
+        detail::gemm(detail::make_strided_view(A.lhs(), true),
+                     detail::make_strided_view(B.lhs(), true),
+                     detail::make_strided_view(C),
+                     static_cast<value_type>(alpha), static_cast<value_type>(beta));
       }
 
 
@@ -23,6 +23,7 @@
 */
 
 #include <list>
+#include <vector>
 
 #include "viennacl/forwards.h"
 #include "viennacl/scalar.hpp"
@@ -70,6 +71,80 @@ namespace viennacl
           }
             
         }
+
+        /** @brief Runs all levels of a level-scheduled triangular substitution.
+        *
+        * In contrast to calling the single-level substitution once per level, a single OpenMP parallel region is used for all levels.
+        * The rows within each level are distributed among the threads, the implicit barrier at the end of each worksharing loop separates the levels.
+        */
+        template <typename ScalarType>
+        void level_scheduling_substitute(vector<ScalarType> & vec,
+                                         std::list< viennacl::backend::mem_handle > const & row_index_arrays,
+                                         std::list< viennacl::backend::mem_handle > const & row_buffers,
+                                         std::list< viennacl::backend::mem_handle > const & col_buffers,
+                                         std::list< viennacl::backend::mem_handle > const & element_buffers,
+                                         std::list< std::size_t > const & row_elimination_num_list)
+        {
+          typedef std::list< viennacl::backend::mem_handle >::const_iterator  ListIterator;
+
+          ScalarType * vec_buf = viennacl::linalg::host_based::detail::extract_raw_pointer<ScalarType>(vec.handle());
+
+          // collect raw pointers of all levels, so that the lists are not traversed within the parallel region:
+          std::size_t num_levels = row_index_arrays.size();
+          std::vector<unsigned int const *> elim_row_index(num_levels);
+          std::vector<unsigned int const *> elim_row_buffer(num_levels);
+          std::vector<unsigned int const *> elim_col_buffer(num_levels);
+          std::vector<ScalarType   const *> elim_elements(num_levels);
+          std::vector<long>                 elim_num_rows(num_levels);
+
+          std::size_t total_nnz = 0;
+          ListIterator row_index_array_it = row_index_arrays.begin();
+          ListIterator row_buffers_it     = row_buffers.begin();
+          ListIterator col_buffers_it     = col_buffers.begin();
+          ListIterator element_buffers_it = element_buffers.begin();
+          std::list< std::size_t >::const_iterator row_elimination_num_it = row_elimination_num_list.begin();
+          for (std::size_t level = 0; level < num_levels; ++level)
+          {
+            elim_row_index[level]  = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(*row_index_array_it);
+            elim_row_buffer[level] = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(*row_buffers_it);
+            elim_col_buffer[level] = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(*col_buffers_it);
+            elim_elements[level]   = viennacl::linalg::host_based::detail::extract_raw_pointer<ScalarType>(*element_buffers_it);
+            elim_num_rows[level]   = static_cast<long>(*row_elimination_num_it);
+            total_nnz += elim_row_buffer[level][*row_elimination_num_it];
+
+            ++row_index_array_it;
+            ++row_buffers_it;
+            ++col_buffers_it;
+            ++element_buffers_it;
+            ++row_elimination_num_it;
+          }
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel if (total_nnz > 10000)
+#endif
+          for (std::size_t level = 0; level < num_levels; ++level)
+          {
+            unsigned int const * level_row_index  = elim_row_index[level];
+            unsigned int const * level_row_buffer = elim_row_buffer[level];
+            unsigned int const * level_col_buffer = elim_col_buffer[level];
+            ScalarType   const * level_elements   = elim_elements[level];
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp for
+#endif
+            for (long row = 0; row < elim_num_rows[level]; ++row)
+            {
+              unsigned int eq_row = level_row_index[row];
+              ScalarType vec_entry = vec_buf[eq_row];
+              unsigned int row_end = level_row_buffer[row+1];
+
+              for (std::size_t j = level_row_buffer[row]; j < row_end; ++j)
+                vec_entry -= vec_buf[level_col_buffer[j]] * level_elements[j];
+
+              vec_buf[eq_row] = vec_entry;
+            }
+          }
+        }
       }
       
     } // namespace host_based
@@ -0,0 +1,185 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_NMF_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_NMF_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/nmf_operations.hpp
+    @brief Implementations of the fused multiplicative updates and the residual of the nonnegative matrix factorization in host memory.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "viennacl/forwards.h"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief Multiplicative update X = X .* N ./ (G X) for a k x p matrix X and a small k x k matrix G.
+        *
+        * The denominator is never stored: Each column of G X is formed in a private buffer right before the column of X is updated.
+        * Columns are distributed among the threads. Entries with a denominator below 1e-5 are set to zero (as in the OpenCL kernel).
+        * The update of W in X = X .* N ./ (X S) is obtained by passing the transposed views of W, N, and S.
+        */
+        template <typename NumericT>
+        void nmf_multiplicative_update(strided_matrix_view<NumericT> const & X,
+                                       strided_matrix_view<NumericT const> const & N,
+                                       strided_matrix_view<NumericT const> const & G)
+        {
+          long k = static_cast<long>(X.size1);
+          long p = static_cast<long>(X.size2);
+
+          if (k == 0)
+            return;
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel if (k * k * p > 10000)
+#endif
+          {
+            std::vector<NumericT> denominator(static_cast<std::size_t>(k));
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp for
+#endif
+            for (long j = 0; j < p; ++j)
+            {
+              for (long i = 0; i < k; ++i)
+                denominator[i] = 0;
+
+              // denominator = G X(:,j), accumulated column by column of G:
+              for (long l = 0; l < k; ++l)
+              {
+                NumericT x_lj = X(l, j);
+                for (long i = 0; i < k; ++i)
+                  denominator[i] += G(i, l) * x_lj;
+              }
+
+              for (long i = 0; i < k; ++i)
+              {
+                NumericT divisor = denominator[i];
+                X(i, j) = (divisor > NumericT(0.00001)) ? X(i, j) * N(i, j) / divisor : NumericT(0);
+              }
+            }
+          }
+        }
+
+        /** @brief Returns sum_ij A(i,j) * B(i,j), accumulated in double precision */
+        template <typename NumericT>
+        double nmf_frobenius_inner_prod(strided_matrix_view<NumericT const> const & A,
+                                        strided_matrix_view<NumericT const> const & B)
+        {
+          long M = static_cast<long>(A.size1);
+          long N = static_cast<long>(A.size2);
+          double result = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for reduction(+: result) if (M * N > 10000)
+#endif
+          for (long i = 0; i < M; ++i)
+          {
+            double row_sum = 0;
+            for (long j = 0; j < N; ++j)
+              row_sum += A(i, j) * B(i, j);
+            result += row_sum;
+          }
+
+          return result;
+        }
+
+        /** @brief Computes ||V - W H||_F from the trace identity ||V||_F^2 - 2 tr(W^T V H^T) + tr((W^T W)(H H^T)) without forming W H.
+        *
+        * @param V_norm_squared  The squared Frobenius norm of V
+        * @param W               The first factor (m x k)
+        * @param VHt             The product V H^T (m x k)
+        * @param WtW             The product W^T W (k x k)
+        * @param HHt             The product H H^T (k x k)
+        *
+        * Since the three terms cancel as the residual becomes small, the relative accuracy of the result is limited to about sqrt(epsilon) ||V||_F.
+        */
+        template <typename NumericT>
+        NumericT nmf_residual_norm(double V_norm_squared,
+                                   strided_matrix_view<NumericT const> const & W,
+                                   strided_matrix_view<NumericT const> const & VHt,
+                                   strided_matrix_view<NumericT const> const & WtW,
+                                   strided_matrix_view<NumericT const> const & HHt)
+        {
+          double residual_squared = V_norm_squared
+                                    - 2.0 * nmf_frobenius_inner_prod(W, VHt)
+                                    + nmf_frobenius_inner_prod(WtW, HHt.trans());  // tr(A B) = sum_ij A(i,j) B(j,i)
+
+          return static_cast<NumericT>(std::sqrt(std::max(residual_squared, 0.0)));
+        }
+
+        /** @brief Computes ||V - W H||_F row by row, i.e. without storing W H. Costs as much as a multiplicative update, but is accurate to about epsilon ||V||_F. */
+        template <typename NumericT>
+        NumericT nmf_explicit_residual_norm(strided_matrix_view<NumericT const> const & V,
+                                            strided_matrix_view<NumericT const> const & W,
+                                            strided_matrix_view<NumericT const> const & H)
+        {
+          long m = static_cast<long>(V.size1);
+          long n = static_cast<long>(V.size2);
+          long k = static_cast<long>(W.size2);
+          double result = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel reduction(+: result) if (m * n * k > 10000)
+#endif
+          {
+            std::vector<NumericT> row(static_cast<std::size_t>(n));
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp for
+#endif
+            for (long i = 0; i < m; ++i)
+            {
+              // row = V(i,:) - W(i,:) H, accumulated row by row of H:
+              for (long j = 0; j < n; ++j)
+                row[j] = V(i, j);
+              for (long l = 0; l < k; ++l)
+              {
+                NumericT w_il = W(i, l);
+                for (long j = 0; j < n; ++j)
+                  row[j] -= w_il * H(l, j);
+              }
+
+              double row_sum = 0;
+              for (long j = 0; j < n; ++j)
+                row_sum += row[j] * row[j];
+              result += row_sum;
+            }
+          }
+
+          return static_cast<NumericT>(std::sqrt(result));
+        }
+
+      } //namespace detail
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
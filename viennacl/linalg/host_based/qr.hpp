@@ -0,0 +1,247 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_QR_HPP
+#define VIENNACL_LINALG_HOST_BASED_QR_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/qr.hpp
+    @brief Implementation of a blocked Householder QR factorization for dense matrices in host memory.
+
+    The reflectors and the scalars beta follow the convention of viennacl/linalg/qr.hpp: H_j = I - beta_j v_j v_j^T with v_j(j) = 1, the entries of v_j below the diagonal are stored in A.
+    Blocks of reflectors are applied in the compact WY representation H_j ... H_{j+k-1} = I - V T V^T, where T is upper triangular.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "viennacl/forwards.h"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief Computes the Householder reflector for the first column x of A such that H x = mu e_1. Writes mu to A(0,0) and v (without its leading one) below. Returns beta. */
+        template <typename NumericT>
+        NumericT qr_householder_vector(strided_matrix_view<NumericT> const & A)
+        {
+          std::size_t m = A.size1;
+
+          NumericT sigma = 0;
+          for (std::size_t i = 1; i < m; ++i)
+            sigma += A(i, 0) * A(i, 0);
+
+          if (sigma == 0)
+            return 0;
+
+          NumericT A_00 = A(0, 0);
+          NumericT mu = std::sqrt(sigma + A_00 * A_00);
+          NumericT v1 = (A_00 <= 0) ? (A_00 - mu) : (-sigma / (A_00 + mu));
+
+          for (std::size_t i = 1; i < m; ++i)
+            A(i, 0) /= v1;
+          A(0, 0) = mu;
+
+          return NumericT(2) * v1 * v1 / (sigma + v1 * v1);
+        }
+
+        /** @brief Applies the block reflector I - V T V^T (or its transpose) to C from the left. V holds the reflectors explicitly (including zeros and the unit diagonal). */
+        template <typename NumericT>
+        void qr_apply_block_reflector(strided_matrix_view<NumericT const> const & V,
+                                      strided_matrix_view<NumericT const> const & T,
+                                      strided_matrix_view<NumericT> const & C,
+                                      bool transposed)
+        {
+          std::size_t k = V.size2;
+          std::size_t N = C.size2;
+
+          if (k == 0 || N == 0)
+            return;
+
+          std::vector<NumericT> buffer(2 * k * N);
+          strided_matrix_view<NumericT> W1(&(buffer[0]),     k, N, N, 1);
+          strided_matrix_view<NumericT> W2(&(buffer[k * N]), k, N, N, 1);
+
+          gemm(V.trans(), const_view(C), W1, NumericT(1), NumericT(0));                    // W1 = V^T C
+          gemm(transposed ? T.trans() : T, const_view(W1), W2, NumericT(1), NumericT(0));  // W2 = T^T W1 or T W1
+          gemm(V, const_view(W2), C, NumericT(-1), NumericT(1));                           // C -= V W2
+        }
+
+        /** @brief Recursive QR factorization of a panel A (m x n, m >= n): The left half is factored, its block reflector is applied to the right half, and then the lower right part is factored.
+        *
+        * @param A      The panel. R and the reflectors are written to A.
+        * @param V      Buffer of the same size as A (initialized to zero). Receives the reflectors explicitly.
+        * @param T      Buffer of size n x n (initialized to zero). Receives the upper triangular factor of the compact WY representation.
+        * @param betas  Receives the n scalars beta
+        */
+        template <typename NumericT>
+        void qr_panel_recursive(strided_matrix_view<NumericT> const & A,
+                                strided_matrix_view<NumericT> const & V,
+                                strided_matrix_view<NumericT> const & T,
+                                NumericT * betas)
+        {
+          std::size_t m = A.size1;
+          std::size_t n = A.size2;
+
+          if (n == 1)
+          {
+            betas[0] = qr_householder_vector(A);
+            V(0, 0) = 1;
+            for (std::size_t i = 1; i < m; ++i)
+              V(i, 0) = A(i, 0);
+            T(0, 0) = betas[0];
+            return;
+          }
+
+          std::size_t n1 = n / 2;
+          std::size_t n2 = n - n1;
+
+          qr_panel_recursive(A.sub(0, 0, m, n1), V.sub(0, 0, m, n1), T.sub(0, 0, n1, n1), betas);
+          qr_apply_block_reflector(const_view(V.sub(0, 0, m, n1)), const_view(T.sub(0, 0, n1, n1)), A.sub(0, n1, m, n2), true);
+          qr_panel_recursive(A.sub(n1, n1, m - n1, n2), V.sub(n1, n1, m - n1, n2), T.sub(n1, n1, n2, n2), betas + n1);
+
+          // T_12 = -T_11 (V_1^T V_2) T_22, where V_2 is zero in the first n1 rows:
+          std::vector<NumericT> buffer(2 * n1 * n2);
+          strided_matrix_view<NumericT> temp1(&(buffer[0]),       n1, n2, n2, 1);
+          strided_matrix_view<NumericT> temp2(&(buffer[n1 * n2]), n1, n2, n2, 1);
+          gemm(const_view(V.sub(n1, 0, m - n1, n1)).trans(), const_view(V.sub(n1, n1, m - n1, n2)), temp1, NumericT(1), NumericT(0));
+          gemm(const_view(temp1), const_view(T.sub(n1, n1, n2, n2)), temp2, NumericT(1), NumericT(0));
+          gemm(const_view(T.sub(0, 0, n1, n1)), const_view(temp2), T.sub(0, n1, n1, n2), NumericT(-1), NumericT(0));
+        }
+
+        /** @brief Extracts the k reflectors stored below the diagonal of the m x k panel A to V (explicitly) and forms the triangular factor T from V and betas */
+        template <typename NumericT, typename VectorType>
+        void qr_form_block_reflector(strided_matrix_view<NumericT const> const & A, VectorType const & betas, std::size_t beta_offset,
+                                     strided_matrix_view<NumericT> const & V, strided_matrix_view<NumericT> const & T)
+        {
+          std::size_t m = A.size1;
+          std::size_t k = A.size2;
+
+          for (std::size_t j = 0; j < k; ++j)
+          {
+            for (std::size_t i = 0; i < j; ++i)
+              V(i, j) = 0;
+            V(j, j) = 1;
+            for (std::size_t i = j + 1; i < m; ++i)
+              V(i, j) = A(i, j);
+          }
+
+          std::vector<NumericT> temp(k);
+          for (std::size_t j = 0; j < k; ++j)
+          {
+            NumericT beta = betas[beta_offset + j];
+
+            // temp = V(:, 0:j)^T v_j, where v_j is zero above row j:
+            for (std::size_t i = 0; i < j; ++i)
+            {
+              NumericT value = 0;
+              for (std::size_t l = j; l < m; ++l)
+                value += V(l, i) * V(l, j);
+              temp[i] = value;
+            }
+
+            // T(0:j, j) = -beta T(0:j, 0:j) temp:
+            for (std::size_t i = 0; i < j; ++i)
+            {
+              NumericT value = 0;
+              for (std::size_t l = i; l < j; ++l)
+                value += T(i, l) * temp[l];
+              T(i, j) = -beta * value;
+            }
+            for (std::size_t i = j + 1; i < k; ++i)
+              T(i, j) = 0;
+            T(j, j) = beta;
+          }
+        }
+
+        /** @brief Blocked Householder QR factorization of A in host memory.
+        *
+        * Each panel of block_size columns is factored recursively. The block reflector of the panel is then applied to the trailing columns with three matrix-matrix products.
+        *
+        * @param A           The matrix. R and the reflectors are written to A.
+        * @param betas       Receives the scalars beta of the reflectors (size at least min(size1, size2))
+        * @param block_size  The width of the panels
+        */
+        template <typename NumericT>
+        void inplace_qr(strided_matrix_view<NumericT> const & A, NumericT * betas, std::size_t block_size)
+        {
+          std::size_t m = A.size1;
+          std::size_t n = A.size2;
+          std::size_t p = std::min(m, n);
+
+          block_size = std::max<std::size_t>(block_size, 1);
+
+          for (std::size_t j = 0; j < p; j += block_size)
+          {
+            std::size_t k = std::min(block_size, p - j);
+
+            std::vector<NumericT> V_buffer((m - j) * k);
+            std::vector<NumericT> T_buffer(k * k);
+            strided_matrix_view<NumericT> V(&(V_buffer[0]), m - j, k, k, 1);
+            strided_matrix_view<NumericT> T(&(T_buffer[0]), k, k, k, 1);
+
+            qr_panel_recursive(A.sub(j, j, m - j, k), V, T, betas + j);
+
+            if (j + k < n)
+              qr_apply_block_reflector(const_view(V), const_view(T), A.sub(j, j + k, m - j, n - j - k), true);
+          }
+        }
+
+        /** @brief Applies Q (or Q^T, if 'transposed' is set) from an inplace QR factorization in A to C. Panels of block_size reflectors are applied as block reflectors. */
+        template <typename NumericT, typename VectorType>
+        void qr_apply_Q(strided_matrix_view<NumericT const> const & A, VectorType const & betas,
+                        strided_matrix_view<NumericT> const & C, bool transposed, std::size_t block_size = 32)
+        {
+          std::size_t m = A.size1;
+          std::size_t p = std::min(A.size1, A.size2);
+
+          if (p == 0)
+            return;
+
+          block_size = std::max<std::size_t>(block_size, 1);
+          std::size_t num_blocks = (p - 1) / block_size + 1;
+
+          for (std::size_t b = 0; b < num_blocks; ++b)
+          {
+            // Q^T = H_{p-1} ... H_0 is applied from the first panel, Q = H_0 ... H_{p-1} from the last:
+            std::size_t j = (transposed ? b : num_blocks - b - 1) * block_size;
+            std::size_t k = std::min(block_size, p - j);
+
+            std::vector<NumericT> V_buffer((m - j) * k);
+            std::vector<NumericT> T_buffer(k * k);
+            strided_matrix_view<NumericT> V(&(V_buffer[0]), m - j, k, k, 1);
+            strided_matrix_view<NumericT> T(&(T_buffer[0]), k, k, k, 1);
+
+            qr_form_block_reflector(A.sub(j, j, m - j, k), betas, j, V, T);
+            qr_apply_block_reflector(const_view(V), const_view(T), C.sub(j, 0, m - j, C.size2), transposed);
+          }
+        }
+
+      } //namespace detail
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
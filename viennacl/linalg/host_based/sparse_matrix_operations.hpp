@@ -23,12 +23,30 @@
 */
 
 #include <list>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+#if !defined(VIENNACL_WITH_OPENMP) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/time.h>
+#endif
+
+#ifdef VIENNACL_WITH_AVX2
+#include <immintrin.h>
+#endif
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
 
 #include "viennacl/forwards.h"
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
+#include "viennacl/tools/large_file.hpp"
 #include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
 
 namespace viennacl
 {
@@ -95,10 +113,154 @@ namespace viennacl
       }
       
       
+      namespace detail
+      {
+        /** @brief Returns the sum of elements[i] * x[col_buffer[i]] for i in [begin, end). Four independent partial sums hide the latency of the indirect loads. */
+        template <typename ScalarType>
+        ScalarType csr_row_dot(std::size_t begin, std::size_t end,
+                               ScalarType const * elements, unsigned int const * col_buffer, ScalarType const * x)
+        {
+          ScalarType sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+          std::size_t i = begin;
+          for (; i + 4 <= end; i += 4)
+          {
+            sum0 += elements[i    ] * x[col_buffer[i    ]];
+            sum1 += elements[i + 1] * x[col_buffer[i + 1]];
+            sum2 += elements[i + 2] * x[col_buffer[i + 2]];
+            sum3 += elements[i + 3] * x[col_buffer[i + 3]];
+          }
+          for (; i < end; ++i)
+            sum0 += elements[i] * x[col_buffer[i]];
+          return (sum0 + sum1) + (sum2 + sum3);
+        }
+
+#ifdef VIENNACL_WITH_AVX2
+        template <>
+        inline double csr_row_dot<double>(std::size_t begin, std::size_t end,
+                                          double const * elements, unsigned int const * col_buffer, double const * x)
+        {
+          __m256d sum = _mm256_setzero_pd();
+          std::size_t i = begin;
+          for (; i + 4 <= end; i += 4)
+          {
+            __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const *>(col_buffer + i));
+            sum = _mm256_fmadd_pd(_mm256_loadu_pd(elements + i), _mm256_i32gather_pd(x, indices, 8), sum);
+          }
+          double partial[4];
+          _mm256_storeu_pd(partial, sum);
+          double result = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+          for (; i < end; ++i)
+            result += elements[i] * x[col_buffer[i]];
+          return result;
+        }
+
+        template <>
+        inline float csr_row_dot<float>(std::size_t begin, std::size_t end,
+                                        float const * elements, unsigned int const * col_buffer, float const * x)
+        {
+          __m256 sum = _mm256_setzero_ps();
+          std::size_t i = begin;
+          for (; i + 8 <= end; i += 8)
+          {
+            __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(col_buffer + i));
+            sum = _mm256_fmadd_ps(_mm256_loadu_ps(elements + i), _mm256_i32gather_ps(x, indices, 4), sum);
+          }
+          float partial[8];
+          _mm256_storeu_ps(partial, sum);
+          float result = ((partial[0] + partial[1]) + (partial[2] + partial[3])) + ((partial[4] + partial[5]) + (partial[6] + partial[7]));
+          for (; i < end; ++i)
+            result += elements[i] * x[col_buffer[i]];
+          return result;
+        }
+#endif
+
+        /** @brief Locates the intersection of a diagonal with the merge path of the row end offsets and the nonzero indices of a CSR matrix.
+        *
+        * The merge path consists of num_rows + nnz steps: One step per nonzero (consume the entry) and one step per row (write the result).
+        * On return, row_index is the number of rows completed and nnz_index the number of nonzeros consumed after 'diagonal' steps.
+        *
+        * See Merrill and Garland, "Merge-Based Parallel Sparse Matrix-Vector Multiplication", SC'16.
+        */
+        inline void merge_path_search(std::size_t diagonal,
+                                      unsigned int const * row_end_offsets, std::size_t num_rows, std::size_t nnz,
+                                      std::size_t & row_index, std::size_t & nnz_index)
+        {
+          std::size_t x_min = (diagonal > nnz) ? diagonal - nnz : 0;
+          std::size_t x_max = std::min(diagonal, num_rows);
+
+          while (x_min < x_max)
+          {
+            std::size_t pivot = (x_min + x_max) / 2;
+            if (row_end_offsets[pivot] < diagonal - pivot)  // i.e. row_end_offsets[pivot] <= diagonal - pivot - 1
+              x_min = pivot + 1;
+            else
+              x_max = pivot;
+          }
+
+          row_index = std::min(x_min, num_rows);
+          nnz_index = diagonal - x_min;
+        }
+
+        /** @brief Merge-path SpMV: Every thread processes the same number of rows plus nonzeros, regardless of how the nonzeros are distributed over the rows.
+        *
+        * Rows split between two threads are handled via carry-outs: Each thread writes the partial sum of its last (incomplete) row to a carry-out slot,
+        * which is added to the result once all threads are done.
+        */
+        template <typename ScalarType>
+        void csr_merge_path_prod(ScalarType const * elements,
+                                 unsigned int const * row_buffer,
+                                 unsigned int const * col_buffer,
+                                 std::size_t num_rows,
+                                 ScalarType const * x,
+                                 ScalarType * result,
+                                 std::size_t num_threads)
+        {
+          unsigned int const * row_end_offsets = row_buffer + 1;
+          std::size_t nnz = row_buffer[num_rows];
+          std::size_t num_merge_items = num_rows + nnz;
+          std::size_t items_per_thread = (num_merge_items - 1) / num_threads + 1;
+
+          std::vector<std::size_t> carry_out_row(num_threads);
+          std::vector<ScalarType>  carry_out_value(num_threads);
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for schedule(static, 1)
+#endif
+          for (long tid = 0; tid < static_cast<long>(num_threads); ++tid)
+          {
+            std::size_t diagonal_begin = std::min(items_per_thread * static_cast<std::size_t>(tid), num_merge_items);
+            std::size_t diagonal_end   = std::min(diagonal_begin + items_per_thread, num_merge_items);
+
+            std::size_t row_begin, nnz_begin, row_end, nnz_end;
+            merge_path_search(diagonal_begin, row_end_offsets, num_rows, nnz, row_begin, nnz_begin);
+            merge_path_search(diagonal_end,   row_end_offsets, num_rows, nnz, row_end,   nnz_end);
+
+            // complete rows (the first one might have been started by the previous thread):
+            for (std::size_t row = row_begin; row < row_end; ++row)
+            {
+              std::size_t row_stop = row_end_offsets[row];
+              result[row] = csr_row_dot(nnz_begin, row_stop, elements, col_buffer, x);
+              nnz_begin = row_stop;
+            }
+
+            // partial row at the end of the merge path segment:
+            carry_out_row[static_cast<std::size_t>(tid)]   = row_end;
+            carry_out_value[static_cast<std::size_t>(tid)] = csr_row_dot(nnz_begin, nnz_end, elements, col_buffer, x);
+          }
+
+          for (std::size_t tid = 0; tid < num_threads; ++tid)
+            if (carry_out_row[tid] < num_rows)
+              result[carry_out_row[tid]] += carry_out_value[tid];
+        }
+      }
+
+
       /** @brief Carries out matrix-vector multiplication with a compressed_matrix
       *
       * Implementation of the convenience expression result = prod(mat, vec);
       *
+      * With OpenMP, the work is partitioned along the merge path of rows and nonzeros, so that matrices with very uneven row lengths are load-balanced.
+      *
       * @param mat    The matrix
       * @param vec    The vector
       * @param result The result vector
@@ -114,20 +276,483 @@ namespace viennacl
         unsigned int const * row_buffer = detail::extract_raw_pointer<unsigned int>(mat.handle1());
         unsigned int const * col_buffer = detail::extract_raw_pointer<unsigned int>(mat.handle2());
         
+        if (mat.size1() == 0)
+          return;
+
 #ifdef VIENNACL_WITH_OPENMP
-        #pragma omp parallel for
+        std::size_t num_threads = static_cast<std::size_t>(omp_get_max_threads());
+        if (num_threads > 1 && mat.size1() + mat.nnz() > 10000)
+        {
+          detail::csr_merge_path_prod(elements, row_buffer, col_buffer, mat.size1(), vec_buf, result_buf, num_threads);
+          return;
+        }
 #endif
+
         for (std::size_t row = 0; row < mat.size1(); ++row)
+          result_buf[row] = detail::csr_row_dot<ScalarType>(row_buffer[row], row_buffer[row+1], elements, col_buffer, vec_buf);
+      }
+
+
+      //
+      // Out-of-core compressed matrix
+      //
+
+      namespace detail
+      {
+        /** @brief Returns the wall-clock time in seconds */
+        inline double out_of_core_wall_time()
         {
-          ScalarType dot_prod = 0;
-          std::size_t row_end = row_buffer[row+1];
-          for (std::size_t i = row_buffer[row]; i < row_end; ++i)
-            dot_prod += elements[i] * vec_buf[col_buffer[i]];
-          result_buf[row] = dot_prod;
+#ifdef VIENNACL_WITH_OPENMP
+          return omp_get_wtime();
+#elif defined(__unix__) || defined(__APPLE__)
+          struct timeval tval;
+          gettimeofday(&tval, NULL);
+          return static_cast<double>(tval.tv_sec) + static_cast<double>(tval.tv_usec) / 1000000.0;
+#else
+          return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+        }
+
+        /** @brief Reads the column indices and entries of a row block of an out_of_core_compressed_matrix into the given buffers. Returns false on failure. */
+        template <typename ScalarType>
+        bool read_out_of_core_block(std::FILE * file,
+                                    viennacl::out_of_core_compressed_matrix<ScalarType> const & mat,
+                                    unsigned int const * row_buffer,
+                                    std::size_t block,
+                                    std::vector<unsigned int> & cols,
+                                    std::vector<ScalarType> & elements,
+                                    std::size_t & bytes_read)
+        {
+          std::size_t nnz_begin = row_buffer[mat.block_start(block)];
+          std::size_t nnz       = row_buffer[mat.block_start(block + 1)] - nnz_begin;
+
+          if (nnz == 0)
+            return true;
+
+          if (   !viennacl::tools::seek_file(file, mat.column_offset() + sizeof(unsigned int) * nnz_begin)
+              || std::fread(&(cols[0]), sizeof(unsigned int), nnz, file) != nnz
+              || !viennacl::tools::seek_file(file, mat.elements_offset() + sizeof(ScalarType) * nnz_begin)
+              || std::fread(&(elements[0]), sizeof(ScalarType), nnz, file) != nnz)
+            return false;
+
+          bytes_read += (sizeof(unsigned int) + sizeof(ScalarType)) * nnz;
+          return true;
+        }
+
+        /** @brief Computes the rows [row_begin, row_end) of a row block of an out_of_core_compressed_matrix. */
+        template <typename ScalarType>
+        void out_of_core_block_prod(unsigned int const * row_buffer, std::size_t block_nnz_begin,
+                                    std::size_t row_begin, std::size_t row_end,
+                                    unsigned int const * cols, ScalarType const * elements,
+                                    ScalarType const * x, ScalarType * result)
+        {
+          for (std::size_t row = row_begin; row < row_end; ++row)
+            result[row] = csr_row_dot<ScalarType>(row_buffer[row] - block_nnz_begin, row_buffer[row+1] - block_nnz_begin, elements, cols, x);
         }
-        
       }
-      
+
+      /** @brief Carries out matrix-vector multiplication with an out_of_core_compressed_matrix
+      *
+      * Implementation of the convenience expression result = prod(mat, vec);
+      *
+      * The row blocks of the matrix are read from disk into two alternating buffers.
+      * With OpenMP, the first thread reads the next row block while all other threads compute with the current one, so reading and computing overlap.
+      * Without OpenMP, or if only a single thread is available, reading and computing alternate.
+      * The achieved timings are accumulated in the statistics of the matrix.
+      *
+      * @param mat    The matrix
+      * @param vec    The vector
+      * @param result The result vector
+      */
+      template<class ScalarType>
+      void prod_impl(const viennacl::out_of_core_compressed_matrix<ScalarType> & mat,
+                     const viennacl::vector_base<ScalarType> & vec,
+                           viennacl::vector_base<ScalarType> & result)
+      {
+        ScalarType         * result_buf = detail::extract_raw_pointer<ScalarType>(result.handle());
+        ScalarType   const * vec_buf    = detail::extract_raw_pointer<ScalarType>(vec.handle());
+        unsigned int const * row_buffer = detail::extract_raw_pointer<unsigned int>(mat.handle1());
+
+        if (mat.size1() == 0)
+          return;
+
+        double start_time = detail::out_of_core_wall_time();
+
+        std::FILE * file = std::fopen(mat.filename().c_str(), "rb");
+        if (!file)
+          throw "Cannot open file of out_of_core_compressed_matrix";
+
+        for (std::size_t i=0; i<2; ++i)
+        {
+          mat.column_block_buffer(i).resize(std::max<std::size_t>(mat.max_block_nnz(), 1));
+          mat.element_block_buffer(i).resize(std::max<std::size_t>(mat.max_block_nnz(), 1));
+        }
+
+        std::size_t bytes_read = 0;
+        double io_time = 0;
+        double compute_time = 0;
+
+        // first block is read before computations can start:
+        double io_start = detail::out_of_core_wall_time();
+        bool success = detail::read_out_of_core_block(file, mat, row_buffer, 0, mat.column_block_buffer(0), mat.element_block_buffer(0), bytes_read);
+        io_time += detail::out_of_core_wall_time() - io_start;
+
+        std::size_t num_blocks = mat.blocks();
+
+#ifdef VIENNACL_WITH_OPENMP
+        std::size_t max_threads = static_cast<std::size_t>(omp_get_max_threads());
+        if (max_threads > 1 && num_blocks > 1 && success)
+        {
+          std::vector<double> compute_times(max_threads);
+
+          #pragma omp parallel
+          {
+            std::size_t tid         = static_cast<std::size_t>(omp_get_thread_num());
+            std::size_t num_threads = static_cast<std::size_t>(omp_get_num_threads());
+            std::size_t num_compute_threads = (num_threads > 1) ? num_threads - 1 : 1;   //thread 0 reads, unless it is the only thread
+            std::size_t compute_id          = (num_threads > 1) ? tid - 1 : 0;
+
+            for (std::size_t block = 0; block < num_blocks; ++block)
+            {
+              if (tid == 0 && block + 1 < num_blocks && success)
+              {
+                double t = detail::out_of_core_wall_time();
+                success = detail::read_out_of_core_block(file, mat, row_buffer, block + 1,
+                                                         mat.column_block_buffer((block + 1) % 2), mat.element_block_buffer((block + 1) % 2),
+                                                         bytes_read);
+                io_time += detail::out_of_core_wall_time() - t;
+              }
+
+              if (tid > 0 || num_threads == 1)
+              {
+                // split the rows of the block such that each compute thread obtains about the same number of nonzeros:
+                double t = detail::out_of_core_wall_time();
+                std::size_t row_begin = mat.block_start(block);
+                std::size_t row_end   = mat.block_start(block + 1);
+                std::size_t nnz_begin = row_buffer[row_begin];
+                std::size_t nnz       = row_buffer[row_end] - nnz_begin;
+
+                std::size_t my_row_begin = static_cast<std::size_t>(std::lower_bound(row_buffer + row_begin, row_buffer + row_end, nnz_begin + (nnz *  compute_id     ) / num_compute_threads) - row_buffer);
+                std::size_t my_row_end   = static_cast<std::size_t>(std::lower_bound(row_buffer + row_begin, row_buffer + row_end, nnz_begin + (nnz * (compute_id + 1)) / num_compute_threads) - row_buffer);
+                if (compute_id + 1 == num_compute_threads)
+                  my_row_end = row_end;
+
+                detail::out_of_core_block_prod(row_buffer, nnz_begin, my_row_begin, my_row_end,
+                                               &(mat.column_block_buffer(block % 2)[0]), &(mat.element_block_buffer(block % 2)[0]),
+                                               vec_buf, result_buf);
+                compute_times[tid] += detail::out_of_core_wall_time() - t;
+              }
+
+              #pragma omp barrier
+            }
+          }
+
+          compute_time = *std::max_element(compute_times.begin(), compute_times.end());
+        }
+        else
+#endif
+        {
+          for (std::size_t block = 0; block < num_blocks && success; ++block)
+          {
+            double t = detail::out_of_core_wall_time();
+            detail::out_of_core_block_prod(row_buffer, row_buffer[mat.block_start(block)], mat.block_start(block), mat.block_start(block + 1),
+                                           &(mat.column_block_buffer(block % 2)[0]), &(mat.element_block_buffer(block % 2)[0]),
+                                           vec_buf, result_buf);
+            compute_time += detail::out_of_core_wall_time() - t;
+
+            if (block + 1 < num_blocks)
+            {
+              t = detail::out_of_core_wall_time();
+              success = detail::read_out_of_core_block(file, mat, row_buffer, block + 1,
+                                                       mat.column_block_buffer((block + 1) % 2), mat.element_block_buffer((block + 1) % 2),
+                                                       bytes_read);
+              io_time += detail::out_of_core_wall_time() - t;
+            }
+          }
+        }
+
+        std::fclose(file);
+        if (!success)
+          throw "Failed to read row block of out_of_core_compressed_matrix";
+
+        mat.record_statistics(bytes_read, io_time, compute_time, detail::out_of_core_wall_time() - start_time);
+      }
+
+
+
+      namespace detail
+      {
+        /** @brief Computes C = A * B for a CSR matrix A and a dense matrix B.
+        *
+        * If the rows of B are contiguous, each row of C is accumulated as a linear combination of rows of B, so that the innermost loop runs over the column dimension with unit stride and is vectorized by the compiler.
+        * Otherwise, each entry of C is computed as a sparse dot product with a column of B.
+        */
+        template <typename NumericT>
+        void csr_prod_dense(NumericT const * elements, unsigned int const * row_buffer, unsigned int const * col_buffer,
+                            strided_matrix_view<NumericT const> const & B,
+                            strided_matrix_view<NumericT> const & C)
+        {
+          long rows = static_cast<long>(C.size1);
+          std::size_t cols = C.size2;
+
+          if (B.col_inc == 1)
+          {
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for if (row_buffer[C.size1] * cols > 10000)
+#endif
+            for (long row = 0; row < rows; ++row)
+            {
+              NumericT * C_row = C.data + static_cast<std::size_t>(row) * C.row_inc;
+              std::size_t row_end = row_buffer[row+1];
+
+              if (C.col_inc == 1)
+              {
+                for (std::size_t j = 0; j < cols; ++j)
+                  C_row[j] = 0;
+
+                for (std::size_t k = row_buffer[row]; k < row_end; ++k)
+                {
+                  NumericT a = elements[k];
+                  NumericT const * B_row = B.data + col_buffer[k] * B.row_inc;
+                  for (std::size_t j = 0; j < cols; ++j)
+                    C_row[j] += a * B_row[j];
+                }
+              }
+              else
+              {
+                for (std::size_t j = 0; j < cols; ++j)
+                  C_row[j * C.col_inc] = 0;
+
+                for (std::size_t k = row_buffer[row]; k < row_end; ++k)
+                {
+                  NumericT a = elements[k];
+                  NumericT const * B_row = B.data + col_buffer[k] * B.row_inc;
+                  for (std::size_t j = 0; j < cols; ++j)
+                    C_row[j * C.col_inc] += a * B_row[j];
+                }
+              }
+            }
+          }
+          else
+          {
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp parallel for if (row_buffer[C.size1] * cols > 10000)
+#endif
+            for (long row = 0; row < rows; ++row)
+            {
+              std::size_t row_begin = row_buffer[row];
+              std::size_t row_end   = row_buffer[row+1];
+              for (std::size_t j = 0; j < cols; ++j)
+              {
+                NumericT const * B_col = B.data + j * B.col_inc;
+                NumericT sum = 0;
+                if (B.row_inc == 1)
+                  sum = csr_row_dot<NumericT>(row_begin, row_end, elements, col_buffer, B_col);
+                else
+                  for (std::size_t k = row_begin; k < row_end; ++k)
+                    sum += elements[k] * B_col[col_buffer[k] * B.row_inc];
+                C(static_cast<std::size_t>(row), j) = sum;
+              }
+            }
+          }
+        }
+      }
+
+      /** @brief Carries out sparse matrix times dense matrix multiplication with a compressed_matrix
+      *
+      * Implementation of the convenience expression result = prod(sp_mat, d_mat);
+      *
+      * @param sp_mat   The sparse matrix
+      * @param d_mat    The dense matrix
+      * @param result   The result matrix
+      */
+      template<class ScalarType, unsigned int ALIGNMENT, typename F1, typename F2>
+      void prod_impl(const viennacl::compressed_matrix<ScalarType, ALIGNMENT> & sp_mat,
+                     const viennacl::matrix_base<ScalarType, F1> & d_mat,
+                           viennacl::matrix_base<ScalarType, F2> & result)
+      {
+        detail::csr_prod_dense(detail::extract_raw_pointer<ScalarType>(sp_mat.handle()),
+                               detail::extract_raw_pointer<unsigned int>(sp_mat.handle1()),
+                               detail::extract_raw_pointer<unsigned int>(sp_mat.handle2()),
+                               detail::make_strided_view(d_mat),
+                               detail::make_strided_view(result));
+      }
+
+      /** @brief Carries out sparse matrix times transposed dense matrix multiplication with a compressed_matrix
+      *
+      * Implementation of the convenience expression result = prod(sp_mat, trans(d_mat));
+      *
+      * @param sp_mat   The sparse matrix
+      * @param d_mat    The transposed dense matrix proxy
+      * @param result   The result matrix
+      */
+      template<class ScalarType, unsigned int ALIGNMENT, typename F1, typename F2>
+      void prod_impl(const viennacl::compressed_matrix<ScalarType, ALIGNMENT> & sp_mat,
+                     const viennacl::matrix_expression<const viennacl::matrix_base<ScalarType, F1>,
+                                                       const viennacl::matrix_base<ScalarType, F1>,
+                                                       viennacl::op_trans> & d_mat,
+                           viennacl::matrix_base<ScalarType, F2> & result)
+      {
+        detail::csr_prod_dense(detail::extract_raw_pointer<ScalarType>(sp_mat.handle()),
+                               detail::extract_raw_pointer<unsigned int>(sp_mat.handle1()),
+                               detail::extract_raw_pointer<unsigned int>(sp_mat.handle2()),
+                               detail::make_strided_view(d_mat.lhs(), true),
+                               detail::make_strided_view(result));
+      }
+
+      namespace detail
+      {
+        /** @brief Symbolic phase of the sparse matrix-matrix product: Writes the number of nonzeros in each row of C = A * B to C_row_nnz */
+        inline void csr_prod_csr_symbolic(unsigned int const * A_row_buffer, unsigned int const * A_col_buffer, std::size_t A_size1,
+                                          unsigned int const * B_row_buffer, unsigned int const * B_col_buffer, std::size_t B_size2,
+                                          unsigned int * C_row_nnz)
+        {
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel if (A_row_buffer[A_size1] > 10000)
+#endif
+          {
+            // marker[j] holds the last row of C in which column j was encountered
+            std::vector<unsigned int> marker(B_size2, static_cast<unsigned int>(A_size1));
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp for
+#endif
+            for (long row = 0; row < static_cast<long>(A_size1); ++row)
+            {
+              unsigned int row_nnz = 0;
+              for (unsigned int i = A_row_buffer[row]; i < A_row_buffer[row+1]; ++i)
+              {
+                unsigned int k = A_col_buffer[i];
+                for (unsigned int j = B_row_buffer[k]; j < B_row_buffer[k+1]; ++j)
+                {
+                  unsigned int col = B_col_buffer[j];
+                  if (marker[col] != static_cast<unsigned int>(row))
+                  {
+                    marker[col] = static_cast<unsigned int>(row);
+                    ++row_nnz;
+                  }
+                }
+              }
+              C_row_nnz[row] = row_nnz;
+            }
+          }
+        }
+
+        /** @brief Numeric phase of the sparse matrix-matrix product: Fills the column indices (sorted within each row) and the entries of C = A * B, for which the row array is already set up. Rows padded for alignment are filled up with zeros. */
+        template <typename ScalarType>
+        void csr_prod_csr_numeric(ScalarType const * A_elements, unsigned int const * A_row_buffer, unsigned int const * A_col_buffer, std::size_t A_size1,
+                                  ScalarType const * B_elements, unsigned int const * B_row_buffer, unsigned int const * B_col_buffer, std::size_t B_size2,
+                                  ScalarType       * C_elements, unsigned int const * C_row_buffer, unsigned int       * C_col_buffer)
+        {
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel if (A_row_buffer[A_size1] > 10000)
+#endif
+          {
+            // dense accumulator for the current row of C:
+            std::vector<ScalarType>   row_values(B_size2);
+            std::vector<unsigned int> marker(B_size2, static_cast<unsigned int>(A_size1));
+
+#ifdef VIENNACL_WITH_OPENMP
+            #pragma omp for
+#endif
+            for (long row = 0; row < static_cast<long>(A_size1); ++row)
+            {
+              unsigned int * row_cols = C_col_buffer + C_row_buffer[row];
+              unsigned int row_nnz = 0;
+              for (unsigned int i = A_row_buffer[row]; i < A_row_buffer[row+1]; ++i)
+              {
+                unsigned int k = A_col_buffer[i];
+                ScalarType A_entry = A_elements[i];
+                for (unsigned int j = B_row_buffer[k]; j < B_row_buffer[k+1]; ++j)
+                {
+                  unsigned int col = B_col_buffer[j];
+                  if (marker[col] != static_cast<unsigned int>(row))
+                  {
+                    marker[col] = static_cast<unsigned int>(row);
+                    row_cols[row_nnz++] = col;
+                    row_values[col] = A_entry * B_elements[j];
+                  }
+                  else
+                    row_values[col] += A_entry * B_elements[j];
+                }
+              }
+
+              std::sort(row_cols, row_cols + row_nnz);
+              ScalarType * row_entries = C_elements + C_row_buffer[row];
+              for (unsigned int i = 0; i < row_nnz; ++i)
+                row_entries[i] = row_values[row_cols[i]];
+
+              // padding due to alignment:
+              for (unsigned int i = row_nnz; i < C_row_buffer[row+1] - C_row_buffer[row]; ++i)
+              {
+                row_cols[i]    = 0;
+                row_entries[i] = 0;
+              }
+            }
+          }
+        }
+      }
+
+      /** @brief Carries out the sparse matrix-matrix product C = A * B with compressed_matrix operands
+      *
+      * Implementation of the convenience expression C = prod(A, B). The product is computed in two passes:
+      * The first (symbolic) pass determines the number of nonzeros in each row of C, the second (numeric) pass computes the column indices and the entries.
+      * The result is stored in main memory.
+      *
+      * @param A    The left hand side sparse matrix
+      * @param B    The right hand side sparse matrix
+      * @param C    The result matrix. Must not be identical to A or B.
+      */
+      template<class ScalarType, unsigned int ALIGNMENT_A, unsigned int ALIGNMENT_B, unsigned int ALIGNMENT_C>
+      void prod_impl(const viennacl::compressed_matrix<ScalarType, ALIGNMENT_A> & A,
+                     const viennacl::compressed_matrix<ScalarType, ALIGNMENT_B> & B,
+                           viennacl::compressed_matrix<ScalarType, ALIGNMENT_C> & C)
+      {
+        ScalarType   const * A_elements   = detail::extract_raw_pointer<ScalarType>(A.handle());
+        unsigned int const * A_row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+        unsigned int const * A_col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+
+        ScalarType   const * B_elements   = detail::extract_raw_pointer<ScalarType>(B.handle());
+        unsigned int const * B_row_buffer = detail::extract_raw_pointer<unsigned int>(B.handle1());
+        unsigned int const * B_col_buffer = detail::extract_raw_pointer<unsigned int>(B.handle2());
+
+        // symbolic pass: row lengths, then exclusive scan to obtain the row array of C
+        std::vector<unsigned int> C_row_buffer(A.size1() + 1);
+        detail::csr_prod_csr_symbolic(A_row_buffer, A_col_buffer, A.size1(),
+                                      B_row_buffer, B_col_buffer, B.size2(),
+                                      &(C_row_buffer[1]));
+        C_row_buffer[0] = 0;
+        for (std::size_t row = 0; row < A.size1(); ++row)
+          C_row_buffer[row+1] = C_row_buffer[row] + viennacl::tools::roundUpToNextMultiple<unsigned int>(C_row_buffer[row+1], ALIGNMENT_C);
+
+        std::size_t C_nnz = C_row_buffer[A.size1()];
+        if (C_nnz == 0) // keep nonzero array sizes by an explicit zero entry, cf. compressed_matrix::resize()
+        {
+          std::vector<unsigned int> C_col_buffer(1);
+          std::vector<ScalarType>   C_elements(1);
+          for (std::size_t row = 1; row <= A.size1(); ++row)
+            C_row_buffer[row] = 1;
+
+          C.handle1().switch_active_handle_id(viennacl::MAIN_MEMORY);
+          C.handle2().switch_active_handle_id(viennacl::MAIN_MEMORY);
+          C.handle().switch_active_handle_id(viennacl::MAIN_MEMORY);
+          C.set(&(C_row_buffer[0]), &(C_col_buffer[0]), &(C_elements[0]), A.size1(), B.size2(), 1);
+          return;
+        }
+
+        // allocate C in main memory. Column indices and entries are written directly by the numeric pass:
+        C.handle1().switch_active_handle_id(viennacl::MAIN_MEMORY);
+        C.handle2().switch_active_handle_id(viennacl::MAIN_MEMORY);
+        C.handle().switch_active_handle_id(viennacl::MAIN_MEMORY);
+        C.set(&(C_row_buffer[0]), NULL, NULL, A.size1(), B.size2(), C_nnz);
+
+        detail::csr_prod_csr_numeric(A_elements, A_row_buffer, A_col_buffer, A.size1(),
+                                     B_elements, B_row_buffer, B_col_buffer, B.size2(),
+                                     detail::extract_raw_pointer<ScalarType>(C.handle()),
+                                     detail::extract_raw_pointer<unsigned int>(C.handle1()),
+                                     detail::extract_raw_pointer<unsigned int>(C.handle2()));
+      }
+
       //
       // Triangular solve for compressed_matrix, A \ b
       //
@@ -0,0 +1,474 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_SVD_HPP
+#define VIENNACL_LINALG_HOST_BASED_SVD_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/svd.hpp
+    @brief Implementation of the singular value decomposition A = U Sigma V^T for dense matrices in host memory.
+
+    The SVD is computed in two stages: A is reduced to upper bidiagonal form B = U_1^T A V_1 by a blocked Householder bidiagonalization,
+    then B is diagonalized by the implicitly shifted QR algorithm of Golub and Kahan. The Givens rotations of each QR sweep are collected and then applied to U and V in one pass over blocks of their rows.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "viennacl/forwards.h"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
+#include "viennacl/linalg/host_based/qr.hpp"
+
+/** @brief Number of rows and columns reduced per panel in the blocked bidiagonalization. The trailing matrix is updated once per panel by two matrix-matrix products. */
+#ifndef VIENNACL_SVD_BLOCK_SIZE
+  #define VIENNACL_SVD_BLOCK_SIZE 32
+#endif
+
+/** @brief Maximum number of implicit QR sweeps per singular value */
+#ifndef VIENNACL_SVD_MAX_ITERATIONS
+  #define VIENNACL_SVD_MAX_ITERATIONS 75
+#endif
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief Returns sqrt(a^2 + b^2) without destructive underflow or overflow */
+        template <typename NumericT>
+        NumericT svd_pythag(NumericT a, NumericT b)
+        {
+          NumericT abs_a = std::fabs(a);
+          NumericT abs_b = std::fabs(b);
+          if (abs_a > abs_b)
+            return abs_a * std::sqrt(NumericT(1) + (abs_b / abs_a) * (abs_b / abs_a));
+          return (abs_b == 0) ? NumericT(0) : abs_b * std::sqrt(NumericT(1) + (abs_a / abs_b) * (abs_a / abs_b));
+        }
+
+        /** @brief Reduces the first nb rows and columns of A (m x n, m >= n) to upper bidiagonal form and returns the matrices X and Y for the update of the trailing matrix.
+        *
+        * The reflectors are computed one after another from the partially updated matrix, as in LAPACK's xLABRD. The trailing matrix A(nb:m, nb:n) is not touched,
+        * it has to be updated by the caller with A_22 -= V Y^T + X W^T, where V and W are the left and right reflectors stored in A.
+        * On return, A(i,i) and A(i,i+1) of the panel hold the ones of the reflectors, the entries of the bidiagonal matrix are in d and e.
+        *
+        * @param A      The trailing matrix. The reflectors are written to A.
+        * @param nb     Number of rows and columns to reduce
+        * @param d      Receives the nb diagonal entries
+        * @param e      Receives the nb superdiagonal entries (if available)
+        * @param tauq   Receives the scalars beta of the left reflectors
+        * @param taup   Receives the scalars beta of the right reflectors
+        * @param X      Buffer of size m x nb
+        * @param Y      Buffer of size n x nb
+        */
+        template <typename NumericT>
+        void svd_bidiag_panel(strided_matrix_view<NumericT> const & A, std::size_t nb,
+                              NumericT * d, NumericT * e, NumericT * tauq, NumericT * taup,
+                              strided_matrix_view<NumericT> const & X, strided_matrix_view<NumericT> const & Y)
+        {
+          std::size_t m = A.size1;
+          std::size_t n = A.size2;
+
+          std::vector<NumericT> temp_buffer(nb + 1);
+          strided_matrix_view<NumericT> temp(&(temp_buffer[0]), nb + 1, 1, 1, 1);
+
+          for (std::size_t i = 0; i < nb; ++i)
+          {
+            strided_matrix_view<NumericT> a_col = A.sub(i, i, m - i, 1);
+
+            // Update column i: A(i:m, i) -= A(i:m, 0:i) Y(i, 0:i)^T + X(i:m, 0:i) A(0:i, i)
+            gemv(const_view(A.sub(i, 0, m - i, i)), const_view(Y.sub(i, 0, 1, i).trans()), a_col, NumericT(-1), NumericT(1));
+            gemv(const_view(X.sub(i, 0, m - i, i)), const_view(A.sub(0, i, i, 1)),         a_col, NumericT(-1), NumericT(1));
+
+            tauq[i] = qr_householder_vector(a_col);
+            d[i] = A(i, i);
+            A(i, i) = 1;
+
+            if (i + 1 >= n)
+            {
+              taup[i] = 0;
+              continue;
+            }
+
+            std::size_t n_right = n - i - 1;
+            strided_matrix_view<NumericT> y_col = Y.sub(i + 1, i, n_right, 1);
+
+            // Y(i+1:n, i) = tauq * (A(i:m, i+1:n)^T - Y(i+1:n, 0:i) A(i:m, 0:i)^T - A(0:i, i+1:n)^T X(i:m, 0:i)^T) v:
+            gemv(const_view(A.sub(i, i + 1, m - i, n_right)).trans(), const_view(a_col), y_col, NumericT(1), NumericT(0));
+            gemv(const_view(A.sub(i, 0, m - i, i)).trans(), const_view(a_col), temp.sub(0, 0, i, 1), NumericT(1), NumericT(0));
+            gemv(const_view(Y.sub(i + 1, 0, n_right, i)), const_view(temp.sub(0, 0, i, 1)), y_col, NumericT(-1), NumericT(1));
+            gemv(const_view(X.sub(i, 0, m - i, i)).trans(), const_view(a_col), temp.sub(0, 0, i, 1), NumericT(1), NumericT(0));
+            gemv(const_view(A.sub(0, i + 1, i, n_right)).trans(), const_view(temp.sub(0, 0, i, 1)), y_col, NumericT(-1), NumericT(1));
+            for (std::size_t k = 0; k < n_right; ++k)
+              y_col(k, 0) *= tauq[i];
+
+            // Update row i: A(i, i+1:n) -= Y(i+1:n, 0:i+1) A(i, 0:i+1)^T + A(0:i, i+1:n)^T X(i, 0:i)^T
+            strided_matrix_view<NumericT> a_row = A.sub(i, i + 1, 1, n_right).trans();
+            gemv(const_view(Y.sub(i + 1, 0, n_right, i + 1)), const_view(A.sub(i, 0, 1, i + 1).trans()), a_row, NumericT(-1), NumericT(1));
+            gemv(const_view(A.sub(0, i + 1, i, n_right)).trans(), const_view(X.sub(i, 0, 1, i).trans()), a_row, NumericT(-1), NumericT(1));
+
+            taup[i] = qr_householder_vector(a_row);
+            e[i] = A(i, i + 1);
+            A(i, i + 1) = 1;
+
+            // X(i+1:m, i) = taup * (A(i+1:m, i+1:n) - A(i+1:m, 0:i+1) Y(i+1:n, 0:i+1)^T - X(i+1:m, 0:i) A(0:i, i+1:n)) w:
+            strided_matrix_view<NumericT> x_col = X.sub(i + 1, i, m - i - 1, 1);
+            gemv(const_view(A.sub(i + 1, i + 1, m - i - 1, n_right)), const_view(a_row), x_col, NumericT(1), NumericT(0));
+            gemv(const_view(Y.sub(i + 1, 0, n_right, i + 1)).trans(), const_view(a_row), temp.sub(0, 0, i + 1, 1), NumericT(1), NumericT(0));
+            gemv(const_view(A.sub(i + 1, 0, m - i - 1, i + 1)), const_view(temp.sub(0, 0, i + 1, 1)), x_col, NumericT(-1), NumericT(1));
+            gemv(const_view(A.sub(0, i + 1, i, n_right)), const_view(a_row), temp.sub(0, 0, i, 1), NumericT(1), NumericT(0));
+            gemv(const_view(X.sub(i + 1, 0, m - i - 1, i)), const_view(temp.sub(0, 0, i, 1)), x_col, NumericT(-1), NumericT(1));
+            for (std::size_t k = 0; k < m - i - 1; ++k)
+              x_col(k, 0) *= taup[i];
+          }
+        }
+
+        /** @brief Blocked Householder bidiagonalization A = U_1 B V_1^T of A (m x n, m >= n) in host memory.
+        *
+        * The left reflectors are stored below the diagonal of A as in inplace_qr(), the right reflectors right of the superdiagonal.
+        * The diagonal and the superdiagonal of B are written to d (size n) and e (size n-1).
+        */
+        template <typename NumericT>
+        void svd_bidiagonalize(strided_matrix_view<NumericT> const & A,
+                               std::vector<NumericT> & d, std::vector<NumericT> & e,
+                               std::vector<NumericT> & tauq, std::vector<NumericT> & taup)
+        {
+          std::size_t m = A.size1;
+          std::size_t n = A.size2;
+          const std::size_t block_size = VIENNACL_SVD_BLOCK_SIZE;
+
+          d.resize(n);
+          e.resize(n);
+          tauq.resize(n);
+          taup.resize(n);
+
+          for (std::size_t j = 0; j < n; j += block_size)
+          {
+            std::size_t nb = std::min(block_size, n - j);
+
+            std::vector<NumericT> X_buffer((m - j) * nb);
+            std::vector<NumericT> Y_buffer((n - j) * nb);
+            strided_matrix_view<NumericT> X(&(X_buffer[0]), m - j, nb, nb, 1);
+            strided_matrix_view<NumericT> Y(&(Y_buffer[0]), n - j, nb, nb, 1);
+
+            strided_matrix_view<NumericT> A_j = A.sub(j, j, m - j, n - j);
+            svd_bidiag_panel(A_j, nb, &(d[j]), &(e[j]), &(tauq[j]), &(taup[j]), X, Y);
+
+            // A_22 -= V Y^T + X W^T:
+            if (j + nb < n)
+            {
+              strided_matrix_view<NumericT> A_22 = A_j.sub(nb, nb, m - j - nb, n - j - nb);
+              gemm(const_view(A_j.sub(nb, 0, m - j - nb, nb)), const_view(Y.sub(nb, 0, n - j - nb, nb)).trans(), A_22, NumericT(-1), NumericT(1));
+              gemm(const_view(X.sub(nb, 0, m - j - nb, nb)), const_view(A_j.sub(0, nb, nb, n - j - nb)), A_22, NumericT(-1), NumericT(1));
+            }
+
+            for (std::size_t i = j; i < j + nb; ++i)
+            {
+              A(i, i) = d[i];
+              if (i + 1 < n)
+                A(i, i + 1) = e[i];
+            }
+          }
+
+          e.resize(n > 0 ? n - 1 : 0);
+        }
+
+        /** @brief Applies the sequence of Givens rotations (col1[t], col2[t], c[t], s[t]) to the columns of Q.
+        *
+        * Rows are processed independently, so Q is split into blocks of rows which are distributed among the threads. Within a block, each rotation is applied to all rows at once,
+        * which runs with unit stride if Q is stored column-major.
+        */
+        template <typename NumericT>
+        void svd_apply_givens(strided_matrix_view<NumericT> const & Q,
+                              std::vector<std::size_t> const & col1, std::vector<std::size_t> const & col2,
+                              std::vector<NumericT> const & c, std::vector<NumericT> const & s)
+        {
+          std::size_t num_rotations = c.size();
+          const std::size_t block_size = 128;
+
+          if (num_rotations == 0 || Q.size1 == 0)
+            return;
+
+          long num_blocks = static_cast<long>((Q.size1 - 1) / block_size + 1);
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for if (Q.size1 * num_rotations > 5000)
+#endif
+          for (long block = 0; block < num_blocks; ++block)
+          {
+            std::size_t row_start = static_cast<std::size_t>(block) * block_size;
+            std::size_t rows = std::min(block_size, Q.size1 - row_start);
+
+            for (std::size_t t = 0; t < num_rotations; ++t)
+            {
+              NumericT * q1 = Q.data + row_start * Q.row_inc + col1[t] * Q.col_inc;
+              NumericT * q2 = Q.data + row_start * Q.row_inc + col2[t] * Q.col_inc;
+              NumericT c_t = c[t];
+              NumericT s_t = s[t];
+              if (Q.row_inc == 1)
+              {
+                std::size_t r = 0;
+                for (; r + 4 <= rows; r += 4) // unrolled for instruction-level parallelism
+                {
+                  NumericT y0 = q1[r],     z0 = q2[r];
+                  NumericT y1 = q1[r + 1], z1 = q2[r + 1];
+                  NumericT y2 = q1[r + 2], z2 = q2[r + 2];
+                  NumericT y3 = q1[r + 3], z3 = q2[r + 3];
+                  q1[r]     = y0 * c_t + z0 * s_t;  q2[r]     = z0 * c_t - y0 * s_t;
+                  q1[r + 1] = y1 * c_t + z1 * s_t;  q2[r + 1] = z1 * c_t - y1 * s_t;
+                  q1[r + 2] = y2 * c_t + z2 * s_t;  q2[r + 2] = z2 * c_t - y2 * s_t;
+                  q1[r + 3] = y3 * c_t + z3 * s_t;  q2[r + 3] = z3 * c_t - y3 * s_t;
+                }
+                for (; r < rows; ++r)
+                {
+                  NumericT y = q1[r];
+                  NumericT z = q2[r];
+                  q1[r] = y * c_t + z * s_t;
+                  q2[r] = z * c_t - y * s_t;
+                }
+              }
+              else
+              {
+                for (std::size_t r = 0; r < rows; ++r)
+                {
+                  NumericT y = q1[r * Q.row_inc];
+                  NumericT z = q2[r * Q.row_inc];
+                  q1[r * Q.row_inc] = y * c_t + z * s_t;
+                  q2[r * Q.row_inc] = z * c_t - y * s_t;
+                }
+              }
+            }
+          }
+        }
+
+        /** @brief Diagonalizes the upper bidiagonal matrix with diagonal d and superdiagonal e by implicitly shifted QR sweeps (Golub-Kahan). The rotations are accumulated in the first d.size() columns of U and in V.
+        *
+        * On return, d holds the singular values (nonnegative, in no particular order).
+        */
+        template <typename NumericT>
+        void svd_bidiag_qr(std::vector<NumericT> & d, std::vector<NumericT> const & e,
+                           strided_matrix_view<NumericT> const & U, strided_matrix_view<NumericT> const & V)
+        {
+          long n = static_cast<long>(d.size());
+
+          // superdiagonal: f[i] couples d[i-1] and d[i]
+          std::vector<NumericT> f(d.size());
+          for (long i = 1; i < n; ++i)
+            f[i] = e[i - 1];
+
+          NumericT anorm = 0;
+          for (long i = 0; i < n; ++i)
+            anorm = std::max(anorm, std::fabs(d[i]) + std::fabs(f[i]));
+
+          std::vector<std::size_t> U_col1, U_col2, V_col1, V_col2;
+          std::vector<NumericT>    U_c, U_s, V_c, V_s;
+
+          for (long k = n - 1; k >= 0; --k)
+          {
+            for (std::size_t iter = 0; ; ++iter)
+            {
+              // find the largest unreduced block d[l:k] (f[0] is always zero):
+              bool cancel = true;
+              long l = k;
+              for (; l >= 0; --l)
+              {
+                if (std::fabs(f[l]) + anorm == anorm)
+                {
+                  cancel = false;
+                  break;
+                }
+                if (std::fabs(d[l - 1]) + anorm == anorm)
+                  break;
+              }
+
+              // d[l-1] is negligible: chase f[l] out by rotations from the left
+              if (cancel)
+              {
+                U_col1.clear(); U_col2.clear(); U_c.clear(); U_s.clear();
+
+                NumericT c = 0;
+                NumericT s = 1;
+                for (long i = l; i <= k; ++i)
+                {
+                  NumericT g = s * f[i];
+                  f[i] = c * f[i];
+                  if (std::fabs(g) + anorm == anorm)
+                    break;
+                  NumericT h = svd_pythag(g, d[i]);
+                  c = d[i] / h;
+                  s = -g / h;
+                  d[i] = h;
+
+                  U_col1.push_back(static_cast<std::size_t>(l - 1)); U_col2.push_back(static_cast<std::size_t>(i));
+                  U_c.push_back(c); U_s.push_back(s);
+                }
+                svd_apply_givens(U, U_col1, U_col2, U_c, U_s);
+              }
+
+              NumericT z = d[k];
+              if (l == k) // converged
+              {
+                if (z < 0)
+                {
+                  d[k] = -z;
+                  for (std::size_t i = 0; i < V.size1; ++i)
+                    V(i, static_cast<std::size_t>(k)) = -V(i, static_cast<std::size_t>(k));
+                }
+                break;
+              }
+
+              if (iter == VIENNACL_SVD_MAX_ITERATIONS)
+                throw "ViennaCL: No convergence of the implicit QR iteration in SVD!";
+
+              // shift from the trailing 2x2 block:
+              NumericT x = d[l];
+              NumericT y = d[k - 1];
+              NumericT g = f[k - 1];
+              NumericT h = f[k];
+              NumericT shift_f = ((y - z) * (y + z) + (g - h) * (g + h)) / (NumericT(2) * h * y);
+              g = svd_pythag(shift_f, NumericT(1));
+              shift_f = ((x - z) * (x + z) + h * ((y / (shift_f + (shift_f >= 0 ? g : -g))) - h)) / x;
+
+              U_col1.clear(); U_col2.clear(); U_c.clear(); U_s.clear();
+              V_col1.clear(); V_col2.clear(); V_c.clear(); V_s.clear();
+
+              // QR sweep, chasing the bulge from d[l] down to d[k]:
+              NumericT c = 1;
+              NumericT s = 1;
+              for (long j = l; j < k; ++j)
+              {
+                long i = j + 1;
+                g = f[i];
+                y = d[i];
+                h = s * g;
+                g = c * g;
+                z = svd_pythag(shift_f, h);
+                f[j] = z;
+                c = shift_f / z;
+                s = h / z;
+                shift_f = x * c + g * s;
+                g = g * c - x * s;
+                h = y * s;
+                y *= c;
+                V_col1.push_back(static_cast<std::size_t>(j)); V_col2.push_back(static_cast<std::size_t>(i));
+                V_c.push_back(c); V_s.push_back(s);
+
+                z = svd_pythag(shift_f, h);
+                d[j] = z;
+                if (z > 0)
+                {
+                  c = shift_f / z;
+                  s = h / z;
+                }
+                shift_f = c * g + s * y;
+                x = c * y - s * g;
+                U_col1.push_back(static_cast<std::size_t>(j)); U_col2.push_back(static_cast<std::size_t>(i));
+                U_c.push_back(c); U_s.push_back(s);
+              }
+              f[l] = 0;
+              f[k] = shift_f;
+              d[k] = x;
+
+              svd_apply_givens(V, V_col1, V_col2, V_c, V_s);
+              svd_apply_givens(U, U_col1, U_col2, U_c, U_s);
+            }
+          }
+        }
+
+        /** @brief Computes the singular value decomposition A = U Sigma V^T in host memory.
+        *
+        * @param A      The m x n matrix. Overwritten with intermediate results.
+        * @param U      Receives the left singular vectors (m x m)
+        * @param V      Receives the right singular vectors (n x n)
+        * @param sigma  Receives the min(m,n) singular values in descending order
+        */
+        template <typename NumericT>
+        void svd(strided_matrix_view<NumericT> const & A,
+                 strided_matrix_view<NumericT> const & U,
+                 strided_matrix_view<NumericT> const & V,
+                 std::vector<NumericT> & sigma)
+        {
+          std::size_t m = A.size1;
+          std::size_t n = A.size2;
+
+          if (m < n) // A^T = V Sigma U^T
+          {
+            svd(A.trans(), V, U, sigma);
+            return;
+          }
+
+          if (n == 0) // nothing to decompose, U is the identity:
+          {
+            sigma.clear();
+            for (std::size_t i = 0; i < m; ++i)
+              for (std::size_t j = 0; j < m; ++j)
+                U(i, j) = (i == j) ? NumericT(1) : NumericT(0);
+            return;
+          }
+
+          std::vector<NumericT> e, tauq, taup;
+          svd_bidiagonalize(A, sigma, e, tauq, taup);
+
+          // U and V are accumulated in column-major buffers, so that the Givens rotations run along contiguous columns:
+          std::vector<NumericT> U_buffer(m * m);
+          std::vector<NumericT> V_buffer(n * n);
+          strided_matrix_view<NumericT> U_work(&(U_buffer[0]), m, m, 1, m);
+          strided_matrix_view<NumericT> V_work(&(V_buffer[0]), n, n, 1, n);
+
+          // U = U_1, V = V_1 from the block reflectors:
+          for (std::size_t i = 0; i < m; ++i)
+            U_work(i, i) = 1;
+          qr_apply_Q(const_view(A), tauq, U_work, false);
+
+          for (std::size_t i = 0; i < n; ++i)
+            V_work(i, i) = 1;
+          if (n > 1) // the right reflectors are stored below the 'diagonal' of (A^T)(1:n, 0:n-1)
+            qr_apply_Q(const_view(A.trans().sub(1, 0, n - 1, n - 1)), taup, V_work.sub(1, 1, n - 1, n - 1), false);
+
+          svd_bidiag_qr(sigma, e, U_work, V_work);
+
+          // sort in descending order:
+          for (std::size_t i = 0; i < n; ++i)
+          {
+            std::size_t i_max = static_cast<std::size_t>(std::max_element(sigma.begin() + static_cast<long>(i), sigma.end()) - sigma.begin());
+            if (i_max != i)
+            {
+              std::swap(sigma[i], sigma[i_max]);
+              std::swap_ranges(&U_work(0, i), &U_work(0, i) + m, &U_work(0, i_max));
+              std::swap_ranges(&V_work(0, i), &V_work(0, i) + n, &V_work(0, i_max));
+            }
+          }
+
+          for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = 0; j < m; ++j)
+              U(i, j) = U_work(i, j);
+          for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+              V(i, j) = V_work(i, j);
+        }
+
+      } //namespace detail
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
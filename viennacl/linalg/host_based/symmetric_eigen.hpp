@@ -0,0 +1,306 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_SYMMETRIC_EIGEN_HPP
+#define VIENNACL_LINALG_HOST_BASED_SYMMETRIC_EIGEN_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/symmetric_eigen.hpp
+    @brief Implementation of the eigendecomposition A = Q Lambda Q^T of dense symmetric matrices in host memory.
+
+    A is reduced to tridiagonal form T = Q_1^T A Q_1 by a blocked Householder tridiagonalization. The eigenvalues and eigenvectors of T are computed by the
+    implicit QL algorithm (tql2), whose Givens rotations are applied to the reflectors accumulated in Q_1.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "viennacl/forwards.h"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/gemm.hpp"
+#include "viennacl/linalg/host_based/qr.hpp"
+#include "viennacl/linalg/host_based/svd.hpp"
+
+/** @brief Number of columns reduced per panel in the blocked tridiagonalization. The trailing matrix is updated once per panel by two matrix-matrix products. */
+#ifndef VIENNACL_TRIDIAG_BLOCK_SIZE
+  #define VIENNACL_TRIDIAG_BLOCK_SIZE 32
+#endif
+
+/** @brief Maximum number of implicit QL iterations per eigenvalue */
+#ifndef VIENNACL_TQL2_MAX_ITERATIONS
+  #define VIENNACL_TQL2_MAX_ITERATIONS 50
+#endif
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+      namespace detail
+      {
+        /** @brief Reduces the first nb columns of the symmetric matrix A (n x n) to tridiagonal form and returns the matrix W for the update of the trailing matrix (LAPACK's xLATRD, lower triangle).
+        *
+        * The trailing matrix A(nb:n, nb:n) is not touched, it has to be updated by the caller with A_22 -= V W^T + W V^T, where V are the reflectors stored in A.
+        * The trailing matrix is referenced in full, so both triangles of A need to be set. On return, A(i+1,i) holds the one of reflector i, the subdiagonal entries are in e.
+        *
+        * @param A      The trailing matrix. The reflectors are written below the subdiagonal of A.
+        * @param nb     Number of columns to reduce
+        * @param e      Receives the nb subdiagonal entries (if available)
+        * @param tau    Receives the scalars beta of the reflectors
+        * @param W      Buffer of size n x nb
+        */
+        template <typename NumericT>
+        void tridiag_panel(strided_matrix_view<NumericT> const & A, std::size_t nb,
+                           NumericT * e, NumericT * tau,
+                           strided_matrix_view<NumericT> const & W)
+        {
+          std::size_t n = A.size1;
+
+          std::vector<NumericT> temp_buffer(nb + 1);
+          strided_matrix_view<NumericT> temp(&(temp_buffer[0]), nb + 1, 1, 1, 1);
+
+          for (std::size_t i = 0; i < nb; ++i)
+          {
+            // Update column i: A(i:n, i) -= A(i:n, 0:i) W(i, 0:i)^T + W(i:n, 0:i) A(i, 0:i)^T
+            strided_matrix_view<NumericT> a_col = A.sub(i, i, n - i, 1);
+            gemv(const_view(A.sub(i, 0, n - i, i)), const_view(W.sub(i, 0, 1, i).trans()), a_col, NumericT(-1), NumericT(1));
+            gemv(const_view(W.sub(i, 0, n - i, i)), const_view(A.sub(i, 0, 1, i).trans()), a_col, NumericT(-1), NumericT(1));
+
+            if (i + 1 >= n)
+            {
+              tau[i] = 0;
+              continue;
+            }
+
+            std::size_t n_below = n - i - 1;
+            strided_matrix_view<NumericT> v = A.sub(i + 1, i, n_below, 1);
+
+            tau[i] = qr_householder_vector(v);
+            e[i] = A(i + 1, i);
+            A(i + 1, i) = 1;
+
+            // W(i+1:n, i) = tau * (A(i+1:n, i+1:n) - V W^T - W V^T) v:
+            strided_matrix_view<NumericT> w = W.sub(i + 1, i, n_below, 1);
+            gemv(const_view(A.sub(i + 1, i + 1, n_below, n_below)), const_view(v), w, NumericT(1), NumericT(0));
+            gemv(const_view(W.sub(i + 1, 0, n_below, i)).trans(), const_view(v), temp.sub(0, 0, i, 1), NumericT(1), NumericT(0));
+            gemv(const_view(A.sub(i + 1, 0, n_below, i)), const_view(temp.sub(0, 0, i, 1)), w, NumericT(-1), NumericT(1));
+            gemv(const_view(A.sub(i + 1, 0, n_below, i)).trans(), const_view(v), temp.sub(0, 0, i, 1), NumericT(1), NumericT(0));
+            gemv(const_view(W.sub(i + 1, 0, n_below, i)), const_view(temp.sub(0, 0, i, 1)), w, NumericT(-1), NumericT(1));
+
+            // w = tau * w - (tau^2 / 2) (w^T v) v:
+            NumericT alpha = 0;
+            for (std::size_t k = 0; k < n_below; ++k)
+            {
+              w(k, 0) *= tau[i];
+              alpha += w(k, 0) * v(k, 0);
+            }
+            alpha *= NumericT(-0.5) * tau[i];
+            for (std::size_t k = 0; k < n_below; ++k)
+              w(k, 0) += alpha * v(k, 0);
+          }
+        }
+
+        /** @brief Blocked Householder tridiagonalization A = Q_1 T Q_1^T of a symmetric matrix A in host memory.
+        *
+        * Both triangles of A are referenced. The reflectors are stored below the subdiagonal of A, the diagonal and the subdiagonal of T are written to d (size n) and e (size n-1).
+        */
+        template <typename NumericT>
+        void tridiagonalize(strided_matrix_view<NumericT> const & A,
+                            std::vector<NumericT> & d, std::vector<NumericT> & e, std::vector<NumericT> & tau)
+        {
+          std::size_t n = A.size1;
+          const std::size_t block_size = VIENNACL_TRIDIAG_BLOCK_SIZE;
+
+          d.resize(n);
+          e.resize(n);
+          tau.resize(n);
+
+          for (std::size_t j = 0; j < n; j += block_size)
+          {
+            std::size_t nb = std::min(block_size, n - j);
+
+            std::vector<NumericT> W_buffer((n - j) * nb);
+            strided_matrix_view<NumericT> W(&(W_buffer[0]), n - j, nb, nb, 1);
+
+            strided_matrix_view<NumericT> A_j = A.sub(j, j, n - j, n - j);
+            tridiag_panel(A_j, nb, &(e[j]), &(tau[j]), W);
+
+            // A_22 -= V W^T + W V^T (both triangles):
+            if (j + nb < n)
+            {
+              strided_matrix_view<NumericT> A_22 = A_j.sub(nb, nb, n - j - nb, n - j - nb);
+              gemm(const_view(A_j.sub(nb, 0, n - j - nb, nb)), const_view(W.sub(nb, 0, n - j - nb, nb)).trans(), A_22, NumericT(-1), NumericT(1));
+              gemm(const_view(W.sub(nb, 0, n - j - nb, nb)), const_view(A_j.sub(nb, 0, n - j - nb, nb)).trans(), A_22, NumericT(-1), NumericT(1));
+            }
+
+            for (std::size_t i = j; i < j + nb && i + 1 < n; ++i)
+              A(i + 1, i) = e[i];
+          }
+
+          for (std::size_t i = 0; i < n; ++i)
+            d[i] = A(i, i);
+          e.resize(n > 0 ? n - 1 : 0);
+        }
+
+        /** @brief Computes the eigenvalues and eigenvectors of the symmetric tridiagonal matrix with diagonal d and subdiagonal e by the implicit QL algorithm.
+        *
+        * Derived from the Algol procedure tql2 by Bowdler, Martin, Reinsch, and Wilkinson (Handbook for Auto. Comp., Vol. II - Linear Algebra) and the corresponding EISPACK routine.
+        * The rotations of each QL iteration are collected and applied to the columns of Q at once. On return, d holds the eigenvalues (in no particular order).
+        */
+        template <typename NumericT>
+        void tql2(std::vector<NumericT> & d, std::vector<NumericT> const & e_in, strided_matrix_view<NumericT> const & Q)
+        {
+          std::size_t n = d.size();
+
+          if (n == 0)
+            return;
+
+          // e[i] couples d[i] and d[i+1]:
+          std::vector<NumericT> e(n);
+          std::copy(e_in.begin(), e_in.end(), e.begin());
+          e[n - 1] = 0;
+
+          std::vector<std::size_t> col1, col2;
+          std::vector<NumericT>    cs, ss;
+
+          NumericT eps = std::numeric_limits<NumericT>::epsilon();
+          NumericT f = 0;
+          NumericT tst1 = 0;
+
+          for (std::size_t l = 0; l < n; ++l)
+          {
+            // Find small subdiagonal element
+            tst1 = std::max<NumericT>(tst1, std::fabs(d[l]) + std::fabs(e[l]));
+            std::size_t m = l;
+            while (m < n - 1 && std::fabs(e[m]) > eps * tst1)
+              ++m;
+
+            // If m == l, d[l] is an eigenvalue, otherwise iterate:
+            std::size_t iter = 0;
+            while (m > l && std::fabs(e[l]) > eps * tst1)
+            {
+              if (++iter > VIENNACL_TQL2_MAX_ITERATIONS)
+                throw "ViennaCL: No convergence of the implicit QL iteration in symmetric eigenvalue computation!";
+
+              // Compute implicit shift
+              NumericT g = d[l];
+              NumericT p = (d[l + 1] - g) / (NumericT(2) * e[l]);
+              NumericT r = svd_pythag(p, NumericT(1));
+              if (p < 0)
+                r = -r;
+
+              d[l] = e[l] / (p + r);
+              d[l + 1] = e[l] * (p + r);
+              NumericT dl1 = d[l + 1];
+              NumericT h = g - d[l];
+              for (std::size_t i = l + 2; i < n; ++i)
+                d[i] -= h;
+              f += h;
+
+              // Implicit QL transformation
+              col1.clear(); col2.clear(); cs.clear(); ss.clear();
+
+              p = d[m];
+              NumericT c = 1;
+              NumericT c2 = c;
+              NumericT c3 = c;
+              NumericT el1 = e[l + 1];
+              NumericT s = 0;
+              NumericT s2 = 0;
+              for (std::size_t i = m; i-- > l; )
+              {
+                c3 = c2;
+                c2 = c;
+                s2 = s;
+                g = c * e[i];
+                h = c * p;
+                r = svd_pythag(p, e[i]);
+                e[i + 1] = s * r;
+                s = e[i] / r;
+                c = p / r;
+                p = c * d[i] - s * g;
+                d[i + 1] = h + s * (c * g + s * d[i]);
+
+                // Q(:, i) = c Q(:, i) - s Q(:, i+1),  Q(:, i+1) = s Q(:, i) + c Q(:, i+1)
+                col1.push_back(i); col2.push_back(i + 1);
+                cs.push_back(c);   ss.push_back(-s);
+              }
+              p = -s * s2 * c3 * el1 * e[l] / dl1;
+              e[l] = s * p;
+              d[l] = c * p;
+
+              svd_apply_givens(Q, col1, col2, cs, ss);
+            }
+
+            d[l] = d[l] + f;
+            e[l] = 0;
+          }
+        }
+
+        /** @brief Computes the eigendecomposition A = Q Lambda Q^T of a symmetric matrix in host memory.
+        *
+        * @param A        The symmetric matrix (both triangles are referenced). Overwritten with intermediate results.
+        * @param Q        Receives the eigenvectors (columns)
+        * @param lambda   Receives the eigenvalues in ascending order
+        */
+        template <typename NumericT>
+        void symmetric_eigen(strided_matrix_view<NumericT> const & A,
+                             strided_matrix_view<NumericT> const & Q,
+                             std::vector<NumericT> & lambda)
+        {
+          std::size_t n = A.size1;
+
+          std::vector<NumericT> e, tau;
+          tridiagonalize(A, lambda, e, tau);
+
+          // Q is accumulated in a column-major buffer, so that the Givens rotations run along contiguous columns:
+          std::vector<NumericT> Q_buffer(n * n);
+          strided_matrix_view<NumericT> Q_work(&(Q_buffer[0]), n, n, 1, n);
+
+          for (std::size_t i = 0; i < n; ++i)
+            Q_work(i, i) = 1;
+          if (n > 1) // reflector i is stored below the 'diagonal' of A(1:n, 0:n-1)
+            qr_apply_Q(const_view(A.sub(1, 0, n - 1, n - 1)), tau, Q_work.sub(1, 1, n - 1, n - 1), false);
+
+          tql2(lambda, e, Q_work);
+
+          // sort in ascending order:
+          for (std::size_t i = 0; i < n; ++i)
+          {
+            std::size_t i_min = static_cast<std::size_t>(std::min_element(lambda.begin() + static_cast<long>(i), lambda.end()) - lambda.begin());
+            if (i_min != i)
+            {
+              std::swap(lambda[i], lambda[i_min]);
+              std::swap_ranges(&Q_work(0, i), &Q_work(0, i) + n, &Q_work(0, i_min));
+            }
+          }
+
+          for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+              Q(i, j) = Q_work(i, j);
+        }
+
+      } //namespace detail
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
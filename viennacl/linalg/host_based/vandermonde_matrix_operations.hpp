@@ -0,0 +1,79 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_VANDERMONDE_MATRIX_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_VANDERMONDE_MATRIX_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/vandermonde_matrix_operations.hpp
+    @brief Implementations of operations using vandermonde_matrix on the CPU using a single thread or OpenMP.
+*/
+
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+    namespace host_based
+    {
+
+      /** @brief Carries out matrix-vector multiplication with a vandermonde_matrix
+      *
+      * Entry i of the result is the polynomial with coefficients 'vec' evaluated at the i-th node of the matrix, computed with Horner's scheme.
+      *
+      * @param mat    The matrix
+      * @param vec    The vector
+      * @param result The result vector
+      */
+      template<class SCALARTYPE, unsigned int ALIGNMENT>
+      void prod_impl(const viennacl::vandermonde_matrix<SCALARTYPE, ALIGNMENT> & mat,
+                     const viennacl::vector_base<SCALARTYPE> & vec,
+                           viennacl::vector_base<SCALARTYPE> & result)
+      {
+        SCALARTYPE const * nodes = detail::extract_raw_pointer<SCALARTYPE>(mat.handle());
+        SCALARTYPE const * x     = detail::extract_raw_pointer<SCALARTYPE>(vec);
+        SCALARTYPE       * y     = detail::extract_raw_pointer<SCALARTYPE>(result);
+
+        std::size_t x_start = viennacl::traits::start(vec);
+        std::size_t x_inc   = viennacl::traits::stride(vec);
+        std::size_t y_start = viennacl::traits::start(result);
+        std::size_t y_inc   = viennacl::traits::stride(result);
+
+        long size1 = static_cast<long>(mat.size1());
+        std::size_t size2 = mat.size2();
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for if (size1 * static_cast<long>(size2) > 10000)
+#endif
+        for (long i = 0; i < size1; ++i)
+        {
+          SCALARTYPE node = nodes[i];
+          SCALARTYPE value = 0;
+          for (std::size_t j = size2; j > 0; --j)
+            value = value * node + x[(j - 1) * x_inc + x_start];
+          y[static_cast<std::size_t>(i) * y_inc + y_start] = value;
+        }
+      }
+
+    } //namespace host_based
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -23,6 +23,8 @@
 */
 
 #include <cmath>
+#include <algorithm>
+#include <vector>
 #include "viennacl/forwards.h"
 #include "viennacl/scalar.hpp"
 #include "viennacl/tools/tools.hpp"
@@ -33,12 +35,20 @@
 #include "viennacl/linalg/host_based/common.hpp"
 #include "viennacl/traits/stride.hpp"
 
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
 
 // Minimum vector size for using OpenMP on vector operations:
 #ifndef VIENNACL_OPENMP_VECTOR_MIN_SIZE
   #define VIENNACL_OPENMP_VECTOR_MIN_SIZE  5000
 #endif
 
+// Number of vector entries processed as a block by the multi-vector operations (inner products with a vector tuple, multi_axpy):
+#ifndef VIENNACL_MULTI_VECTOR_BLOCK_SIZE
+  #define VIENNACL_MULTI_VECTOR_BLOCK_SIZE  1024
+#endif
+
 namespace viennacl
 {
   namespace linalg
@@ -310,6 +320,194 @@ namespace viennacl
         result = temp;  //Note: Assignment to result might be expensive, thus 'temp' is used for accumulation
       }
 
+
+
+      namespace detail
+      {
+        /** @brief Extracts raw pointers, start indices and strides of all vectors in a tuple */
+        template <typename T>
+        void extract_tuple_layout(vector_tuple<T> const & y_tuple,
+                                  std::vector<T const *> & data,
+                                  std::vector<std::size_t> & start,
+                                  std::vector<std::size_t> & inc)
+        {
+          std::size_t num_vectors = y_tuple.const_size();
+          data.resize(num_vectors);
+          start.resize(num_vectors);
+          inc.resize(num_vectors);
+          for (std::size_t j = 0; j < num_vectors; ++j)
+          {
+            data[j]  = extract_raw_pointer<T>(y_tuple.const_at(j));
+            start[j] = viennacl::traits::start(y_tuple.const_at(j));
+            inc[j]   = viennacl::traits::stride(y_tuple.const_at(j));
+          }
+        }
+      }
+
+      /** @brief Computes the inner products of x with all vectors of a tuple - implementation. Library users should call inner_prod(x, tie(y0, y1, ...)).
+      *
+      * x is processed in blocks of VIENNACL_MULTI_VECTOR_BLOCK_SIZE entries, so each block of x is loaded from memory only once.
+      * Within a block, four vectors of the tuple are processed at a time.
+      *
+      * @param x        The vector
+      * @param y_tuple  The tuple of vectors
+      * @param result   The result vector, result[i] = <x, y_i>
+      */
+      template <typename T>
+      void inner_prod_impl(vector_base<T> const & x,
+                           vector_tuple<T> const & y_tuple,
+                           vector_base<T> & result)
+      {
+        typedef T        value_type;
+
+        value_type const * data_x = detail::extract_raw_pointer<value_type>(x);
+        std::size_t start_x = viennacl::traits::start(x);
+        std::size_t inc_x   = viennacl::traits::stride(x);
+        std::size_t size_x  = viennacl::traits::size(x);
+
+        std::vector<value_type const *> data_y;
+        std::vector<std::size_t> start_y;
+        std::vector<std::size_t> inc_y;
+        detail::extract_tuple_layout(y_tuple, data_y, start_y, inc_y);
+        std::size_t num_vectors = data_y.size();
+
+        std::size_t block_size = VIENNACL_MULTI_VECTOR_BLOCK_SIZE;
+        long num_blocks = static_cast<long>((size_x + block_size - 1) / block_size);
+
+        std::size_t num_threads = 1;
+#ifdef VIENNACL_WITH_OPENMP
+        if (size_x > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+          num_threads = static_cast<std::size_t>(omp_get_max_threads());
+#endif
+        std::vector<value_type> partial_results(num_threads * num_vectors);  //one set of partial results per thread, summed up in fixed order below
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for schedule(static) num_threads(static_cast<int>(num_threads))
+#endif
+        for (long block = 0; block < num_blocks; ++block)
+        {
+          std::size_t thread_id = 0;
+#ifdef VIENNACL_WITH_OPENMP
+          thread_id = static_cast<std::size_t>(omp_get_thread_num());
+#endif
+          value_type * thread_results = &(partial_results[thread_id * num_vectors]);
+          std::size_t row_begin = static_cast<std::size_t>(block) * block_size;
+          std::size_t row_end   = std::min(row_begin + block_size, size_x);
+
+          for (std::size_t j = 0; j < num_vectors; j += 4)
+          {
+            // unused slots in the last group of four are mapped to the first vector of the group and discarded:
+            std::size_t j1 = (j + 1 < num_vectors) ? j + 1 : j;
+            std::size_t j2 = (j + 2 < num_vectors) ? j + 2 : j;
+            std::size_t j3 = (j + 3 < num_vectors) ? j + 3 : j;
+
+            value_type const * y0 = data_y[j];  std::size_t start0 = start_y[j];  std::size_t inc0 = inc_y[j];
+            value_type const * y1 = data_y[j1]; std::size_t start1 = start_y[j1]; std::size_t inc1 = inc_y[j1];
+            value_type const * y2 = data_y[j2]; std::size_t start2 = start_y[j2]; std::size_t inc2 = inc_y[j2];
+            value_type const * y3 = data_y[j3]; std::size_t start3 = start_y[j3]; std::size_t inc3 = inc_y[j3];
+
+            value_type temp0 = 0;
+            value_type temp1 = 0;
+            value_type temp2 = 0;
+            value_type temp3 = 0;
+            for (std::size_t i = row_begin; i < row_end; ++i)
+            {
+              value_type val_x = data_x[i*inc_x+start_x];
+              temp0 += val_x * y0[i*inc0+start0];
+              temp1 += val_x * y1[i*inc1+start1];
+              temp2 += val_x * y2[i*inc2+start2];
+              temp3 += val_x * y3[i*inc3+start3];
+            }
+
+            thread_results[j] += temp0;
+            if (j + 1 < num_vectors) thread_results[j+1] += temp1;
+            if (j + 2 < num_vectors) thread_results[j+2] += temp2;
+            if (j + 3 < num_vectors) thread_results[j+3] += temp3;
+          }
+        }
+
+        value_type * data_result = detail::extract_raw_pointer<value_type>(result);
+        std::size_t start_result = viennacl::traits::start(result);
+        std::size_t inc_result   = viennacl::traits::stride(result);
+        for (std::size_t j = 0; j < num_vectors; ++j)
+        {
+          value_type temp = 0;
+          for (std::size_t k = 0; k < num_threads; ++k)
+            temp += partial_results[k * num_vectors + j];
+          data_result[j*inc_result+start_result] = temp;
+        }
+      }
+
+
+      /** @brief Computes x += alpha * (coefficients[0] * y_0 + ... + coefficients[k-1] * y_{k-1}) - implementation. Library users should call multi_axpy().
+      *
+      * x is read and written only once. Within each block of VIENNACL_MULTI_VECTOR_BLOCK_SIZE entries, four vectors of the tuple are accumulated at a time.
+      *
+      * @param x             The vector to be updated
+      * @param alpha         Scaling factor for the linear combination
+      * @param coefficients  The coefficients of the linear combination
+      * @param y_tuple       The tuple of vectors
+      */
+      template <typename T>
+      void multi_axpy(vector_base<T> & x,
+                      T alpha,
+                      vector_base<T> const & coefficients,
+                      vector_tuple<T> const & y_tuple)
+      {
+        typedef T        value_type;
+
+        value_type * data_x = detail::extract_raw_pointer<value_type>(x);
+        std::size_t start_x = viennacl::traits::start(x);
+        std::size_t inc_x   = viennacl::traits::stride(x);
+        std::size_t size_x  = viennacl::traits::size(x);
+
+        std::vector<value_type const *> data_y;
+        std::vector<std::size_t> start_y;
+        std::vector<std::size_t> inc_y;
+        detail::extract_tuple_layout(y_tuple, data_y, start_y, inc_y);
+        std::size_t num_vectors = data_y.size();
+
+        value_type const * data_coeffs = detail::extract_raw_pointer<value_type>(coefficients);
+        std::size_t start_coeffs = viennacl::traits::start(coefficients);
+        std::size_t inc_coeffs   = viennacl::traits::stride(coefficients);
+        std::vector<value_type> scaled_coeffs(num_vectors + 3);  //padded with zeros for the last group of four
+        for (std::size_t j = 0; j < num_vectors; ++j)
+          scaled_coeffs[j] = alpha * data_coeffs[j*inc_coeffs+start_coeffs];
+
+        std::size_t block_size = VIENNACL_MULTI_VECTOR_BLOCK_SIZE;
+        long num_blocks = static_cast<long>((size_x + block_size - 1) / block_size);
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for if (size_x > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+        for (long block = 0; block < num_blocks; ++block)
+        {
+          std::size_t row_begin = static_cast<std::size_t>(block) * block_size;
+          std::size_t row_end   = std::min(row_begin + block_size, size_x);
+
+          for (std::size_t j = 0; j < num_vectors; j += 4)
+          {
+            std::size_t j1 = (j + 1 < num_vectors) ? j + 1 : j;
+            std::size_t j2 = (j + 2 < num_vectors) ? j + 2 : j;
+            std::size_t j3 = (j + 3 < num_vectors) ? j + 3 : j;
+
+            value_type const * y0 = data_y[j];  std::size_t start0 = start_y[j];  std::size_t inc0 = inc_y[j];
+            value_type const * y1 = data_y[j1]; std::size_t start1 = start_y[j1]; std::size_t inc1 = inc_y[j1];
+            value_type const * y2 = data_y[j2]; std::size_t start2 = start_y[j2]; std::size_t inc2 = inc_y[j2];
+            value_type const * y3 = data_y[j3]; std::size_t start3 = start_y[j3]; std::size_t inc3 = inc_y[j3];
+
+            value_type c0 = scaled_coeffs[j];
+            value_type c1 = scaled_coeffs[j+1];
+            value_type c2 = scaled_coeffs[j+2];
+            value_type c3 = scaled_coeffs[j+3];
+
+            for (std::size_t i = row_begin; i < row_end; ++i)
+              data_x[i*inc_x+start_x] += c0 * y0[i*inc0+start0] + c1 * y1[i*inc1+start1]
+                                       + c2 * y2[i*inc2+start2] + c3 * y3[i*inc3+start3];
+          }
+        }
+      }
+
       
       /** @brief Computes the l^1-norm of a vector
       *
@@ -154,6 +154,21 @@ namespace viennacl
                                           const viennacl::vector_expression<LHS2, RHS2, OP2>,
                                           viennacl::op_inner_prod >(vector1, vector2);
     }
+
+    // multiple inner products:
+    /** @brief Computes the inner products of x with all vectors in the tuple, e.g. inner_prod(x, tie(y0, y1, y2)). x is traversed only once.
+    *
+    * The result is a vector expression, which can be assigned to a viennacl::vector with as many entries as vectors in the tuple.
+    */
+    template <typename NumericT>
+    viennacl::vector_expression< const vector_base<NumericT>, const vector_tuple<NumericT>, viennacl::op_inner_prod >
+    inner_prod(vector_base<NumericT> const & x,
+               vector_tuple<NumericT> const & y_tuple)
+    {
+      return viennacl::vector_expression< const vector_base<NumericT>,
+                                          const vector_tuple<NumericT>,
+                                          viennacl::op_inner_prod >(x, y_tuple);
+    }
     
   } // end namespace linalg
 } // end namespace viennacl
@@ -0,0 +1,170 @@
+#ifndef VIENNACL_LINALG_ITERATIVE_OPERATIONS_HPP_
+#define VIENNACL_LINALG_ITERATIVE_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/iterative_operations.hpp
+    @brief Implementations of fused operations for pipelined iterative solvers. Each operation reads and writes the involved vectors only once.
+*/
+
+#include <cassert>
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/handle.hpp"
+#include "viennacl/linalg/host_based/iterative_operations.hpp"
+
+namespace viennacl
+{
+  namespace linalg
+  {
+
+    /** @brief Performs the vector updates of a pipelined conjugate gradient iteration.
+    *
+    * Computes result += alpha * p; r -= alpha * Ap; p = r + beta * p; in a single pass and returns <r, r> for the updated residual.
+    */
+    template <typename T>
+    T pipelined_cg_vector_update(vector_base<T> & result,
+                                 T alpha,
+                                 vector_base<T> & p,
+                                 vector_base<T> & r,
+                                 vector_base<T> const & Ap,
+                                 T beta)
+    {
+      assert(viennacl::traits::size(result) == viennacl::traits::size(p) && bool("Size mismatch in pipelined_cg_vector_update()"));
+      assert(viennacl::traits::size(result) == viennacl::traits::size(r) && bool("Size mismatch in pipelined_cg_vector_update()"));
+      assert(viennacl::traits::size(result) == viennacl::traits::size(Ap) && bool("Size mismatch in pipelined_cg_vector_update()"));
+
+      switch (viennacl::traits::handle(result).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          return viennacl::linalg::host_based::pipelined_cg_vector_update(result, alpha, p, r, Ap, beta);
+        default:
+          throw "not implemented";
+      }
+    }
+
+
+    /** @brief Computes Ap = prod(A, p) and the inner products <Ap, Ap> and <p, Ap> needed by a pipelined conjugate gradient iteration. */
+    template <typename T, unsigned int ALIGNMENT>
+    void pipelined_cg_prod(compressed_matrix<T, ALIGNMENT> const & A,
+                           vector_base<T> const & p,
+                           vector_base<T> & Ap,
+                           T & inner_prod_ApAp,
+                           T & inner_prod_pAp)
+    {
+      assert(A.size1() == viennacl::traits::size(Ap) && bool("Size mismatch in pipelined_cg_prod()"));
+      assert(A.size2() == viennacl::traits::size(p)  && bool("Size mismatch in pipelined_cg_prod()"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::pipelined_cg_prod(A, p, Ap, inner_prod_ApAp, inner_prod_pAp);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+
+    /** @brief Computes Ap = prod(A, p) and the inner products <Ap, Ap>, <p, Ap> and <Ap, r0star> needed by a pipelined BiCGStab iteration. */
+    template <typename T, unsigned int ALIGNMENT>
+    void pipelined_bicgstab_prod(compressed_matrix<T, ALIGNMENT> const & A,
+                                 vector_base<T> const & p,
+                                 vector_base<T> & Ap,
+                                 vector_base<T> const & r0star,
+                                 T & inner_prod_ApAp,
+                                 T & inner_prod_pAp,
+                                 T & inner_prod_Ap_r0star)
+    {
+      assert(A.size1() == viennacl::traits::size(Ap)     && bool("Size mismatch in pipelined_bicgstab_prod()"));
+      assert(A.size2() == viennacl::traits::size(p)      && bool("Size mismatch in pipelined_bicgstab_prod()"));
+      assert(A.size1() == viennacl::traits::size(r0star) && bool("Size mismatch in pipelined_bicgstab_prod()"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::pipelined_bicgstab_prod(A, p, Ap, r0star, inner_prod_ApAp, inner_prod_pAp, inner_prod_Ap_r0star);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+
+    /** @brief Computes s = r - alpha * Ap and the inner products <s, s> and <s, r0star> needed by a pipelined BiCGStab iteration. */
+    template <typename T>
+    void pipelined_bicgstab_update_s(vector_base<T> & s,
+                                     vector_base<T> const & r,
+                                     T alpha,
+                                     vector_base<T> const & Ap,
+                                     vector_base<T> const & r0star,
+                                     T & inner_prod_ss,
+                                     T & inner_prod_s_r0star)
+    {
+      assert(viennacl::traits::size(s) == viennacl::traits::size(r)      && bool("Size mismatch in pipelined_bicgstab_update_s()"));
+      assert(viennacl::traits::size(s) == viennacl::traits::size(Ap)     && bool("Size mismatch in pipelined_bicgstab_update_s()"));
+      assert(viennacl::traits::size(s) == viennacl::traits::size(r0star) && bool("Size mismatch in pipelined_bicgstab_update_s()"));
+
+      switch (viennacl::traits::handle(s).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::pipelined_bicgstab_update_s(s, r, alpha, Ap, r0star, inner_prod_ss, inner_prod_s_r0star);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+
+    /** @brief Performs the vector updates at the end of a pipelined BiCGStab iteration.
+    *
+    * Computes result += alpha * p + omega * s; r = s - omega * As; p = r + beta * (p - omega * Ap); in a single pass.
+    * Returns <r, r> for the updated residual and stores <r, r0star> in inner_prod_r_r0star.
+    */
+    template <typename T>
+    T pipelined_bicgstab_vector_update(vector_base<T> & result,
+                                       T alpha, vector_base<T> & p,
+                                       T omega, vector_base<T> const & s,
+                                       vector_base<T> & r, vector_base<T> const & As,
+                                       T beta,  vector_base<T> const & Ap,
+                                       vector_base<T> const & r0star,
+                                       T & inner_prod_r_r0star)
+    {
+      assert(viennacl::traits::size(result) == viennacl::traits::size(p)  && bool("Size mismatch in pipelined_bicgstab_vector_update()"));
+      assert(viennacl::traits::size(result) == viennacl::traits::size(s)  && bool("Size mismatch in pipelined_bicgstab_vector_update()"));
+      assert(viennacl::traits::size(result) == viennacl::traits::size(r)  && bool("Size mismatch in pipelined_bicgstab_vector_update()"));
+      assert(viennacl::traits::size(result) == viennacl::traits::size(As) && bool("Size mismatch in pipelined_bicgstab_vector_update()"));
+      assert(viennacl::traits::size(result) == viennacl::traits::size(Ap) && bool("Size mismatch in pipelined_bicgstab_vector_update()"));
+      assert(viennacl::traits::size(result) == viennacl::traits::size(r0star) && bool("Size mismatch in pipelined_bicgstab_vector_update()"));
+
+      switch (viennacl::traits::handle(result).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          return viennacl::linalg::host_based::pipelined_bicgstab_vector_update(result, alpha, p, omega, s, r, As, beta, Ap, r0star, inner_prod_r_r0star);
+        default:
+          throw "not implemented";
+      }
+    }
+
+  } //namespace linalg
+} //namespace viennacl
+
+
+#endif
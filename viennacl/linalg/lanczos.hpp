@@ -26,13 +26,17 @@
 
 #include <cmath>
 #include <vector>
+#include <limits>
+#include <algorithm>
 #include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
 #include "viennacl/compressed_matrix.hpp"
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/inner_prod.hpp"
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/io/matrix_market.hpp"
 #include "viennacl/linalg/bisect.hpp"
+#include "viennacl/linalg/host_based/symmetric_eigen.hpp"
 #include <boost/random.hpp>
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
@@ -108,6 +112,75 @@ namespace viennacl
 
     };
     
+    /** @brief A tag for the block Lanczos algorithm with thick restarts.
+    *
+    * The Krylov basis is kept in a dense ViennaCL matrix, so memory is bounded by the Krylov space size, and all operations on the basis run on the device of the system matrix.
+    * The system matrix needs to support products with a dense matrix, i.e. prod(A, B) with viennacl::matrix B.
+    */
+    class block_lanczos_tag
+    {
+      public:
+        /** @brief The constructor
+        *
+        * @param numeig        Number of (largest) eigenvalues to be computed
+        * @param block_size    Number of vectors the system matrix is applied to at once
+        * @param krylov        Maximum size of the Krylov space before a restart
+        * @param tol           Relative tolerance for the residuals ||A x - lambda x|| of the Ritz pairs with respect to the largest Ritz value in magnitude
+        * @param max_restarts  Maximum number of restarts
+        */
+        block_lanczos_tag(std::size_t numeig = 10,
+                          std::size_t block_size = 4,
+                          std::size_t krylov = 100,
+                          double tol = 1e-8,
+                          std::size_t max_restarts = 100) : num_eigenvalues_(numeig), block_size_(block_size > 0 ? block_size : 1), krylov_size_(krylov),
+                                                            tol_(tol), max_restarts_(max_restarts), iters_(0), last_error_(0) {}
+
+        /** @brief Sets the number of eigenvalues */
+        void num_eigenvalues(std::size_t numeig) { num_eigenvalues_ = numeig; }
+        /** @brief Returns the number of eigenvalues */
+        std::size_t num_eigenvalues() const { return num_eigenvalues_; }
+
+        /** @brief Sets the block size */
+        void block_size(std::size_t b) { if (b > 0) block_size_ = b; }
+        /** @brief Returns the block size */
+        std::size_t block_size() const { return block_size_; }
+
+        /** @brief Sets the maximum size of the Krylov space */
+        void krylov_size(std::size_t max) { krylov_size_ = max; }
+        /** @brief Returns the maximum size of the Krylov space */
+        std::size_t krylov_size() const { return krylov_size_; }
+
+        /** @brief Sets the relative tolerance for the residuals of the Ritz pairs */
+        void tolerance(double tol) { tol_ = tol; }
+        /** @brief Returns the relative tolerance for the residuals of the Ritz pairs */
+        double tolerance() const { return tol_; }
+
+        /** @brief Sets the maximum number of restarts */
+        void max_restarts(std::size_t num) { max_restarts_ = num; }
+        /** @brief Returns the maximum number of restarts */
+        std::size_t max_restarts() const { return max_restarts_; }
+
+        /** @brief Returns the number of restarts of the last run */
+        std::size_t iters() const { return iters_; }
+        void iters(std::size_t i) const { iters_ = i; }
+
+        /** @brief Returns the largest relative residual of the returned Ritz pairs at the end of the last run */
+        double error() const { return last_error_; }
+        /** @brief Sets the largest relative residual of the returned Ritz pairs */
+        void error(double e) const { last_error_ = e; }
+
+      private:
+        std::size_t num_eigenvalues_;
+        std::size_t block_size_;
+        std::size_t krylov_size_;
+        double tol_;
+        std::size_t max_restarts_;
+
+        //return values from the eigensolver
+        mutable std::size_t iters_;
+        mutable double last_error_;
+    };
+
     
     namespace detail
     {
@@ -422,6 +495,315 @@ namespace viennacl
           return bisect(alphas, betas);
       }
 
+      /** @brief Returns the columns [col_start, col_start + num_cols) of the column-major matrix V as a matrix sharing the memory of V */
+      template <typename NumericT>
+      viennacl::matrix_base<NumericT, viennacl::column_major> lanczos_columns(viennacl::matrix_base<NumericT, viennacl::column_major> & V,
+                                                                              std::size_t col_start, std::size_t num_cols)
+      {
+        return viennacl::matrix_base<NumericT, viennacl::column_major>(V.handle(),
+                                                                       V.size1(), V.start1(),                           V.stride1(), V.internal_size1(),
+                                                                       num_cols,  V.start2() + col_start * V.stride2(), V.stride2(), V.internal_size2());
+      }
+
+      /** @brief Returns column j of the column-major matrix V as a vector sharing the memory of V */
+      template <typename NumericT>
+      viennacl::vector_base<NumericT> lanczos_column(viennacl::matrix_base<NumericT, viennacl::column_major> & V, std::size_t j)
+      {
+        return viennacl::vector_base<NumericT>(V.handle(), V.size1(),
+                                               V.start1() + (V.start2() + j * V.stride2()) * V.internal_size1(), V.stride1());
+      }
+
+      /** @brief Reads the column-major matrix M to host memory. Entry (i,j) is stored in values[i + j * M.size1()]. */
+      template <typename NumericT>
+      void lanczos_read(viennacl::matrix<NumericT, viennacl::column_major> const & M, std::vector<NumericT> & values)
+      {
+        std::vector<NumericT> buffer(M.internal_size());
+        viennacl::backend::memory_read(M.handle(), 0, sizeof(NumericT) * buffer.size(), &(buffer[0]));
+
+        values.resize(M.size1() * M.size2());
+        for (std::size_t j = 0; j < M.size2(); ++j)
+          for (std::size_t i = 0; i < M.size1(); ++i)
+            values[i + j * M.size1()] = buffer[viennacl::column_major::mem_index(i, j, M.internal_size1(), M.internal_size2())];
+      }
+
+      /** @brief Writes the values (layout as in lanczos_read()) to the column-major matrix M */
+      template <typename NumericT>
+      void lanczos_write(std::vector<NumericT> const & values, viennacl::matrix<NumericT, viennacl::column_major> & M)
+      {
+        std::vector<NumericT> buffer(M.internal_size());
+        for (std::size_t j = 0; j < M.size2(); ++j)
+          for (std::size_t i = 0; i < M.size1(); ++i)
+            buffer[viennacl::column_major::mem_index(i, j, M.internal_size1(), M.internal_size2())] = values[i + j * M.size1()];
+
+        viennacl::backend::memory_write(M.handle(), 0, sizeof(NumericT) * buffer.size(), &(buffer[0]));
+      }
+
+      /** @brief Orthonormalizes the columns [j, j + b) of the basis V against each other, assuming that they are already orthogonal to the columns [0, j).
+      *
+      * Each column is orthogonalized against the previous columns of the block by classical Gram-Schmidt with one reorthogonalization pass.
+      * On breakdown, i.e. if a column is (numerically) in the span of the previous columns, it is replaced by a random vector orthogonal to the columns [0, j + c).
+      *
+      * @param V              The basis
+      * @param j              The first column of the block
+      * @param b              The number of columns in the block
+      * @param norms_before   The norms of the columns of the block before any orthogonalization. Used for detecting breakdown.
+      * @param R              Receives the upper triangular b x b factor of the block (column-major), such that the input block is V(:, j:j+b) * R
+      * @param get_N          Generator of normally distributed random numbers
+      */
+      template <typename NumericT, typename RandomGeneratorT>
+      void lanczos_orthonormalize_block(viennacl::matrix<NumericT, viennacl::column_major> & V, std::size_t j, std::size_t b,
+                                        std::vector<NumericT> const & norms_before, std::vector<NumericT> & R,
+                                        RandomGeneratorT & get_N)
+      {
+        std::size_t n = V.size1();
+        NumericT breakdown_tolerance = 10 * std::numeric_limits<NumericT>::epsilon();
+
+        R.assign(b * b, NumericT(0));
+        for (std::size_t c = 0; c < b; ++c)
+        {
+          viennacl::vector_base<NumericT> w = lanczos_column(V, j + c);
+
+          if (c > 0)
+          {
+            viennacl::matrix_base<NumericT, viennacl::column_major> previous = lanczos_columns(V, j, c);
+            viennacl::vector<NumericT> h(c);
+            std::vector<NumericT> h_cpu(c);
+
+            for (std::size_t pass = 0; pass < 2; ++pass)
+            {
+              h = viennacl::linalg::prod(trans(previous), w);
+              w -= viennacl::linalg::prod(previous, h);
+
+              viennacl::copy(h, h_cpu);
+              for (std::size_t i = 0; i < c; ++i)
+                R[i + c * b] += h_cpu[i];
+            }
+          }
+
+          NumericT norm = 0;
+          viennacl::linalg::norm_2_cpu(w, norm);
+          if (norm > breakdown_tolerance * norms_before[c])
+          {
+            w /= norm;
+            R[c + c * b] = norm;
+          }
+          else
+          {
+            // replace by a random vector orthogonal to all previous basis vectors:
+            std::vector<NumericT> s(n);
+            for (std::size_t i = 0; i < n; ++i)
+              s[i] = static_cast<NumericT>(get_N());
+            viennacl::copy(s, w);
+
+            if (j + c > 0)
+            {
+              viennacl::matrix_base<NumericT, viennacl::column_major> previous = lanczos_columns(V, 0, j + c);
+              viennacl::vector<NumericT> h(j + c);
+              for (std::size_t pass = 0; pass < 2; ++pass)
+              {
+                h = viennacl::linalg::prod(trans(previous), w);
+                w -= viennacl::linalg::prod(previous, h);
+              }
+            }
+            viennacl::linalg::norm_2_cpu(w, norm);
+            w /= norm;
+            for (std::size_t i = 0; i < c; ++i)
+              R[i + c * b] = 0;
+          }
+        }
+      }
+
+      /**
+      *   @brief Implementation of the block Lanczos algorithm with full reorthogonalization and thick restarts.
+      *
+      *   The basis V is a column-major viennacl::matrix. In each step, the system matrix is applied to the current block of b basis vectors at once.
+      *   The result is orthogonalized against all previous basis vectors by two passes of classical Gram-Schmidt, which are matrix-matrix products with the basis.
+      *   The projections obtained in the process make up the symmetric matrix T = V^T A V, whose eigenpairs (the Ritz pairs) are computed on the host.
+      *   Once the Krylov space is full, the basis is compressed to the Ritz vectors of the largest Ritz values and the residual block (thick restart).
+      *
+      *   @param A                The system matrix
+      *   @param eigenvectors     Receives the Ritz vectors of the returned eigenvalues (n x num_eigenvalues) if compute_vectors is set
+      *   @param compute_vectors  Whether the Ritz vectors should be computed
+      *   @param tag              Block Lanczos tag with several options for the algorithm
+      *   @return                 Returns the largest eigenvalues in descending order
+      */
+      template <typename MatrixT, typename NumericT, typename F>
+      std::vector<NumericT> lanczos_block_thick_restart(MatrixT const & A,
+                                                        viennacl::matrix<NumericT, F> & eigenvectors, bool compute_vectors,
+                                                        block_lanczos_tag const & tag)
+      {
+        typedef viennacl::matrix<NumericT, viennacl::column_major>        BasisType;
+        typedef viennacl::matrix_base<NumericT, viennacl::column_major>   BasisViewType;
+
+        boost::mt11213b mt;
+        boost::normal_distribution<double> N(0, 1);
+        boost::variate_generator<boost::mt11213b&, boost::normal_distribution<double> > get_N(mt, N);
+
+        std::size_t n = A.size1();
+        std::size_t b = tag.block_size();
+        std::size_t k = tag.num_eigenvalues();
+
+        // The basis with the residual block has m + b columns, and a restart keeps at least k Ritz vectors plus one block:
+        std::size_t m = std::max(tag.krylov_size(), k + 2 * b);
+        if (m + b > n)
+          m = (n > b) ? n - b : 0;
+        if (k == 0 || m < k + 2 * b)
+          throw "ViennaCL: Matrix too small for the requested number of eigenvalues and block size in block Lanczos!";
+
+        BasisType V(n, m + b);
+        BasisType W(n, b);
+        std::vector<NumericT> T(m * m);  // column-major
+        std::vector<NumericT> R, norms(b);
+
+        // random start block:
+        {
+          std::vector<NumericT> s(n);
+          for (std::size_t c = 0; c < b; ++c)
+          {
+            for (std::size_t i = 0; i < n; ++i)
+              s[i] = static_cast<NumericT>(get_N());
+            viennacl::vector_base<NumericT> v = lanczos_column(V, c);
+            viennacl::copy(s, v);
+            viennacl::linalg::norm_2_cpu(v, norms[c]);
+          }
+          lanczos_orthonormalize_block(V, 0, b, norms, R, get_N);
+        }
+
+        std::size_t keep = 0;
+        std::vector<NumericT> theta, Y, residuals(k);
+        for (std::size_t restart = 0; ; ++restart)
+        {
+          //
+          // Extend the basis from 'keep' + b to s + b columns:
+          //
+          std::size_t s = keep;
+          for (; s + b <= m; s += b)
+          {
+            BasisViewType V_s = lanczos_columns(V, s, b);
+            BasisViewType basis = lanczos_columns(V, 0, s + b);
+
+            W = viennacl::linalg::prod(A, V_s);
+            for (std::size_t c = 0; c < b; ++c)
+            {
+              viennacl::vector_base<NumericT> w = lanczos_column(W, c);
+              viennacl::linalg::norm_2_cpu(w, norms[c]);
+            }
+
+            // T(0:s+b, s:s+b) = V(:, 0:s+b)^T A V_s is accumulated from two Gram-Schmidt passes:
+            BasisType H(s + b, b);
+            std::vector<NumericT> H_cpu;
+            for (std::size_t pass = 0; pass < 2; ++pass)
+            {
+              H = viennacl::linalg::prod(trans(basis), W);
+              W -= viennacl::linalg::prod(basis, H);
+
+              lanczos_read(H, H_cpu);
+              for (std::size_t c = 0; c < b; ++c)
+                for (std::size_t i = 0; i < s + b; ++i)
+                  T[i + (s + c) * m] = (pass == 0) ? H_cpu[i + c * (s + b)] : T[i + (s + c) * m] + H_cpu[i + c * (s + b)];
+            }
+
+            // symmetric completion (the diagonal block is symmetrized):
+            for (std::size_t c = 0; c < b; ++c)
+            {
+              for (std::size_t i = 0; i < s; ++i)
+                T[(s + c) + i * m] = T[i + (s + c) * m];
+              for (std::size_t i = 0; i < c; ++i)
+              {
+                NumericT value = (T[(s + i) + (s + c) * m] + T[(s + c) + (s + i) * m]) / NumericT(2);
+                T[(s + i) + (s + c) * m] = value;
+                T[(s + c) + (s + i) * m] = value;
+              }
+            }
+
+            // next block: V(:, s+b:s+2b) R = W
+            BasisViewType V_next = lanczos_columns(V, s + b, b);
+            V_next = W;
+            lanczos_orthonormalize_block(V, s + b, b, norms, R, get_N);
+          }
+
+          //
+          // Rayleigh-Ritz: T = Y diag(theta) Y^T
+          //
+          std::vector<NumericT> T_s(s * s);
+          for (std::size_t j = 0; j < s; ++j)
+            for (std::size_t i = 0; i < s; ++i)
+              T_s[i + j * s] = T[i + j * m];
+          Y.resize(s * s);
+          viennacl::linalg::host_based::detail::symmetric_eigen(viennacl::linalg::host_based::detail::strided_matrix_view<NumericT>(&(T_s[0]), s, s, 1, s),
+                                                                viennacl::linalg::host_based::detail::strided_matrix_view<NumericT>(&(Y[0]), s, s, 1, s),
+                                                                theta);
+
+          // A V y_i - theta_i V y_i = V(:, s:s+b) R Y(s-b:s, i), so the residual norm of the i-th Ritz pair is ||R Y(s-b:s, i)||:
+          NumericT scale = std::max(std::fabs(theta[0]), std::fabs(theta[s - 1]));
+          double error = 0;
+          for (std::size_t l = 0; l < k; ++l)
+          {
+            std::size_t idx = s - 1 - l;
+            NumericT norm_squared = 0;
+            for (std::size_t i = 0; i < b; ++i)
+            {
+              NumericT value = 0;
+              for (std::size_t j = i; j < b; ++j)
+                value += R[i + j * b] * Y[(s - b + j) + idx * s];
+              norm_squared += value * value;
+            }
+            residuals[l] = std::sqrt(norm_squared);
+            error = std::max(error, (scale > 0) ? static_cast<double>(residuals[l] / scale) : 0.0);
+          }
+
+          tag.iters(restart);
+          tag.error(error);
+          if (error <= tag.tolerance() || restart >= tag.max_restarts())
+          {
+            std::vector<NumericT> eigenvalues(k);
+            for (std::size_t l = 0; l < k; ++l)
+              eigenvalues[l] = theta[s - 1 - l];
+
+            if (compute_vectors)
+            {
+              std::vector<NumericT> Y_k(s * k);
+              for (std::size_t l = 0; l < k; ++l)
+                for (std::size_t i = 0; i < s; ++i)
+                  Y_k[i + l * s] = Y[i + (s - 1 - l) * s];
+              BasisType Y_k_device(s, k);
+              lanczos_write(Y_k, Y_k_device);
+
+              eigenvectors.resize(n, k, false);
+              BasisViewType basis = lanczos_columns(V, 0, s);
+              eigenvectors = viennacl::linalg::prod(basis, Y_k_device);
+            }
+            return eigenvalues;
+          }
+
+          //
+          // Thick restart: Keep the Ritz vectors of the 'keep' largest Ritz values, followed by the residual block
+          //
+          keep = std::min(s - b, k + (s - k) / 2);
+
+          std::vector<NumericT> Y_keep(s * keep);
+          for (std::size_t l = 0; l < keep; ++l)
+            for (std::size_t i = 0; i < s; ++i)
+              Y_keep[i + l * s] = Y[i + (s - keep + l) * s];
+          BasisType Y_keep_device(s, keep);
+          lanczos_write(Y_keep, Y_keep_device);
+
+          BasisType ritz_vectors(n, keep);
+          BasisViewType basis = lanczos_columns(V, 0, s);
+          ritz_vectors = viennacl::linalg::prod(basis, Y_keep_device);
+
+          BasisViewType V_keep = lanczos_columns(V, 0, keep);
+          V_keep = ritz_vectors;
+          BasisViewType V_residual = lanczos_columns(V, keep, b);
+          V_residual = lanczos_columns(V, s, b);
+
+          // The couplings of the residual block with the Ritz vectors are recomputed in the next step:
+          std::fill(T.begin(), T.end(), NumericT(0));
+          for (std::size_t l = 0; l < keep; ++l)
+            T[l + l * m] = theta[s - keep + l];
+        }
+      }
+
     } // end namespace detail    
 
     /** 
@@ -482,6 +864,40 @@ namespace viennacl
     
       return largest_eigenvalues;
     }
+    /**
+    *   @brief Computes the largest eigenvalues of a symmetric matrix using the block Lanczos algorithm with thick restarts
+    *
+    *   @param matrix        The system matrix
+    *   @param tag           Tag with several options for the block Lanczos algorithm
+    *   @return              Returns the n largest eigenvalues (n defined in the block_lanczos_tag) in descending order
+    */
+    template< typename MatrixT >
+    std::vector< typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type >
+    eig(MatrixT const & matrix, block_lanczos_tag const & tag)
+    {
+      typedef typename viennacl::result_of::value_type<MatrixT>::type           ScalarType;
+      typedef typename viennacl::result_of::cpu_value_type<ScalarType>::type    CPU_ScalarType;
+
+      viennacl::matrix<CPU_ScalarType, viennacl::column_major> eigenvectors;
+      return detail::lanczos_block_thick_restart(matrix, eigenvectors, false, tag);
+    }
+
+    /**
+    *   @brief Computes the largest eigenvalues and the corresponding eigenvectors of a symmetric matrix using the block Lanczos algorithm with thick restarts
+    *
+    *   @param matrix        The system matrix
+    *   @param eigenvectors  Receives the eigenvectors as columns (resized to matrix.size1() times the number of eigenvalues)
+    *   @param tag           Tag with several options for the block Lanczos algorithm
+    *   @return              Returns the n largest eigenvalues (n defined in the block_lanczos_tag) in descending order
+    */
+    template< typename MatrixT, typename F >
+    std::vector< typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type >
+    eig(MatrixT const & matrix,
+        viennacl::matrix<typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type, F> & eigenvectors,
+        block_lanczos_tag const & tag)
+    {
+      return detail::lanczos_block_thick_restart(matrix, eigenvectors, true, tag);
+    }
     
     
 
@@ -25,13 +25,90 @@
 #include "viennacl/matrix.hpp"
 #include "viennacl/matrix_proxy.hpp"
 
+#include <vector>
+
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/direct_solve.hpp"
+#include "viennacl/linalg/host_based/lu.hpp"
 
 namespace viennacl
 {
   namespace linalg
   {
+    namespace detail
+    {
+      /** @brief Runs a host-based operation on a strided view of A. Matrices in other memory domains are copied to a host buffer and back. */
+      template <typename NumericT, typename F, typename HostOperation>
+      void lu_run_on_host(matrix_base<NumericT, F> & A, HostOperation op)
+      {
+        if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY)
+        {
+          op(viennacl::linalg::host_based::detail::make_strided_view(A));
+          return;
+        }
+
+        std::size_t internal_size1 = viennacl::traits::internal_size1(A);
+        std::size_t internal_size2 = viennacl::traits::internal_size2(A);
+        std::vector<NumericT> buffer(internal_size1 * internal_size2);
+        viennacl::backend::memory_read(A.handle(), 0, sizeof(NumericT) * buffer.size(), &(buffer[0]));
+
+        op(viennacl::linalg::host_based::detail::strided_matrix_view<NumericT>(&(buffer[0]) + F::mem_index(viennacl::traits::start1(A), viennacl::traits::start2(A), internal_size1, internal_size2),
+                                                                               viennacl::traits::size1(A),
+                                                                               viennacl::traits::size2(A),
+                                                                               F::mem_index(viennacl::traits::stride1(A), 0, internal_size1, internal_size2),
+                                                                               F::mem_index(0, viennacl::traits::stride2(A), internal_size1, internal_size2)));
+
+        viennacl::backend::memory_write(A.handle(), 0, sizeof(NumericT) * buffer.size(), &(buffer[0]));
+      }
+
+      /** @brief Functor for lu_run_on_host(): LU factorization, optionally with partial pivoting */
+      struct lu_factorize_on_host
+      {
+        lu_factorize_on_host(std::size_t * ipiv) : ipiv_(ipiv) {}
+
+        template <typename NumericT>
+        void operator()(viennacl::linalg::host_based::detail::strided_matrix_view<NumericT> const & A) const
+        {
+          viennacl::linalg::host_based::detail::lu_factorize(A, ipiv_);
+        }
+
+        std::size_t * ipiv_;
+      };
+
+      /** @brief Functor for lu_run_on_host(): Row permutation of the load vectors */
+      struct lu_permute_rows_on_host
+      {
+        lu_permute_rows_on_host(std::vector<std::size_t> const & permutation) : permutation_(permutation) {}
+
+        template <typename NumericT>
+        void operator()(viennacl::linalg::host_based::detail::strided_matrix_view<NumericT> const & B) const
+        {
+          viennacl::linalg::host_based::detail::lu_permute_rows(B, permutation_);
+        }
+
+        std::vector<std::size_t> const & permutation_;
+      };
+    }
+
+    /** @brief LU factorization with partial pivoting P A = L U of a dense matrix, range, or slice.
+    *
+    * The factorization is computed in host memory by a recursive panel factorization and a task-parallel (OpenMP) update of the trailing block columns.
+    * Matrices in other memory domains are transferred to the host and back.
+    *
+    * @param A            The system matrix, where the LU matrices are directly written to. The implicit unit diagonal of L is not written.
+    * @param permutation  The row permutation: Row i of P A is row permutation[i] of A. Pass it to lu_substitute().
+    */
+    template<typename NumericT, typename F>
+    void lu_factorize(matrix_base<NumericT, F> & A, std::vector<std::size_t> & permutation)
+    {
+      assert(A.size1() == A.size2() && bool("Matrix must be square"));
+
+      std::vector<std::size_t> ipiv(A.size1());
+      if (A.size1() > 0)
+        detail::lu_run_on_host(A, detail::lu_factorize_on_host(&(ipiv[0])));
+      viennacl::linalg::host_based::detail::lu_pivots_to_permutation(ipiv, permutation);
+    }
+
     /** @brief LU factorization of a row-major dense matrix.
     *
     * @param A    The system matrix, where the LU matrices are directly written to. The implicit unit diagonal of L is not written.
@@ -40,6 +117,12 @@ namespace viennacl
     void lu_factorize(matrix<SCALARTYPE, viennacl::row_major> & A)
     {
       typedef matrix<SCALARTYPE, viennacl::row_major>  MatrixType;
+
+      if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::detail::lu_factorize(viennacl::linalg::host_based::detail::make_strided_view(A), NULL);
+        return;
+      }
       
       std::size_t max_block_size = 32;
       std::size_t num_blocks = (A.size2() - 1) / max_block_size + 1;
@@ -116,6 +199,12 @@ namespace viennacl
     void lu_factorize(matrix<SCALARTYPE, viennacl::column_major> & A)
     {
       typedef matrix<SCALARTYPE, viennacl::column_major>  MatrixType;
+
+      if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::detail::lu_factorize(viennacl::linalg::host_based::detail::make_strided_view(A), NULL);
+        return;
+      }
       
       std::size_t max_block_size = 32;
       std::size_t num_blocks = (A.size1() - 1) / max_block_size + 1;
@@ -218,6 +307,68 @@ namespace viennacl
       inplace_solve(A, vec, unit_lower_tag());
       inplace_solve(A, vec, upper_tag());
     }
+
+    /** @brief LU substitution for the system P^{-1} L U X = B, where the factorization was computed by lu_factorize() with partial pivoting.
+    *
+    * @param A            The LU factors as returned by lu_factorize()
+    * @param permutation  The row permutation as returned by lu_factorize()
+    * @param B            The matrix of load vectors, where the solution is directly written to
+    */
+    template<typename NumericT, typename F1, typename F2>
+    void lu_substitute(matrix_base<NumericT, F1> const & A,
+                       std::vector<std::size_t> const & permutation,
+                       matrix_base<NumericT, F2> & B)
+    {
+      assert(A.size1() == A.size2() && bool("Matrix must be square"));
+      assert(A.size1() == B.size1() && bool("Matrix must be square"));
+      assert(A.size1() == permutation.size() && bool("Permutation size does not match"));
+
+      if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY && viennacl::traits::active_handle_id(B) == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::detail::lu_substitute(viennacl::linalg::host_based::detail::make_strided_view(A),
+                                                            &permutation,
+                                                            viennacl::linalg::host_based::detail::make_strided_view(B));
+        return;
+      }
+
+      if (B.size1() > 0)
+        detail::lu_run_on_host(B, detail::lu_permute_rows_on_host(permutation));
+      inplace_solve(A, B, unit_lower_tag());
+      inplace_solve(A, B, upper_tag());
+    }
+
+    /** @brief LU substitution for the system P^{-1} L U x = b, where the factorization was computed by lu_factorize() with partial pivoting.
+    *
+    * @param A            The LU factors as returned by lu_factorize()
+    * @param permutation  The row permutation as returned by lu_factorize()
+    * @param vec          The load vector, where the solution is directly written to
+    */
+    template<typename NumericT, typename F>
+    void lu_substitute(matrix_base<NumericT, F> const & A,
+                       std::vector<std::size_t> const & permutation,
+                       vector_base<NumericT> & vec)
+    {
+      assert(A.size1() == A.size2() && bool("Matrix must be square"));
+      assert(A.size1() == vec.size() && bool("Size of load vector does not match"));
+      assert(A.size1() == permutation.size() && bool("Permutation size does not match"));
+
+      if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY && viennacl::traits::active_handle_id(vec) == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::detail::strided_matrix_view<NumericT> vec_view(viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(vec) + viennacl::traits::start(vec),
+                                                                                     vec.size(), 1, viennacl::traits::stride(vec), 1);
+        viennacl::linalg::host_based::detail::lu_substitute(viennacl::linalg::host_based::detail::make_strided_view(A), &permutation, vec_view);
+        return;
+      }
+
+      std::vector<NumericT> vec_cpu(vec.size());
+      viennacl::copy(vec.begin(), vec.end(), vec_cpu.begin());
+      if (vec.size() > 0)
+        viennacl::linalg::host_based::detail::lu_permute_rows(viennacl::linalg::host_based::detail::strided_matrix_view<NumericT>(&(vec_cpu[0]), vec.size(), 1, 1, 1), permutation);
+      viennacl::copy(vec_cpu.begin(), vec_cpu.end(), vec.begin());
+
+      inplace_solve(A, vec, unit_lower_tag());
+      inplace_solve(A, vec, upper_tag());
+    }
     
   }
 }
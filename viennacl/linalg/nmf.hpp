@@ -25,11 +25,18 @@
 */
 
 
+#include <vector>
+#include <cmath>
+#include <limits>
+
 #include "viennacl/vector.hpp"
 #include "viennacl/matrix.hpp"
 #include "viennacl/linalg/prod.hpp"
-#include "viennacl/linalg/norm_2.hpp"
-#include "viennacl/linalg/kernels/nmf_kernels.h"
+#include "viennacl/linalg/host_based/nmf_operations.hpp"
+
+#ifdef VIENNACL_WITH_OPENCL
+  #include "viennacl/linalg/kernels/nmf_kernels.h"
+#endif
 
 namespace viennacl
 {
@@ -92,7 +99,66 @@ namespace viennacl
     };
 
     
+    namespace detail
+    {
+      /** @brief Reads a matrix to host memory and returns a view on the copy */
+      template <typename ScalarType, typename F>
+      viennacl::linalg::host_based::detail::strided_matrix_view<ScalarType const> nmf_host_view(viennacl::matrix_base<ScalarType, F> const & A,
+                                                                                                  std::vector<ScalarType> & buffer)
+      {
+        if (viennacl::traits::handle(A).get_active_handle_id() == viennacl::MAIN_MEMORY)
+          return viennacl::linalg::host_based::detail::make_strided_view(A);
+
+        buffer.resize(A.internal_size());
+        viennacl::backend::memory_read(A.handle(), 0, sizeof(ScalarType) * buffer.size(), &(buffer[0]));
+        return viennacl::linalg::host_based::detail::strided_matrix_view<ScalarType const>(&(buffer[0]), A.size1(), A.size2(),
+                                                                                           F::mem_index(1, 0, A.internal_size1(), A.internal_size2()),
+                                                                                           F::mem_index(0, 1, A.internal_size1(), A.internal_size2()));
+      }
+
+      /** @brief Multiplicative update X = X .* N ./ (G X) if G_on_the_left is set, and X = X .* N ./ (X G) otherwise. G is a small k x k matrix. */
+      template <typename ScalarType>
+      void nmf_multiplicative_update(viennacl::matrix<ScalarType> & X,
+                                     viennacl::matrix<ScalarType> const & N,
+                                     viennacl::matrix<ScalarType> const & G,
+                                     bool G_on_the_left)
+      {
+        switch (viennacl::traits::handle(X).get_active_handle_id())
+        {
+          case viennacl::MAIN_MEMORY:
+            viennacl::linalg::host_based::detail::nmf_multiplicative_update(viennacl::linalg::host_based::detail::make_strided_view(X, !G_on_the_left),
+                                                                            viennacl::linalg::host_based::detail::make_strided_view(N, !G_on_the_left),
+                                                                            viennacl::linalg::host_based::detail::make_strided_view(G, !G_on_the_left));
+            break;
+#ifdef VIENNACL_WITH_OPENCL
+          case viennacl::OPENCL_MEMORY:
+          {
+            viennacl::linalg::kernels::nmf<ScalarType, 1>::init();
+
+            viennacl::matrix<ScalarType> D(X.size1(), X.size2());
+            if (G_on_the_left)
+              D = viennacl::linalg::prod(G, X);
+            else
+              D = viennacl::linalg::prod(X, G);
+
+            viennacl::ocl::kernel & mul_div_kernel = viennacl::ocl::get_kernel(viennacl::linalg::kernels::nmf<ScalarType, 1>::program_name(),
+                                                                               "el_wise_mul_div");
+            viennacl::ocl::enqueue(mul_div_kernel(X, N, D, cl_uint(X.internal_size1() * X.internal_size2())));
+            break;
+          }
+#endif
+          default:
+            throw "not implemented";
+        }
+      }
+    }
+
     /** @brief The nonnegative matrix factorization (approximation) algorithm as suggested by Lee and Seung. Factorizes a matrix V with nonnegative entries into matrices W and H such that ||V - W*H|| is minimized.
+     *
+     * Only products with the k x k matrices W^T W and H H^T enter the denominators of the multiplicative updates, and the residual is evaluated from the trace identity
+     * ||V - W H||^2 = ||V||^2 - 2 tr(W^T V H^T) + tr((W^T W)(H H^T)). Hence, no temporary of the size of V is needed.
+     * Once the residual gets close to the accuracy sqrt(epsilon) ||V|| of the trace identity, it is computed from W H row by row instead.
+     * The iteration stops when the residual reaches the round-off level epsilon ||V||, even if the tolerance in 'conf' is smaller.
      * 
      * @param V     Input matrix 
      * @param W     First factor
@@ -105,11 +171,6 @@ namespace viennacl
              viennacl::matrix<ScalarType> & H,
              nmf_config const & conf)
     {
-      const std::string NMF_MUL_DIV_KERNEL = "el_wise_mul_div";
-      const std::string NMF_SUB_KERNEL = "sub_wise";
-      
-      viennacl::linalg::kernels::nmf<ScalarType, 1>::init();
-      
       assert(V.size1() == W.size1() && V.size2() == H.size2() && bool("Dimensions of W and H don't allow for V = W * H"));
       assert(W.size2() == H.size1() && bool("Dimensions of W and H don't match, prod(W, H) impossible"));
 
@@ -117,15 +178,21 @@ namespace viennacl
       conf.iters_ = 0;
       
       viennacl::matrix<ScalarType> wn(V.size1(), k);
-      viennacl::matrix<ScalarType> wd(V.size1(), k);
-      viennacl::matrix<ScalarType> wtmp(V.size1(), V.size2());
-
       viennacl::matrix<ScalarType> hn(k, V.size2());
-      viennacl::matrix<ScalarType> hd(k, V.size2());
-      viennacl::matrix<ScalarType> htmp(k, k);
+      viennacl::matrix<ScalarType> WtW(k, k);
+      viennacl::matrix<ScalarType> HHt(k, k);
 
-      viennacl::matrix<ScalarType> appr(V.size1(), V.size2());
-      viennacl::vector<ScalarType> diff(V.size1() * V.size2());
+      double V_norm_squared = 0;
+      {
+        std::vector<ScalarType> buffer;
+        viennacl::linalg::host_based::detail::strided_matrix_view<ScalarType const> V_host = detail::nmf_host_view(V, buffer);
+        V_norm_squared = viennacl::linalg::host_based::detail::nmf_frobenius_inner_prod(V_host, V_host);
+      }
+
+      // below this value the residual obtained from the trace identity is dominated by round-off:
+      double residual_noise_floor = 10.0 * std::sqrt(std::numeric_limits<ScalarType>::epsilon() * V_norm_squared);
+      // W * H cannot approximate V better than the round-off in its entries:
+      double attainable_residual = 10.0 * std::numeric_limits<ScalarType>::epsilon() * std::sqrt(V_norm_squared);
 
       ScalarType last_diff = 0;
       ScalarType diff_init = 0;
@@ -135,43 +202,44 @@ namespace viennacl
       for (std::size_t i = 0; i < conf.max_iterations(); i++)
       {
         conf.iters_ = i + 1;
-        {
-          hn   = viennacl::linalg::prod(trans(W), V);
-          htmp = viennacl::linalg::prod(trans(W), W);
-          hd   = viennacl::linalg::prod(htmp, H);
 
-          viennacl::ocl::kernel & mul_div_kernel = viennacl::ocl::get_kernel(viennacl::linalg::kernels::nmf<ScalarType, 1>::program_name(), 
-                                                                             NMF_MUL_DIV_KERNEL);
-          viennacl::ocl::enqueue(mul_div_kernel(H, hn, hd, cl_uint(H.internal_size1() * H.internal_size2())));
-        }
-        {
-          wn   = viennacl::linalg::prod(V, trans(H));
-          wtmp = viennacl::linalg::prod(W, H);
-          wd   = viennacl::linalg::prod(wtmp, trans(H));
+        // H = H .* (W^T V) ./ (W^T W H)
+        hn  = viennacl::linalg::prod(trans(W), V);
+        WtW = viennacl::linalg::prod(trans(W), W);
+        detail::nmf_multiplicative_update(H, hn, WtW, true);
 
-          viennacl::ocl::kernel & mul_div_kernel = viennacl::ocl::get_kernel(viennacl::linalg::kernels::nmf<ScalarType, 1>::program_name(), 
-                                                                             NMF_MUL_DIV_KERNEL);
-          
-          viennacl::ocl::enqueue(mul_div_kernel(W, wn, wd, cl_uint(W.internal_size1() * W.internal_size2())));
-        }
+        // W = W .* (V H^T) ./ (W H H^T)
+        wn  = viennacl::linalg::prod(V, trans(H));
+        HHt = viennacl::linalg::prod(H, trans(H));
+        detail::nmf_multiplicative_update(W, wn, HHt, false);
 
         if (i % conf.check_after_steps() == 0)  //check for convergence
         {
-          appr = viennacl::linalg::prod(W, H);
+          WtW = viennacl::linalg::prod(trans(W), W);  // wn and HHt are still up to date
 
-          viennacl::ocl::kernel & sub_kernel = viennacl::ocl::get_kernel(viennacl::linalg::kernels::nmf<ScalarType, 1>::program_name(), 
-                                                                         NMF_SUB_KERNEL);
-          //this is a cheat: save difference of two matrix into vector to get norm_2
-          viennacl::ocl::enqueue(sub_kernel(appr, V, diff, cl_uint(V.size1() * V.size2())));
-          ScalarType diff_val = viennacl::linalg::norm_2(diff);
+          std::vector<ScalarType> W_buffer, wn_buffer, WtW_buffer, HHt_buffer;
+          ScalarType diff_val = viennacl::linalg::host_based::detail::nmf_residual_norm(V_norm_squared,
+                                                                                        detail::nmf_host_view(W,   W_buffer),
+                                                                                        detail::nmf_host_view(wn,  wn_buffer),
+                                                                                        detail::nmf_host_view(WtW, WtW_buffer),
+                                                                                        detail::nmf_host_view(HHt, HHt_buffer));
+
+          if (diff_val < residual_noise_floor)
+          {
+            std::vector<ScalarType> V_buffer, H_buffer;
+            diff_val = viennacl::linalg::host_based::detail::nmf_explicit_residual_norm(detail::nmf_host_view(V, V_buffer),
+                                                                                        detail::nmf_host_view(W, W_buffer),
+                                                                                        detail::nmf_host_view(H, H_buffer));
+          }
           
           if (i == 0)
             diff_init = diff_val;
-          
-          std::cout << diff_val / diff_init << std::endl;
 
+          if (diff_init <= 0)  // V = W H already
+            break;
+          
           // Approximation check
-          if (diff_val / diff_init < conf.tolerance())
+          if (diff_val / diff_init < conf.tolerance() || diff_val < attainable_residual)
             break;
 
           // Stagnation check
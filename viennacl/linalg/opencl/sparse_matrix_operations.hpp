@@ -29,6 +29,10 @@
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/traits/handle.hpp"
 #include "viennacl/linalg/kernels/compressed_matrix_kernels.h"
 #include "viennacl/linalg/kernels/coordinate_matrix_kernels.h"
 #include "viennacl/linalg/kernels/ell_matrix_kernels.h"
@@ -89,6 +93,85 @@ namespace viennacl
       
       
       
+      namespace detail
+      {
+        /** @brief Enqueues the kernel for C = A * B, where A is a compressed_matrix and the dense operands B and C are described by their offset and their row and column increments within the memory buffer */
+        template<typename TYPE, unsigned int ALIGNMENT, typename DenseMatrixType, typename ResultMatrixType>
+        void d_mat_mul(const viennacl::compressed_matrix<TYPE, ALIGNMENT> & sp_mat,
+                       DenseMatrixType const & d_mat,
+                       cl_uint d_mat_offset, cl_uint d_mat_row_inc, cl_uint d_mat_col_inc,
+                       ResultMatrixType & result)
+        {
+          typedef typename ResultMatrixType::orientation_functor    F;
+          cl_uint result_offset  = cl_uint(F::mem_index(viennacl::traits::start1(result), viennacl::traits::start2(result),
+                                                        viennacl::traits::internal_size1(result), viennacl::traits::internal_size2(result)));
+          cl_uint result_row_inc = cl_uint(F::mem_index(viennacl::traits::stride1(result), 0,
+                                                        viennacl::traits::internal_size1(result), viennacl::traits::internal_size2(result)));
+          cl_uint result_col_inc = cl_uint(F::mem_index(0, viennacl::traits::stride2(result),
+                                                        viennacl::traits::internal_size1(result), viennacl::traits::internal_size2(result)));
+
+          viennacl::linalg::kernels::compressed_matrix<TYPE, ALIGNMENT>::init();
+          viennacl::ocl::kernel & k = viennacl::ocl::get_kernel(viennacl::linalg::kernels::compressed_matrix<TYPE, ALIGNMENT>::program_name(), "d_mat_mul");
+
+          viennacl::ocl::enqueue(k(sp_mat.handle1().opencl_handle(), sp_mat.handle2().opencl_handle(), sp_mat.handle().opencl_handle(),
+                                   viennacl::traits::opencl_handle(d_mat),
+                                   d_mat_offset, d_mat_row_inc, d_mat_col_inc,
+                                   viennacl::traits::opencl_handle(result),
+                                   result_offset, result_row_inc, result_col_inc,
+                                   cl_uint(viennacl::traits::size1(result)), cl_uint(viennacl::traits::size2(result))
+                                  )
+                                );
+        }
+      }
+
+      /** @brief Carries out sparse matrix times dense matrix multiplication with a compressed_matrix
+      *
+      * Implementation of the convenience expression result = prod(sp_mat, d_mat);
+      *
+      * @param sp_mat   The sparse matrix
+      * @param d_mat    The dense matrix
+      * @param result   The result matrix
+      */
+      template<class TYPE, unsigned int ALIGNMENT, typename F1, typename F2>
+      void prod_impl(const viennacl::compressed_matrix<TYPE, ALIGNMENT> & sp_mat,
+                     const viennacl::matrix_base<TYPE, F1> & d_mat,
+                           viennacl::matrix_base<TYPE, F2> & result)
+      {
+        std::size_t internal_size1 = viennacl::traits::internal_size1(d_mat);
+        std::size_t internal_size2 = viennacl::traits::internal_size2(d_mat);
+        detail::d_mat_mul(sp_mat, d_mat,
+                          cl_uint(F1::mem_index(viennacl::traits::start1(d_mat), viennacl::traits::start2(d_mat), internal_size1, internal_size2)),
+                          cl_uint(F1::mem_index(viennacl::traits::stride1(d_mat), 0, internal_size1, internal_size2)),
+                          cl_uint(F1::mem_index(0, viennacl::traits::stride2(d_mat), internal_size1, internal_size2)),
+                          result);
+      }
+
+      /** @brief Carries out sparse matrix times transposed dense matrix multiplication with a compressed_matrix
+      *
+      * Implementation of the convenience expression result = prod(sp_mat, trans(d_mat));
+      *
+      * @param sp_mat   The sparse matrix
+      * @param d_mat    The transposed dense matrix proxy
+      * @param result   The result matrix
+      */
+      template<class TYPE, unsigned int ALIGNMENT, typename F1, typename F2>
+      void prod_impl(const viennacl::compressed_matrix<TYPE, ALIGNMENT> & sp_mat,
+                     const viennacl::matrix_expression<const viennacl::matrix_base<TYPE, F1>,
+                                                       const viennacl::matrix_base<TYPE, F1>,
+                                                       viennacl::op_trans> & d_mat,
+                           viennacl::matrix_base<TYPE, F2> & result)
+      {
+        // the transposed operand is passed with row and column increments swapped
+        std::size_t internal_size1 = viennacl::traits::internal_size1(d_mat.lhs());
+        std::size_t internal_size2 = viennacl::traits::internal_size2(d_mat.lhs());
+        detail::d_mat_mul(sp_mat, d_mat.lhs(),
+                          cl_uint(F1::mem_index(viennacl::traits::start1(d_mat.lhs()), viennacl::traits::start2(d_mat.lhs()), internal_size1, internal_size2)),
+                          cl_uint(F1::mem_index(0, viennacl::traits::stride2(d_mat.lhs()), internal_size1, internal_size2)),
+                          cl_uint(F1::mem_index(viennacl::traits::stride1(d_mat.lhs()), 0, internal_size1, internal_size2)),
+                          result);
+      }
+
+
       // triangular solvers
 
       /** @brief Inplace solution of a lower triangular compressed_matrix with unit diagonal. Typically used for LU substitutions
@@ -23,6 +23,7 @@
 */
 
 #include <cmath>
+#include <algorithm>
 
 #include "viennacl/forwards.h"
 #include "viennacl/ocl/device.hpp"
@@ -391,6 +392,116 @@ namespace viennacl
         for (typename std::vector<T>::const_iterator it = temp_cpu.begin(); it != temp_cpu.end(); ++it)
           result += *it;
       }
+
+
+      /** @brief Computes the inner products of x with all vectors of a tuple - implementation. Library users should call inner_prod(x, tie(y0, y1, ...)).
+      *
+      * Four vectors of the tuple are processed per kernel launch, so x is read only once for every four inner products.
+      *
+      * @param x        The vector
+      * @param y_tuple  The tuple of vectors
+      * @param result   The result vector, result[i] = <x, y_i>
+      */
+      template <typename T>
+      void inner_prod_impl(vector_base<T> const & x,
+                           vector_tuple<T> const & y_tuple,
+                           vector_base<T> & result)
+      {
+        viennacl::linalg::kernels::vector<T, 1>::init();
+
+        static std::size_t work_groups = 128;
+        static viennacl::vector<T> temp = viennacl::zero_vector<T>(4 * work_groups);
+
+        viennacl::ocl::kernel & k    = viennacl::ocl::get_kernel(viennacl::linalg::kernels::vector<T, 1>::program_name(), "inner_prod4");
+        viennacl::ocl::kernel & ksum = viennacl::ocl::get_kernel(viennacl::linalg::kernels::vector<T, 1>::program_name(), "inner_prod4_sum");
+
+        k.global_work_size(0, work_groups * k.local_work_size());
+        ksum.local_work_size(0, work_groups);
+        ksum.global_work_size(0, 4 * work_groups);
+
+        std::size_t num_vectors = y_tuple.const_size();
+        for (std::size_t j = 0; j < num_vectors; j += 4)
+        {
+          // unused slots in the last group of four are mapped to the first vector of the group, the respective results are discarded:
+          vector_base<T> const & y0 = y_tuple.const_at(j);
+          vector_base<T> const & y1 = (j + 1 < num_vectors) ? y_tuple.const_at(j + 1) : y0;
+          vector_base<T> const & y2 = (j + 2 < num_vectors) ? y_tuple.const_at(j + 2) : y0;
+          vector_base<T> const & y3 = (j + 3 < num_vectors) ? y_tuple.const_at(j + 3) : y0;
+
+          // Step 1: Compute partial inner products for each work group:
+          viennacl::ocl::enqueue(k(viennacl::traits::opencl_handle(x),
+                                   cl_uint(viennacl::traits::start(x)),
+                                   cl_uint(viennacl::traits::stride(x)),
+                                   cl_uint(viennacl::traits::size(x)),
+                                   viennacl::traits::opencl_handle(y0), cl_uint(viennacl::traits::start(y0)), cl_uint(viennacl::traits::stride(y0)),
+                                   viennacl::traits::opencl_handle(y1), cl_uint(viennacl::traits::start(y1)), cl_uint(viennacl::traits::stride(y1)),
+                                   viennacl::traits::opencl_handle(y2), cl_uint(viennacl::traits::start(y2)), cl_uint(viennacl::traits::stride(y2)),
+                                   viennacl::traits::opencl_handle(y3), cl_uint(viennacl::traits::start(y3)), cl_uint(viennacl::traits::stride(y3)),
+                                   viennacl::ocl::local_mem(sizeof(T) * 4 * k.local_work_size()),
+                                   viennacl::traits::opencl_handle(temp)
+                                  )
+                                );
+
+          // Step 2: Sum partial results, one work group per vector:
+          viennacl::ocl::enqueue(ksum(viennacl::traits::opencl_handle(temp),
+                                      cl_uint(work_groups),
+                                      viennacl::ocl::local_mem(sizeof(T) * ksum.local_work_size()),
+                                      viennacl::traits::opencl_handle(result),
+                                      cl_uint(viennacl::traits::start(result)),
+                                      cl_uint(viennacl::traits::stride(result)),
+                                      cl_uint(j),
+                                      cl_uint(std::min<std::size_t>(4, num_vectors - j))
+                                     )
+                                );
+        }
+      }
+
+
+      /** @brief Computes x += alpha * (coefficients[0] * y_0 + ... + coefficients[k-1] * y_{k-1}) - implementation. Library users should call multi_axpy().
+      *
+      * Four vectors of the tuple are accumulated per kernel launch. The coefficients remain on the device.
+      *
+      * @param x             The vector to be updated
+      * @param alpha         Scaling factor for the linear combination
+      * @param coefficients  The coefficients of the linear combination
+      * @param y_tuple       The tuple of vectors
+      */
+      template <typename T>
+      void multi_axpy(vector_base<T> & x,
+                      T alpha,
+                      vector_base<T> const & coefficients,
+                      vector_tuple<T> const & y_tuple)
+      {
+        viennacl::linalg::kernels::vector<T, 1>::init();
+
+        viennacl::ocl::kernel & k = viennacl::ocl::get_kernel(viennacl::linalg::kernels::vector<T, 1>::program_name(), "multi_axpy4");
+
+        std::size_t num_vectors = y_tuple.const_size();
+        for (std::size_t j = 0; j < num_vectors; j += 4)
+        {
+          vector_base<T> const & y0 = y_tuple.const_at(j);
+          vector_base<T> const & y1 = (j + 1 < num_vectors) ? y_tuple.const_at(j + 1) : y0;
+          vector_base<T> const & y2 = (j + 2 < num_vectors) ? y_tuple.const_at(j + 2) : y0;
+          vector_base<T> const & y3 = (j + 3 < num_vectors) ? y_tuple.const_at(j + 3) : y0;
+
+          viennacl::ocl::enqueue(k(viennacl::traits::opencl_handle(x),
+                                   cl_uint(viennacl::traits::start(x)),
+                                   cl_uint(viennacl::traits::stride(x)),
+                                   cl_uint(viennacl::traits::size(x)),
+                                   alpha,
+                                   viennacl::traits::opencl_handle(coefficients),
+                                   cl_uint(viennacl::traits::start(coefficients)),
+                                   cl_uint(viennacl::traits::stride(coefficients)),
+                                   cl_uint(j),
+                                   cl_uint(std::min<std::size_t>(4, num_vectors - j)),
+                                   viennacl::traits::opencl_handle(y0), cl_uint(viennacl::traits::start(y0)), cl_uint(viennacl::traits::stride(y0)),
+                                   viennacl::traits::opencl_handle(y1), cl_uint(viennacl::traits::start(y1)), cl_uint(viennacl::traits::stride(y1)),
+                                   viennacl::traits::opencl_handle(y2), cl_uint(viennacl::traits::start(y2)), cl_uint(viennacl::traits::stride(y2)),
+                                   viennacl::traits::opencl_handle(y3), cl_uint(viennacl::traits::start(y3)), cl_uint(viennacl::traits::stride(y3))
+                                  )
+                                );
+        }
+      }
       
       
       //////////// Helper for norms
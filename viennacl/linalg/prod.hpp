@@ -266,6 +266,76 @@ namespace viennacl
                                op_prod >(mat, vec);
     }
 
+    template<class SCALARTYPE>
+    vector_expression<const out_of_core_compressed_matrix<SCALARTYPE>,
+                      const vector_base<SCALARTYPE>,
+                      op_prod >
+    prod(const out_of_core_compressed_matrix<SCALARTYPE> & mat,
+         const vector_base<SCALARTYPE> & vec)
+    {
+      return vector_expression<const out_of_core_compressed_matrix<SCALARTYPE>,
+                               const vector_base<SCALARTYPE>,
+                               op_prod >(mat, vec);
+    }
+
+    // sparse matrix times sparse matrix
+    template<typename SCALARTYPE, unsigned int ALIGNMENT_A, unsigned int ALIGNMENT_B>
+    viennacl::matrix_expression<const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT_A>,
+                                const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT_B>,
+                                op_prod >
+    prod(const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT_A> & A,
+         const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT_B> & B)
+    {
+      return viennacl::matrix_expression<const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT_A>,
+                                         const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT_B>,
+                                         op_prod >(A, B);
+    }
+
+    // batched matrix times batched matrix
+    template<typename NumericT, typename F>
+    viennacl::matrix_expression<const viennacl::batched_matrix<NumericT, F>,
+                                const viennacl::batched_matrix<NumericT, F>,
+                                op_prod >
+    prod(const viennacl::batched_matrix<NumericT, F> & A,
+         const viennacl::batched_matrix<NumericT, F> & B)
+    {
+      return viennacl::matrix_expression<const viennacl::batched_matrix<NumericT, F>,
+                                         const viennacl::batched_matrix<NumericT, F>,
+                                         op_prod >(A, B);
+    }
+
+    // sparse matrix (CSR) times dense matrix
+    template<class SCALARTYPE, unsigned int ALIGNMENT, typename F>
+    viennacl::matrix_expression<const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                const viennacl::matrix_base<SCALARTYPE, F>,
+                                op_prod >
+    prod(const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT> & sp_mat,
+         const viennacl::matrix_base<SCALARTYPE, F> & d_mat)
+    {
+      return viennacl::matrix_expression<const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                         const viennacl::matrix_base<SCALARTYPE, F>,
+                                         op_prod >(sp_mat, d_mat);
+    }
+
+    // sparse matrix (CSR) times transposed dense matrix
+    template<class SCALARTYPE, unsigned int ALIGNMENT, typename F>
+    viennacl::matrix_expression<const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                const viennacl::matrix_expression<const viennacl::matrix_base<SCALARTYPE, F>,
+                                                                  const viennacl::matrix_base<SCALARTYPE, F>,
+                                                                  op_trans>,
+                                op_prod >
+    prod(const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT> & sp_mat,
+         const viennacl::matrix_expression<const viennacl::matrix_base<SCALARTYPE, F>,
+                                           const viennacl::matrix_base<SCALARTYPE, F>,
+                                           op_trans> & d_mat)
+    {
+      return viennacl::matrix_expression<const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                         const viennacl::matrix_expression<const viennacl::matrix_base<SCALARTYPE, F>,
+                                                                           const viennacl::matrix_base<SCALARTYPE, F>,
+                                                                           op_trans>,
+                                         op_prod >(sp_mat, d_mat);
+    }
+
     template<typename StructuredMatrixType, class SCALARTYPE>
     typename viennacl::enable_if< viennacl::is_any_dense_structured_matrix<StructuredMatrixType>::value,
                                   vector_expression<const StructuredMatrixType,
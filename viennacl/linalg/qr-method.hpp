@@ -24,6 +24,7 @@
 #include <examples/benchmarks/benchmark-utils.hpp>
 
 #include "viennacl/linalg/qr-method-common.hpp"
+#include "viennacl/linalg/host_based/symmetric_eigen.hpp"
 
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
@@ -38,6 +39,7 @@ namespace viennacl
   {
     namespace detail
     {
+#ifdef VIENNACL_WITH_OPENCL
         template<typename MatrixType, typename VectorType>
         void givens_next(MatrixType& matrix,
                         VectorType& tmp1,
@@ -217,6 +219,7 @@ namespace viennacl
                                           static_cast<cl_uint>(last_n)
                                   ));
         }
+#endif
 
         template <typename SCALARTYPE, typename MatrixT>
         void final_iter_update(MatrixT& A,
@@ -322,6 +325,7 @@ namespace viennacl
             std::size_t size_;
         };
 
+#ifdef VIENNACL_WITH_OPENCL
         // Nonsymmetric reduction from Hessenberg to real Schur form.   
         // This is derived from the Algol procedure hqr2, by Martin and Wilkinson, Handbook for Auto. Comp.,
         // Vol.ii-Linear Algebra, and the corresponding  Fortran subroutine in EISPACK.
@@ -854,17 +858,12 @@ namespace viennacl
         }
 
         template <typename SCALARTYPE, typename F, unsigned int ALIGNMENT>
-        void qr_method(viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & A, 
-                       viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & Q,
-                       boost::numeric::ublas::vector<SCALARTYPE> & D,
-                       boost::numeric::ublas::vector<SCALARTYPE> & E,
-                       bool is_symmetric = true)
+        void qr_method_opencl(viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & A, 
+                              viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & Q,
+                              boost::numeric::ublas::vector<SCALARTYPE> & D,
+                              boost::numeric::ublas::vector<SCALARTYPE> & E,
+                              bool is_symmetric)
         {
-            assert(A.size1() == A.size2());
-            
-            D.resize(A.size1());
-            E.resize(A.size1());
-
             viennacl::linalg::kernels::svd<SCALARTYPE, 1>::init();
 
             detail::eye(Q);
@@ -912,6 +911,58 @@ namespace viennacl
 
             copy(eigen_values, A);          
         }
+#endif
+
+        /** @brief Symmetric eigenvalue problem in host memory: blocked tridiagonalization, implicit QL iteration, and back-transformation of the eigenvectors. The eigenvalues are sorted in ascending order. */
+        template <typename SCALARTYPE, typename F, unsigned int ALIGNMENT>
+        void qr_method_sym_host(viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & A, 
+                                viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & Q,
+                                boost::numeric::ublas::vector<SCALARTYPE> & D,
+                                boost::numeric::ublas::vector<SCALARTYPE> & E)
+        {
+            viennacl::linalg::host_based::detail::strided_matrix_view<SCALARTYPE> A_view = viennacl::linalg::host_based::detail::make_strided_view(A);
+
+            std::vector<SCALARTYPE> eigenvalues;
+            viennacl::linalg::host_based::detail::symmetric_eigen(A_view, viennacl::linalg::host_based::detail::make_strided_view(Q), eigenvalues);
+
+            // Write resulting diagonal matrix with eigenvalues to A:
+            viennacl::linalg::host_based::detail::gemm_scale_C(A_view, SCALARTYPE(0));
+            for (std::size_t i = 0; i < A.size1(); i++)
+            {
+                D(i) = eigenvalues[i];
+                E(i) = 0;
+                A_view(i, i) = eigenvalues[i];
+            }
+        }
+
+        template <typename SCALARTYPE, typename F, unsigned int ALIGNMENT>
+        void qr_method(viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & A, 
+                       viennacl::matrix<SCALARTYPE, F, ALIGNMENT> & Q,
+                       boost::numeric::ublas::vector<SCALARTYPE> & D,
+                       boost::numeric::ublas::vector<SCALARTYPE> & E,
+                       bool is_symmetric = true)
+        {
+            assert(A.size1() == A.size2());
+            
+            D.resize(A.size1());
+            E.resize(A.size1());
+
+            switch (viennacl::traits::handle(A).get_active_handle_id())
+            {
+              case viennacl::MAIN_MEMORY:
+                if (!is_symmetric)
+                  throw "not implemented";
+                qr_method_sym_host(A, Q, D, E);
+                break;
+#ifdef VIENNACL_WITH_OPENCL
+              case viennacl::OPENCL_MEMORY:
+                qr_method_opencl(A, Q, D, E, is_symmetric);
+                break;
+#endif
+              default:
+                throw "not implemented";
+            }
+        }
     }
 
 
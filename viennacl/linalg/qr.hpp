@@ -41,6 +41,7 @@
 #include "viennacl/matrix_proxy.hpp"
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/range.hpp"
+#include "viennacl/linalg/host_based/qr.hpp"
 
 namespace viennacl
 {
@@ -598,6 +599,46 @@ namespace viennacl
     }
 
 
+    /** @brief Generates Q and R explicitly from an inplace QR factorization of a ViennaCL matrix. In host memory, Q is obtained by applying blocks of reflectors to the identity matrix.
+     *
+     *  @param A      A matrix holding R in its upper triangular part and the Householder reflectors in the lower triangular part, as obtained from inplace_qr()
+     *  @param betas  The scalars beta_i for each Householder reflector (I - beta_i v_i v_i^T)
+     *  @param Q      The orthogonal matrix Q (size1 x size1)
+     *  @param R      The upper triangular matrix R (same size as A)
+     */
+    template <typename T, typename F, unsigned int ALIGNMENT, typename VectorType>
+    void recoverQ(viennacl::matrix<T, F, ALIGNMENT> const & A, VectorType const & betas, viennacl::matrix<T, F, ALIGNMENT> & Q, viennacl::matrix<T, F, ALIGNMENT> & R)
+    {
+      if (viennacl::traits::active_handle_id(A) != viennacl::MAIN_MEMORY
+          || viennacl::traits::active_handle_id(Q) != viennacl::MAIN_MEMORY
+          || viennacl::traits::active_handle_id(R) != viennacl::MAIN_MEMORY)
+      {
+        boost::numeric::ublas::matrix<T> ublas_A(A.size1(), A.size2());
+        boost::numeric::ublas::matrix<T> ublas_Q(Q.size1(), Q.size2());
+        boost::numeric::ublas::matrix<T> ublas_R(R.size1(), R.size2());
+        viennacl::copy(A, ublas_A);
+        recoverQ(ublas_A, betas, ublas_Q, ublas_R);
+        viennacl::copy(ublas_Q, Q);
+        viennacl::copy(ublas_R, R);
+        return;
+      }
+
+      viennacl::linalg::host_based::detail::strided_matrix_view<T const> A_view = viennacl::linalg::host_based::detail::make_strided_view(A);
+      viennacl::linalg::host_based::detail::strided_matrix_view<T>       Q_view = viennacl::linalg::host_based::detail::make_strided_view(Q);
+      viennacl::linalg::host_based::detail::strided_matrix_view<T>       R_view = viennacl::linalg::host_based::detail::make_strided_view(R);
+
+      for (std::size_t i=0; i<R.size1(); ++i)
+        for (std::size_t j=0; j<R.size2(); ++j)
+          R_view(i,j) = (j >= i) ? A_view(i,j) : T(0);
+
+      for (std::size_t i=0; i<Q.size1(); ++i)
+        for (std::size_t j=0; j<Q.size2(); ++j)
+          Q_view(i,j) = (i == j) ? T(1) : T(0);
+
+      viennacl::linalg::host_based::detail::qr_apply_Q(A_view, betas, Q_view, false);
+    }
+
+
     /** @brief Computes Q^T b, where Q is an implicit orthogonal matrix defined via its Householder reflectors stored in A. 
      * 
      *  @param A      A matrix holding the Householder reflectors in the lower triangular part. Typically obtained from calling inplace_qr() on the original matrix
@@ -627,6 +668,14 @@ namespace viennacl
     template <typename T, typename F, unsigned int ALIGNMENT, typename VectorType1, unsigned int A2>
     void inplace_qr_apply_trans_Q(viennacl::matrix<T, F, ALIGNMENT> const & A, VectorType1 const & betas, viennacl::vector<T, A2> & b)
     {
+      if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY && viennacl::traits::active_handle_id(b) == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::detail::strided_matrix_view<T> b_view(viennacl::linalg::host_based::detail::extract_raw_pointer<T>(b) + viennacl::traits::start(b),
+                                                                            b.size(), 1, viennacl::traits::stride(b), 1);
+        viennacl::linalg::host_based::detail::qr_apply_Q(viennacl::linalg::host_based::detail::make_strided_view(A), betas, b_view, true);
+        return;
+      }
+
       boost::numeric::ublas::matrix<T> ublas_A(A.size1(), A.size2());
       viennacl::copy(A, ublas_A);
       
@@ -646,6 +695,13 @@ namespace viennacl
     template<typename T, typename F, unsigned int ALIGNMENT>
     std::vector<T> inplace_qr(viennacl::matrix<T, F, ALIGNMENT> & A, std::size_t block_size = 16)
     {
+      if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY)
+      {
+        std::vector<T> betas(A.size2());
+        if (A.size1() > 0 && A.size2() > 0)
+          viennacl::linalg::host_based::detail::inplace_qr(viennacl::linalg::host_based::detail::make_strided_view(A), &(betas[0]), block_size);
+        return betas;
+      }
       return detail::inplace_qr_hybrid(A, block_size);
     }
 
@@ -113,8 +113,136 @@ namespace viennacl
           throw "not implemented";
       }
     }
-    
-    
+
+
+    /** @brief Carries out matrix-vector multiplication with an out_of_core_compressed_matrix
+    *
+    * Implementation of the convenience expression result = prod(mat, vec);
+    * The row blocks are streamed from disk through main memory, hence only vectors in main memory are supported.
+    *
+    * @param mat    The matrix
+    * @param vec    The vector
+    * @param result The result vector
+    */
+    template<class ScalarType>
+    void prod_impl(const viennacl::out_of_core_compressed_matrix<ScalarType> & mat,
+                   const viennacl::vector_base<ScalarType> & vec,
+                         viennacl::vector_base<ScalarType> & result)
+    {
+      assert( (mat.size1() == result.size()) && bool("Size check failed for out-of-core matrix-vector product: size1(mat) != size(result)"));
+      assert( (mat.size2() == vec.size())    && bool("Size check failed for out-of-core matrix-vector product: size2(mat) != size(x)"));
+
+      if (viennacl::traits::handle(result).get_active_handle_id() != viennacl::traits::handle(vec).get_active_handle_id())
+        throw "not implemented";
+
+      switch (viennacl::traits::handle(vec).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::prod_impl(mat, vec, result);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+
+    // A * B
+
+    /** @brief Carries out sparse matrix times dense matrix multiplication
+    *
+    * Implementation of the convenience expression result = prod(sp_mat, d_mat);
+    *
+    * @param sp_mat   The sparse matrix
+    * @param d_mat    The dense matrix
+    * @param result   The result matrix
+    */
+    template<class ScalarType, unsigned int ALIGNMENT, typename F1, typename F2>
+    void prod_impl(const viennacl::compressed_matrix<ScalarType, ALIGNMENT> & sp_mat,
+                   const viennacl::matrix_base<ScalarType, F1> & d_mat,
+                         viennacl::matrix_base<ScalarType, F2> & result)
+    {
+      assert( (sp_mat.size1() == result.size1()) && bool("Size check failed for sparse matrix-matrix product: size1(sp_mat) != size1(result)"));
+      assert( (sp_mat.size2() == d_mat.size1())  && bool("Size check failed for sparse matrix-matrix product: size2(sp_mat) != size1(d_mat)"));
+      assert( (d_mat.size2()  == result.size2()) && bool("Size check failed for sparse matrix-matrix product: size2(d_mat) != size2(result)"));
+
+      switch (viennacl::traits::handle(sp_mat).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::prod_impl(sp_mat, d_mat, result);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          viennacl::linalg::opencl::prod_impl(sp_mat, d_mat, result);
+          break;
+#endif
+        default:
+          throw "not implemented";
+      }
+    }
+
+    /** @brief Carries out sparse matrix times transposed dense matrix multiplication
+    *
+    * Implementation of the convenience expression result = prod(sp_mat, trans(d_mat));
+    *
+    * @param sp_mat   The sparse matrix
+    * @param d_mat    The transposed dense matrix proxy
+    * @param result   The result matrix
+    */
+    template<class ScalarType, unsigned int ALIGNMENT, typename F1, typename F2>
+    void prod_impl(const viennacl::compressed_matrix<ScalarType, ALIGNMENT> & sp_mat,
+                   const viennacl::matrix_expression<const viennacl::matrix_base<ScalarType, F1>,
+                                                     const viennacl::matrix_base<ScalarType, F1>,
+                                                     viennacl::op_trans> & d_mat,
+                         viennacl::matrix_base<ScalarType, F2> & result)
+    {
+      assert( (sp_mat.size1() == result.size1())      && bool("Size check failed for sparse matrix-matrix product: size1(sp_mat) != size1(result)"));
+      assert( (sp_mat.size2() == d_mat.lhs().size2()) && bool("Size check failed for sparse matrix-matrix product: size2(sp_mat) != size1(trans(d_mat))"));
+      assert( (d_mat.lhs().size1() == result.size2()) && bool("Size check failed for sparse matrix-matrix product: size2(trans(d_mat)) != size2(result)"));
+
+      switch (viennacl::traits::handle(sp_mat).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::prod_impl(sp_mat, d_mat, result);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          viennacl::linalg::opencl::prod_impl(sp_mat, d_mat, result);
+          break;
+#endif
+        default:
+          throw "not implemented";
+      }
+    }
+
+
+    // A * B with sparse B
+
+    /** @brief Carries out the sparse matrix-matrix product C = A * B for compressed_matrix operands
+    *
+    * Implementation of the convenience expression C = prod(A, B);
+    *
+    * @param A    The left hand side sparse matrix
+    * @param B    The right hand side sparse matrix
+    * @param C    The result matrix
+    */
+    template<class ScalarType, unsigned int ALIGNMENT_A, unsigned int ALIGNMENT_B, unsigned int ALIGNMENT_C>
+    void prod_impl(const viennacl::compressed_matrix<ScalarType, ALIGNMENT_A> & A,
+                   const viennacl::compressed_matrix<ScalarType, ALIGNMENT_B> & B,
+                         viennacl::compressed_matrix<ScalarType, ALIGNMENT_C> & C)
+    {
+      assert( (A.size2() == B.size1()) && bool("Size check failed for sparse matrix-matrix product: size2(A) != size1(B)"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::prod_impl(A, B, C);
+          break;
+        default:
+          throw "not implemented";
+      }
+    }
+
+
     /** @brief Carries out triangular inplace solves
     *
     * @param mat    The matrix
@@ -266,6 +394,79 @@ namespace viennacl
     return *this;
   }
 
+  /** @brief Implementation of the operation v1 = A * v2, where A is an out_of_core_compressed_matrix
+  *
+  * @param proxy  An expression template proxy class.
+  */
+  template <typename SCALARTYPE, unsigned int ALIGNMENT>
+  viennacl::vector<SCALARTYPE, ALIGNMENT> &
+  viennacl::vector<SCALARTYPE, ALIGNMENT>::operator=(const viennacl::vector_expression< const viennacl::out_of_core_compressed_matrix<SCALARTYPE>,
+                                                                                        const viennacl::vector_base<SCALARTYPE>,
+                                                                                        viennacl::op_prod> & proxy)
+  {
+    // check for the special case x = A * x
+    if (viennacl::traits::handle(proxy.rhs()) == viennacl::traits::handle(*this))
+    {
+      viennacl::vector<SCALARTYPE, ALIGNMENT> temp(proxy.lhs().size1());
+      viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), temp);
+      *this = temp;
+      return *this;
+    }
+
+    viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), *this);
+    return *this;
+  }
+
+  /** @brief Implementation of the operation C = A * B, where A is a sparse matrix and B is a dense matrix
+  *
+  * @param proxy  An expression template proxy class.
+  */
+  template <class SCALARTYPE, typename F, typename SizeType, typename DistanceType>
+  template <unsigned int ALIGNMENT, typename F2>
+  viennacl::matrix_base<SCALARTYPE, F, SizeType, DistanceType> &
+  viennacl::matrix_base<SCALARTYPE, F, SizeType, DistanceType>::operator=(const viennacl::matrix_expression< const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                                                                                             const viennacl::matrix_base<SCALARTYPE, F2>,
+                                                                                                             viennacl::op_prod> & proxy)
+  {
+    // check for the special case B = A * B
+    if (viennacl::traits::handle(proxy.rhs()) == viennacl::traits::handle(*this))
+    {
+      viennacl::matrix<SCALARTYPE, F> temp(proxy.size1(), proxy.size2());
+      viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), temp);
+      *this = temp;
+      return *this;
+    }
+
+    viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), *this);
+    return *this;
+  }
+
+  /** @brief Implementation of the operation C = A * trans(B), where A is a sparse matrix and B is a dense matrix
+  *
+  * @param proxy  An expression template proxy class.
+  */
+  template <class SCALARTYPE, typename F, typename SizeType, typename DistanceType>
+  template <unsigned int ALIGNMENT, typename F2>
+  viennacl::matrix_base<SCALARTYPE, F, SizeType, DistanceType> &
+  viennacl::matrix_base<SCALARTYPE, F, SizeType, DistanceType>::operator=(const viennacl::matrix_expression< const viennacl::compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                                                                                             const viennacl::matrix_expression<const viennacl::matrix_base<SCALARTYPE, F2>,
+                                                                                                                                               const viennacl::matrix_base<SCALARTYPE, F2>,
+                                                                                                                                               viennacl::op_trans>,
+                                                                                                             viennacl::op_prod> & proxy)
+  {
+    // check for the special case B = A * trans(B)
+    if (viennacl::traits::handle(proxy.rhs().lhs()) == viennacl::traits::handle(*this))
+    {
+      viennacl::matrix<SCALARTYPE, F> temp(proxy.size1(), proxy.size2());
+      viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), temp);
+      *this = temp;
+      return *this;
+    }
+
+    viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), *this);
+    return *this;
+  }
+
   //v += A * x
   /** @brief Implementation of the operation v1 += A * v2, where A is a matrix
   *
@@ -301,6 +502,37 @@ namespace viennacl
     return result;
   }
   
+  /** @brief Implementation of the operation v1 += A * v2, where A is an out_of_core_compressed_matrix
+  *
+  * @param result The result vector v1
+  * @param proxy  An expression template proxy class.
+  */
+  template <typename SCALARTYPE>
+  viennacl::vector_base<SCALARTYPE> &
+  operator+=(viennacl::vector_base<SCALARTYPE> & result,
+             const viennacl::vector_expression< const viennacl::out_of_core_compressed_matrix<SCALARTYPE>, const viennacl::vector_base<SCALARTYPE>, viennacl::op_prod> & proxy)
+  {
+    vector<SCALARTYPE> temp(proxy.lhs().size1());
+    viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), temp);
+    result += temp;
+    return result;
+  }
+
+  /** @brief Implementation of the operation v1 -= A * v2, where A is an out_of_core_compressed_matrix
+  *
+  * @param result The result vector v1
+  * @param proxy  An expression template proxy class.
+  */
+  template <typename SCALARTYPE>
+  viennacl::vector_base<SCALARTYPE> &
+  operator-=(viennacl::vector_base<SCALARTYPE> & result,
+             const viennacl::vector_expression< const viennacl::out_of_core_compressed_matrix<SCALARTYPE>, const viennacl::vector_base<SCALARTYPE>, viennacl::op_prod> & proxy)
+  {
+    vector<SCALARTYPE> temp(proxy.lhs().size1());
+    viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), temp);
+    result -= temp;
+    return result;
+  }
   
   //free functions:
   /** @brief Implementation of the operation 'result = v1 + A * v2', where A is a matrix
@@ -33,8 +33,12 @@
 #include <cmath>
 
 #include "viennacl/matrix.hpp"
-#include "viennacl/linalg/kernels/svd_kernels.h"
 #include "viennacl/linalg/qr-method-common.hpp"
+#include "viennacl/linalg/host_based/svd.hpp"
+
+#ifdef VIENNACL_WITH_OPENCL
+  #include "viennacl/linalg/kernels/svd_kernels.h"
+#endif
 
 namespace viennacl 
 {
@@ -44,6 +48,7 @@ namespace viennacl
     namespace detail 
     {
 
+#ifdef VIENNACL_WITH_OPENCL
       template<typename MatrixType, typename VectorType>
       void givens_prev(MatrixType & matrix,
                        VectorType & tmp1,
@@ -471,6 +476,67 @@ namespace viennacl
         }
       }
 
+      /** @brief SVD with bidiagonalization and QR iteration driven by OpenCL kernels */
+      template <typename SCALARTYPE, unsigned int ALIGNMENT>
+      void svd_opencl(viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & A,
+                      viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QL,
+                      viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QR)
+      {
+        viennacl::linalg::kernels::svd<SCALARTYPE, 1>::init();
+
+        std::size_t row_num = A.size1();
+        std::size_t col_num = A.size2();
+
+        std::size_t to = std::min(row_num, col_num);
+
+
+        //viennacl::vector<SCALARTYPE, ALIGNMENT> d(to);
+        //viennacl::vector<SCALARTYPE, ALIGNMENT> s(to + 1);
+        
+        // first stage
+        detail::bidiag(A, QL, QR);
+        
+        // second stage
+        //std::vector<SCALARTYPE> dh(to, 0);
+        //std::vector<SCALARTYPE> sh(to + 1, 0);
+        boost::numeric::ublas::vector<SCALARTYPE> dh(to, 0);
+        boost::numeric::ublas::vector<SCALARTYPE> sh(to + 1, 0);
+
+        detail::bidiag_pack(A, dh, sh);
+        
+        detail::svd_qr_shift( QL, QR, dh, sh);
+        
+        // Write resulting diagonal matrix with singular values to A:
+        boost::numeric::ublas::matrix<SCALARTYPE> h_Sigma(row_num, col_num);
+        h_Sigma.clear();
+
+        for (std::size_t i = 0; i < to; i++)
+          h_Sigma(i, i) = dh[i];
+
+        copy(h_Sigma, A);
+      }
+#endif
+
+      /** @brief SVD in host memory: blocked bidiagonalization followed by the implicitly shifted QR iteration. The singular values are sorted in descending order. */
+      template <typename NumericT, typename F>
+      void svd_host(matrix_base<NumericT, F> & A,
+                    matrix_base<NumericT, F> & QL,
+                    matrix_base<NumericT, F> & QR)
+      {
+        viennacl::linalg::host_based::detail::strided_matrix_view<NumericT> A_view = viennacl::linalg::host_based::detail::make_strided_view(A);
+
+        std::vector<NumericT> sigma;
+        viennacl::linalg::host_based::detail::svd(A_view,
+                                                  viennacl::linalg::host_based::detail::make_strided_view(QL),
+                                                  viennacl::linalg::host_based::detail::make_strided_view(QR),
+                                                  sigma);
+
+        // Write resulting diagonal matrix with singular values to A:
+        viennacl::linalg::host_based::detail::gemm_scale_C(A_view, NumericT(0));
+        for (std::size_t i = 0; i < sigma.size(); i++)
+          A_view(i, i) = sigma[i];
+      }
+
     } // namespace detail
 
 
@@ -485,38 +551,29 @@ namespace viennacl
               viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QL,
               viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QR) 
     {
-      viennacl::linalg::kernels::svd<SCALARTYPE, 1>::init();
-
-      std::size_t row_num = A.size1();
-      std::size_t col_num = A.size2();
-
-      std::size_t to = std::min(row_num, col_num);
-
-
-      //viennacl::vector<SCALARTYPE, ALIGNMENT> d(to);
-      //viennacl::vector<SCALARTYPE, ALIGNMENT> s(to + 1);
-      
-      // first stage
-      detail::bidiag(A, QL, QR);
-      
-      // second stage
-      //std::vector<SCALARTYPE> dh(to, 0);
-      //std::vector<SCALARTYPE> sh(to + 1, 0);
-      boost::numeric::ublas::vector<SCALARTYPE> dh(to, 0);
-      boost::numeric::ublas::vector<SCALARTYPE> sh(to + 1, 0);
+      assert(QL.size1() == A.size1() && QL.size2() == A.size1() && bool("Size of QL does not match"));
+      assert(QR.size1() == A.size2() && QR.size2() == A.size2() && bool("Size of QR does not match"));
 
-      detail::bidiag_pack(A, dh, sh);
-      
-      detail::svd_qr_shift( QL, QR, dh, sh);
-      
-      // Write resulting diagonal matrix with singular values to A:
-      boost::numeric::ublas::matrix<SCALARTYPE> h_Sigma(row_num, col_num);
-      h_Sigma.clear();
-
-      for (std::size_t i = 0; i < to; i++)
-        h_Sigma(i, i) = dh[i];
+      if (A.size1() == 0 || A.size2() == 0) // nothing to decompose (and no memory to dispatch on)
+      {
+        QL = viennacl::identity_matrix<SCALARTYPE>(QL.size1());
+        QR = viennacl::identity_matrix<SCALARTYPE>(QR.size1());
+        return;
+      }
 
-      copy(h_Sigma, A);
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          detail::svd_host(A, QL, QR);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          detail::svd_opencl(A, QL, QR);
+          break;
+#endif
+        default:
+          throw "not implemented";
+      }
     }
   }
 }
@@ -23,9 +23,6 @@
 */
 
 #include "viennacl/forwards.h"
-#include "viennacl/ocl/device.hpp"
-#include "viennacl/ocl/handle.hpp"
-#include "viennacl/ocl/kernel.hpp"
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
@@ -55,18 +52,12 @@ namespace viennacl
       assert(mat.size1() == result.size());
       assert(mat.size2() == vec.size());
       
-      viennacl::vector<SCALARTYPE> tmp(vec.size() * 4); tmp.clear();
-      viennacl::vector<SCALARTYPE> tmp2(vec.size() * 4);
-      
-      viennacl::vector<SCALARTYPE> tep(mat.elements().size() * 2);
-      viennacl::detail::fft::real_to_complex(mat.elements(), tep, mat.elements().size());
-
+      // the product is the first half of the cyclic convolution of the 2n matrix entries with the zero-padded vector:
+      viennacl::vector<SCALARTYPE> tmp(vec.size() * 2); tmp.clear();
+      viennacl::vector<SCALARTYPE> tmp2(vec.size() * 2);
 
-      
       copy(vec, tmp);
-      viennacl::detail::fft::real_to_complex(tmp, tmp2, vec.size() * 2);
-      viennacl::linalg::convolve(tep, tmp2, tmp);
-      viennacl::detail::fft::complex_to_real(tmp, tmp2, vec.size() * 2);
+      viennacl::linalg::real_convolve(mat.elements(), tmp, tmp2);
       copy(tmp2.begin(), tmp2.begin() + vec.size(), result.begin());
     }
 
@@ -27,7 +27,11 @@
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
 #include "viennacl/fft.hpp"
-#include "viennacl/linalg/opencl/vandermonde_matrix_operations.hpp"
+#include "viennacl/linalg/host_based/vandermonde_matrix_operations.hpp"
+
+#ifdef VIENNACL_WITH_OPENCL
+  #include "viennacl/linalg/opencl/vandermonde_matrix_operations.hpp"
+#endif
 
 namespace viennacl
 {
@@ -54,9 +58,14 @@ namespace viennacl
       
       switch (viennacl::traits::handle(mat).get_active_handle_id())
       {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::prod_impl(mat, vec, result);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
         case viennacl::OPENCL_MEMORY:
           viennacl::linalg::opencl::prod_impl(mat, vec, result);
           break;
+#endif
         default:
           throw "not implemented";
       }
@@ -361,6 +361,73 @@ namespace viennacl
       }
     }
     
+    /** @brief Computes the inner products of a vector with all vectors of a tuple - dispatcher interface
+     *
+     * All inner products are computed in a single pass over x.
+     *
+     * @param x        The vector
+     * @param y_tuple  The tuple of vectors y_0, ..., y_{k-1}
+     * @param result   The result vector, result[i] = <x, y_i>
+     */
+    template <typename T>
+    void inner_prod_impl(vector_base<T> const & x,
+                         vector_tuple<T> const & y_tuple,
+                         vector_base<T> & result)
+    {
+      assert( result.size() == y_tuple.const_size() && bool("Size mismatch") );
+      for (vcl_size_t i = 0; i < y_tuple.const_size(); ++i)
+        assert( x.size() == y_tuple.const_at(i).size() && bool("Size mismatch") );
+
+      switch (viennacl::traits::handle(x).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::inner_prod_impl(x, y_tuple, result);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          viennacl::linalg::opencl::inner_prod_impl(x, y_tuple, result);
+          break;
+#endif
+        default:
+          throw "not implemented";
+      }
+    }
+
+    /** @brief Computes x += alpha * (coefficients[0] * y_0 + ... + coefficients[k-1] * y_{k-1}) - dispatcher interface
+     *
+     * The update is carried out in a single pass over x. With alpha = -1 and the coefficients obtained from inner_prod(x, y_tuple),
+     * this is the projection step of classical Gram-Schmidt orthogonalization.
+     *
+     * @param x             The vector to be updated
+     * @param alpha         Scaling factor for the linear combination
+     * @param coefficients  The coefficients of the linear combination, one for each vector in the tuple
+     * @param y_tuple       The tuple of vectors y_0, ..., y_{k-1}
+     */
+    template <typename T>
+    void multi_axpy(vector_base<T> & x,
+                    T alpha,
+                    vector_base<T> const & coefficients,
+                    vector_tuple<T> const & y_tuple)
+    {
+      assert( coefficients.size() == y_tuple.const_size() && bool("Size mismatch") );
+      for (vcl_size_t i = 0; i < y_tuple.const_size(); ++i)
+        assert( x.size() == y_tuple.const_at(i).size() && bool("Size mismatch") );
+
+      switch (viennacl::traits::handle(x).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::multi_axpy(x, alpha, coefficients, y_tuple);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          viennacl::linalg::opencl::multi_axpy(x, alpha, coefficients, y_tuple);
+          break;
+#endif
+        default:
+          throw "not implemented";
+      }
+    }
+
     // vector expression on lhs
     template <typename LHS, typename RHS, typename OP, typename T>
     void inner_prod_impl(viennacl::vector_expression<LHS, RHS, OP> const & vec1,
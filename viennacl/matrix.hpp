@@ -618,7 +618,20 @@ namespace viennacl
         return *this;
       }
 
-  
+      //this = A * B with A in CSR format, and this = A * trans(B). Implementation in viennacl/linalg/sparse_matrix_operations.hpp
+      template <unsigned int ALIGNMENT, typename F2>
+      self_type & operator = (const matrix_expression< const compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                                       const matrix_base<SCALARTYPE, F2>,
+                                                       op_prod > & proxy);
+
+      template <unsigned int ALIGNMENT, typename F2>
+      self_type & operator = (const matrix_expression< const compressed_matrix<SCALARTYPE, ALIGNMENT>,
+                                                       const matrix_expression<const matrix_base<SCALARTYPE, F2>,
+                                                                               const matrix_base<SCALARTYPE, F2>,
+                                                                               op_trans>,
+                                                       op_prod > & proxy);
+
+
       /** @brief Returns the number of rows */
       size_type size1() const { return size1_;}
       /** @brief Returns the number of columns */
@@ -727,6 +740,8 @@ namespace viennacl
         }
       }
       
+      friend class viennacl::io::detail::binary_object_access;
+
     private:
       size_type size1_;
       size_type size2_;
@@ -0,0 +1,217 @@
+#ifndef VIENNACL_OUT_OF_CORE_COMPRESSED_MATRIX_HPP_
+#define VIENNACL_OUT_OF_CORE_COMPRESSED_MATRIX_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/out_of_core_compressed_matrix.hpp
+    @brief Implementation of the out_of_core_compressed_matrix class for sparse matrices which are kept on disk and streamed through main memory in blocks of rows.
+*/
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/backend/memory.hpp"
+#include "viennacl/io/binary.hpp"
+#include "viennacl/linalg/sparse_matrix_operations.hpp"
+
+/** @brief Default number of bytes of column indices and entries held in memory per row block. Two blocks are in memory at any time. */
+#ifndef VIENNACL_OUT_OF_CORE_BLOCK_BYTES
+  #define VIENNACL_OUT_OF_CORE_BLOCK_BYTES  (std::size_t(64) * 1024 * 1024)
+#endif
+
+namespace viennacl
+{
+  /** @brief Timings collected by the matrix-vector products with an out_of_core_compressed_matrix */
+  struct out_of_core_statistics
+  {
+    out_of_core_statistics() : products(0), bytes_read(0), io_time(0), compute_time(0), total_time(0) {}
+
+    std::size_t products;       //number of matrix-vector products
+    std::size_t bytes_read;     //number of bytes read from disk
+    double      io_time;        //seconds spent on reading row blocks
+    double      compute_time;   //seconds spent on computing with row blocks
+    double      total_time;     //wall-clock seconds of the matrix-vector products
+
+    /** @brief Returns the fraction of the shorter of reading and computing which was hidden behind the other. A value of one means perfect overlap. */
+    double overlap() const
+    {
+      double shorter = std::min(io_time, compute_time);
+      if (shorter <= 0)
+        return 0;
+      return std::max(0.0, std::min(1.0, (io_time + compute_time - total_time) / shorter));
+    }
+
+    /** @brief Returns the achieved read bandwidth in bytes per second */
+    double io_bandwidth() const { return (io_time > 0) ? static_cast<double>(bytes_read) / io_time : 0; }
+  };
+
+
+  /** @brief A sparse matrix in compressed row storage which is kept in a file and streamed through main memory in blocks of rows.
+  *
+  * The file is a compressed_matrix in the ViennaCL binary format, cf. viennacl::io::save() and viennacl::io::compressed_matrix_writer.
+  * Only the row pointers are kept in memory. A matrix-vector product reads the column indices and entries of one block of rows while the previous block is processed,
+  * so matrices larger than the available main memory can be used with viennacl::linalg::prod() and thus with the iterative solvers.
+  *
+  * @tparam SCALARTYPE    The floating point type (either float or double, checked at compile time)
+  */
+  template<class SCALARTYPE>
+  class out_of_core_compressed_matrix
+  {
+    public:
+      typedef viennacl::backend::mem_handle                                                              handle_type;
+      typedef scalar<typename viennacl::tools::CHECK_SCALAR_TEMPLATE_ARGUMENT<SCALARTYPE>::ResultType>   value_type;
+      typedef vcl_size_t                                                                                 size_type;
+
+      /** @brief Default construction of an empty matrix not associated with a file. */
+      out_of_core_compressed_matrix() : rows_(0), cols_(0), nonzeros_(0), col_offset_(0), elements_offset_(0), block_starts_(1, 0), max_block_nnz_(0) {}
+
+      /** @brief Opens the supplied file. See open() for details. */
+      explicit out_of_core_compressed_matrix(std::string const & filename, std::size_t block_bytes = VIENNACL_OUT_OF_CORE_BLOCK_BYTES)
+        : rows_(0), cols_(0), nonzeros_(0), col_offset_(0), elements_offset_(0), block_starts_(1, 0), max_block_nnz_(0)
+      {
+        open(filename, block_bytes);
+      }
+
+      /** @brief Associates the matrix with a file holding a compressed_matrix in the ViennaCL binary format.
+      *
+      * @param filename      Name of the file
+      * @param block_bytes   Number of bytes of column indices and entries loaded per block of rows. A block holds at least one row.
+      * @return              True on success. On failure, an error message is printed and the matrix is left unchanged.
+      */
+      bool open(std::string const & filename, std::size_t block_bytes = VIENNACL_OUT_OF_CORE_BLOCK_BYTES)
+      {
+        viennacl::io::detail::binary_file_reader reader(filename, false);
+        if (!reader.good() || !reader.check_object(viennacl::io::detail::BINARY_COMPRESSED_MATRIX, 3))
+          return false;
+
+        viennacl::io::detail::binary_header const & header = reader.header();
+        if (header.scalar_size != sizeof(SCALARTYPE))
+        {
+          std::cerr << "ViennaCL: Error in out_of_core_compressed_matrix: File " << filename << " holds entries of a different floating point type" << std::endl;
+          return false;
+        }
+
+        handle_type row_buffer;
+        if (!reader.install(0, row_buffer, (header.size1 > 0) ? sizeof(unsigned int) * (header.size1 + 1) : 0, viennacl::MAIN_MEMORY))
+          return false;
+
+        //partition rows into blocks:
+        std::vector<std::size_t> block_starts(1, 0);
+        std::size_t max_block_nnz = 0;
+        if (header.size1 > 0)
+        {
+          unsigned int const * row_ptr = reinterpret_cast<unsigned int const *>(row_buffer.ram_handle().get());
+          std::size_t bytes_per_entry = sizeof(unsigned int) + sizeof(SCALARTYPE);
+          for (std::size_t row = 0; row < header.size1; ++row)
+          {
+            std::size_t block_begin = block_starts.back();
+            if (row > block_begin && (row_ptr[row + 1] - row_ptr[block_begin]) * bytes_per_entry > block_bytes)
+            {
+              max_block_nnz = std::max<std::size_t>(max_block_nnz, row_ptr[row] - row_ptr[block_begin]);
+              block_starts.push_back(row);
+            }
+          }
+          max_block_nnz = std::max<std::size_t>(max_block_nnz, row_ptr[header.size1] - row_ptr[block_starts.back()]);
+          block_starts.push_back(header.size1);
+        }
+
+        filename_        = filename;
+        rows_            = header.size1;
+        cols_            = header.size2;
+        nonzeros_        = header.nnz;
+        col_offset_      = header.array_offset[1];
+        elements_offset_ = header.array_offset[2];
+        row_buffer_      = row_buffer;
+        block_starts_    = block_starts;
+        max_block_nnz_   = max_block_nnz;
+        statistics_      = out_of_core_statistics();
+        for (std::size_t i=0; i<2; ++i)
+        {
+          std::vector<unsigned int>().swap(block_cols_[i]);
+          std::vector<SCALARTYPE>().swap(block_elements_[i]);
+        }
+        return true;
+      }
+
+      /** @brief Returns the number of rows */
+      std::size_t size1() const { return rows_; }
+      /** @brief Returns the number of columns */
+      std::size_t size2() const { return cols_; }
+      /** @brief Returns the number of nonzero entries */
+      std::size_t nnz() const { return nonzeros_; }
+
+      /** @brief Returns the number of row blocks */
+      std::size_t blocks() const { return block_starts_.size() - 1; }
+      /** @brief Returns the first row of the supplied block. block_start(blocks()) returns the number of rows. */
+      std::size_t block_start(std::size_t block) const { return block_starts_[block]; }
+      /** @brief Returns the largest number of nonzeros in a row block */
+      std::size_t max_block_nnz() const { return max_block_nnz_; }
+
+      /** @brief Returns the name of the file holding the matrix */
+      std::string const & filename() const { return filename_; }
+      /** @brief Returns the offset of the column index array in the file */
+      std::size_t column_offset() const { return col_offset_; }
+      /** @brief Returns the offset of the array of entries in the file */
+      std::size_t elements_offset() const { return elements_offset_; }
+
+      /** @brief Returns the handle to the row pointer array, which always resides in main memory */
+      const handle_type & handle1() const { return row_buffer_; }
+      /** @brief Returns the handle to the row pointer array. Used for determining the memory domain in which products are computed. */
+      const handle_type & handle() const { return row_buffer_; }
+
+      /** @brief Returns the accumulated timings of all matrix-vector products since the file was opened or the statistics were reset. */
+      out_of_core_statistics const & statistics() const { return statistics_; }
+      /** @brief Resets the accumulated timings */
+      void reset_statistics() { statistics_ = out_of_core_statistics(); }
+
+      /** @brief Adds the timings of a matrix-vector product. Called by the compute backend. */
+      void record_statistics(std::size_t bytes_read, double io_time, double compute_time, double total_time) const
+      {
+        statistics_.products     += 1;
+        statistics_.bytes_read   += bytes_read;
+        statistics_.io_time      += io_time;
+        statistics_.compute_time += compute_time;
+        statistics_.total_time   += total_time;
+      }
+
+      /** @brief Returns the buffer for the column indices of a row block. Two buffers are used alternately by the compute backend. */
+      std::vector<unsigned int> & column_block_buffer(std::size_t i) const { return block_cols_[i]; }
+      /** @brief Returns the buffer for the entries of a row block. Two buffers are used alternately by the compute backend. */
+      std::vector<SCALARTYPE> & element_block_buffer(std::size_t i) const { return block_elements_[i]; }
+
+    private:
+      std::string filename_;
+      std::size_t rows_;
+      std::size_t cols_;
+      std::size_t nonzeros_;
+      std::size_t col_offset_;
+      std::size_t elements_offset_;
+      handle_type row_buffer_;
+      std::vector<std::size_t> block_starts_;
+      std::size_t max_block_nnz_;
+      mutable out_of_core_statistics statistics_;
+      mutable std::vector<unsigned int> block_cols_[2];
+      mutable std::vector<SCALARTYPE>   block_elements_[2];
+  };
+
+}
+
+#endif
@@ -24,7 +24,6 @@
 
 #include "viennacl/forwards.h"
 #include "viennacl/vector.hpp"
-#include "viennacl/ocl/context.hpp"
 
 #include "viennacl/fft.hpp"
 
@@ -51,7 +50,6 @@ namespace viennacl {
          */
         explicit toeplitz_matrix()
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
 
         /** @brief         Creates the matrix with the given size
@@ -63,7 +61,6 @@ namespace viennacl {
         {
           assert(rows == cols && bool("Toeplitz matrix must be square!"));
           (void)cols;  // avoid 'unused parameter' warning in optimized builds
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
         
 
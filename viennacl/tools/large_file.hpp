@@ -0,0 +1,92 @@
+#ifndef VIENNACL_TOOLS_LARGE_FILE_HPP_
+#define VIENNACL_TOOLS_LARGE_FILE_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/tools/large_file.hpp
+    @brief Seeking and position queries on C file streams with 64-bit offsets. std::fseek() and std::ftell() use 'long', which is 32 bits wide on Windows and on 32-bit POSIX systems.
+*/
+
+#include <cstdio>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/types.h>
+#endif
+
+namespace viennacl
+{
+  namespace tools
+  {
+
+    /** @brief Moves the position of a file stream to 'offset' bytes from the beginning of the file.
+    *
+    * Uses fseeko() on POSIX systems and _fseeki64() on Windows.
+    * Returns false if the seek fails or if the offset cannot be represented by the offset type of the platform (an error message is printed in that case).
+    */
+    inline bool seek_file(std::FILE * file, std::size_t offset)
+    {
+#if defined(_WIN32)
+      typedef __int64  offset_type;
+#elif defined(__unix__) || defined(__APPLE__)
+      typedef off_t    offset_type;
+#else
+      typedef long     offset_type;
+#endif
+
+      offset_type file_offset = static_cast<offset_type>(offset);
+      if (file_offset < 0 || static_cast<std::size_t>(file_offset) != offset)
+      {
+        std::cerr << "ViennaCL: File offset " << offset << " exceeds the range of the file offset type (" << sizeof(offset_type) * 8 << " bits)" << std::endl;
+        return false;
+      }
+
+#if defined(_WIN32)
+      return ::_fseeki64(file, file_offset, SEEK_SET) == 0;
+#elif defined(__unix__) || defined(__APPLE__)
+      return ::fseeko(file, file_offset, SEEK_SET) == 0;
+#else
+      return std::fseek(file, file_offset, SEEK_SET) == 0;
+#endif
+    }
+
+    /** @brief Returns the size of the file in bytes in 'size'. The position of the stream is reset to the beginning of the file. Returns false on failure. */
+    inline bool file_size(std::FILE * file, std::size_t & size)
+    {
+#if defined(_WIN32)
+      bool success = (::_fseeki64(file, 0, SEEK_END) == 0);
+      __int64 position = success ? ::_ftelli64(file) : -1;
+#elif defined(__unix__) || defined(__APPLE__)
+      bool success = (::fseeko(file, 0, SEEK_END) == 0);
+      off_t position = success ? ::ftello(file) : -1;
+#else
+      bool success = (std::fseek(file, 0, SEEK_END) == 0);
+      long position = success ? std::ftell(file) : -1;
+#endif
+
+      if (position < 0 || !seek_file(file, 0))
+        return false;
+
+      size = static_cast<std::size_t>(position);
+      return true;
+    }
+
+  } //namespace tools
+} //namespace viennacl
+
+#endif
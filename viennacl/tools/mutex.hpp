@@ -0,0 +1,88 @@
+#ifndef VIENNACL_TOOLS_MUTEX_HPP_
+#define VIENNACL_TOOLS_MUTEX_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2013, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/tools/mutex.hpp
+    @brief A minimal mutex for process-wide caches, which may be accessed from several host threads (OpenMP threads or others). Will be used until C++11 is widely available.
+*/
+
+#ifdef _WIN32
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+namespace viennacl
+{
+  namespace tools
+  {
+
+    /** @brief A non-recursive mutex based on CRITICAL_SECTION (Windows) or pthread_mutex_t (POSIX) */
+    class mutex
+    {
+      public:
+#ifdef _WIN32
+        mutex()  { InitializeCriticalSection(&handle_); }
+        ~mutex() { DeleteCriticalSection(&handle_); }
+
+        void lock()   { EnterCriticalSection(&handle_); }
+        void unlock() { LeaveCriticalSection(&handle_); }
+#else
+        mutex()  { pthread_mutex_init(&handle_, NULL); }
+        ~mutex() { pthread_mutex_destroy(&handle_); }
+
+        void lock()   { pthread_mutex_lock(&handle_); }
+        void unlock() { pthread_mutex_unlock(&handle_); }
+#endif
+
+      private:
+        mutex(mutex const &);
+        mutex & operator=(mutex const &);
+
+#ifdef _WIN32
+        CRITICAL_SECTION handle_;
+#else
+        pthread_mutex_t handle_;
+#endif
+    };
+
+    /** @brief Locks a mutex for the lifetime of the object (cf. std::lock_guard) */
+    class lock_guard
+    {
+      public:
+        explicit lock_guard(mutex & m) : mutex_(m) { mutex_.lock(); }
+        ~lock_guard() { mutex_.unlock(); }
+
+      private:
+        lock_guard(lock_guard const &);
+        lock_guard & operator=(lock_guard const &);
+
+        mutex & mutex_;
+    };
+
+  } //namespace tools
+} //namespace viennacl
+
+#endif
@@ -270,6 +270,12 @@ namespace viennacl
     {
       typedef viennacl::compressed_matrix<ScalarType, A1>   ResultType;
     };
+
+    template <typename NumericT, typename F>
+    struct MATRIX_EXTRACTOR_IMPL<viennacl::batched_matrix<NumericT, F>, viennacl::batched_matrix<NumericT, F> >
+    {
+      typedef viennacl::batched_matrix<NumericT, F>   ResultType;
+    };
     
     
     // adding matrix_expression to the resolution:
@@ -289,6 +295,19 @@ namespace viennacl
       typedef viennacl::matrix<NumericT, F>      ResultType;
     };
 
+    //sparse matrix times dense matrix:
+    template <typename ScalarType, unsigned int A, typename F>
+    struct MATRIX_EXTRACTOR_IMPL<viennacl::compressed_matrix<ScalarType, A>, viennacl::matrix_base<ScalarType, F> >
+    {
+      typedef viennacl::matrix<ScalarType, F>      ResultType;
+    };
+
+    template <typename ScalarType, unsigned int A, typename V2, typename S2, typename OP2>
+    struct MATRIX_EXTRACTOR_IMPL<viennacl::compressed_matrix<ScalarType, A>, viennacl::matrix_expression<const V2, const S2, OP2> >
+    {
+      typedef typename MATRIX_EXTRACTOR<V2, S2>::ResultType      ResultType;
+    };
+
 
     //special case: outer vector product
     template <typename ScalarType, typename T>
@@ -161,6 +161,18 @@ namespace viennacl
       return proxy.lhs().size1(); 
     }
     
+    template <typename ScalarType, typename VectorType>
+    vcl_size_t size(vector_expression<const out_of_core_compressed_matrix<ScalarType>, const VectorType, op_prod> const & proxy)
+    {
+      return proxy.lhs().size1();
+    }
+
+    template <typename NumericT>
+    vcl_size_t size(vector_expression<const vector_base<NumericT>, const vector_tuple<NumericT>, op_inner_prod> const & proxy)  //multiple inner products
+    {
+      return proxy.rhs().const_size();
+    }
+
     template <typename NumericT, typename F>
     vcl_size_t size(vector_expression<const matrix_base<NumericT, F>, const vector_base<NumericT>, op_prod> const & proxy)  //matrix-vector product
     {
@@ -26,7 +26,6 @@
 
 #include "viennacl/forwards.h"
 #include "viennacl/vector.hpp"
-#include "viennacl/ocl/context.hpp"
 
 #include "viennacl/fft.hpp"
 
@@ -51,7 +50,6 @@ namespace viennacl {
          */
         explicit vandermonde_matrix()
         {
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
 
         /**
@@ -64,7 +62,6 @@ namespace viennacl {
         {
           assert(rows == cols && bool("Vandermonde matrix must be square in this release!"));
           (void)cols;  // avoid 'unused parameter' warning in optimized builds
-          viennacl::linalg::kernels::fft<SCALARTYPE, 1>::init();
         }
 
         /** @brief Resizes the matrix.
@@ -740,6 +740,18 @@ namespace viennacl
   
       ///////////////////////////// Matrix Vector interaction end ///////////////////////////////////
 
+      /** @brief Operator overload for v1 = inner_prod(x, tie(y0, y1, ...)), which computes all inner products in a single pass over x.
+      *
+      * @param proxy An expression template proxy class
+      */
+      self_type & operator=(const vector_expression< const vector_base<SCALARTYPE>, const vector_tuple<SCALARTYPE>, op_inner_prod> & proxy)
+      {
+        assert(proxy.rhs().const_size() == size() && bool("Size check failed for v1 = inner_prod(x, tie(y0, y1, ...)): size(v1) != number of vectors in tuple"));
+
+        viennacl::linalg::inner_prod_impl(proxy.lhs(), proxy.rhs(), *this);
+        return *this;
+      }
+
   
       //read-write access to an element of the vector
       /** @brief Read-write access to a single element of the vector
@@ -996,6 +1008,8 @@ namespace viennacl
       }
       
       
+      friend class viennacl::io::detail::binary_object_access;
+
     private:
       size_type       size_;
       size_type       start_;
@@ -1109,6 +1123,14 @@ namespace viennacl
                                                  const base_type,
                                                  viennacl::op_prod> & proxy) ;
     
+    /** @brief Operator overload for v1 = A * v2, where v1, v2 are vectors in main memory and A is an out_of_core_compressed_matrix.
+    *
+    * @param proxy An expression template proxy class
+    */
+    self_type & operator=(const viennacl::vector_expression< const out_of_core_compressed_matrix<SCALARTYPE>,
+                                                             const base_type,
+                                                             viennacl::op_prod> & proxy);
+
     //
     // circulant_matrix<>
     //
@@ -1340,6 +1362,75 @@ namespace viennacl
   }; //vector
   
 
+  /** @brief A tuple of vectors, which is used for batched operations such as inner products of a vector with several other vectors.
+  *
+  * Only references to the vectors are stored, thus the vectors must outlive the tuple.
+  */
+  template <typename SCALARTYPE>
+  class vector_tuple
+  {
+      typedef vector_base<SCALARTYPE>   VectorType;
+
+    public:
+      typedef SCALARTYPE                value_type;
+      typedef vcl_size_t                size_type;
+
+      vector_tuple(VectorType const & v0, VectorType const & v1) : const_vectors_(2)
+      {
+        const_vectors_[0] = &v0;
+        const_vectors_[1] = &v1;
+      }
+
+      vector_tuple(VectorType const & v0, VectorType const & v1, VectorType const & v2) : const_vectors_(3)
+      {
+        const_vectors_[0] = &v0;
+        const_vectors_[1] = &v1;
+        const_vectors_[2] = &v2;
+      }
+
+      vector_tuple(VectorType const & v0, VectorType const & v1, VectorType const & v2, VectorType const & v3) : const_vectors_(4)
+      {
+        const_vectors_[0] = &v0;
+        const_vectors_[1] = &v1;
+        const_vectors_[2] = &v2;
+        const_vectors_[3] = &v3;
+      }
+
+      /** @brief Creates the tuple from an arbitrary number of vectors. */
+      explicit vector_tuple(std::vector<VectorType const *> const & vecs) : const_vectors_(vecs) {}
+
+      /** @brief Returns the number of vectors in the tuple */
+      size_type const_size() const { return const_vectors_.size(); }
+
+      /** @brief Returns the i-th vector in the tuple */
+      VectorType const & const_at(size_type i) const { return *(const_vectors_.at(i)); }
+
+    private:
+      std::vector<VectorType const *> const_vectors_;
+  };
+
+  /** @brief Creates a tuple of two vectors, e.g. for use in inner_prod(x, tie(y0, y1)) */
+  template <typename SCALARTYPE>
+  vector_tuple<SCALARTYPE> tie(vector_base<SCALARTYPE> const & v0, vector_base<SCALARTYPE> const & v1)
+  {
+    return vector_tuple<SCALARTYPE>(v0, v1);
+  }
+
+  /** @brief Creates a tuple of three vectors, e.g. for use in inner_prod(x, tie(y0, y1, y2)) */
+  template <typename SCALARTYPE>
+  vector_tuple<SCALARTYPE> tie(vector_base<SCALARTYPE> const & v0, vector_base<SCALARTYPE> const & v1, vector_base<SCALARTYPE> const & v2)
+  {
+    return vector_tuple<SCALARTYPE>(v0, v1, v2);
+  }
+
+  /** @brief Creates a tuple of four vectors, e.g. for use in inner_prod(x, tie(y0, y1, y2, y3)) */
+  template <typename SCALARTYPE>
+  vector_tuple<SCALARTYPE> tie(vector_base<SCALARTYPE> const & v0, vector_base<SCALARTYPE> const & v1, vector_base<SCALARTYPE> const & v2, vector_base<SCALARTYPE> const & v3)
+  {
+    return vector_tuple<SCALARTYPE>(v0, v1, v2, v3);
+  }
+
+
   //
   //////////////////// Copy from GPU to CPU //////////////////////////////////
   //